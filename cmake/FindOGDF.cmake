@@ -1,5 +1,9 @@
 if (NOT DEFINED OGDF_PATH)
-  message(FATAL_ERROR "You must defined OGDF_PATH")
+  if (OGDF_FIND_REQUIRED)
+    message(FATAL_ERROR "You must defined OGDF_PATH")
+  endif()
+  message("INFO: OGDF_PATH is not defined, OGDF won't be used")
+  return()
 endif()
 
 set(OGDF_INCLUDE_DIRS ${OGDF_PATH}/include)
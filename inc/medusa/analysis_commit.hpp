@@ -0,0 +1,98 @@
+#ifndef _MEDUSA_ANALYSIS_COMMIT_
+#define _MEDUSA_ANALYSIS_COMMIT_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/address.hpp"
+#include "medusa/instruction.hpp"
+
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include <functional>
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4251)
+#endif
+
+MEDUSA_NAMESPACE_BEGIN
+
+/*!
+ * AnalysisBatch holds what an analysis worker found from one entry point.
+ * Nothing is written to the document until the batch is committed, so the
+ * content of a batch only depends on the document state before the pass.
+ */
+class Medusa_EXPORT AnalysisBatch
+{
+public:
+  typedef std::map<Address, Instruction::SPtr> InstructionMap;
+  typedef std::vector<AnalysisBatch>           Vector;
+
+  AnalysisBatch(Address const& rEntryAddr, u32 Pass)
+    : m_EntryAddr(rEntryAddr), m_Pass(Pass) {}
+
+  Address const&          GetEntryAddress(void) const { return m_EntryAddr; }
+  u32                     GetPass(void) const         { return m_Pass;      }
+
+  //! This method buffers a disassembled instruction.
+  void                    AddInstruction(Address const& rAddr, Instruction::SPtr spInsn);
+
+  //! This method returns true if rAddr is covered by a buffered instruction.
+  bool                    ContainsCode(Address const& rAddr) const;
+
+  InstructionMap const&   GetInstructions(void) const { return m_Instructions; }
+
+  //! This method adds an address which must be analyzed during the next pass.
+  void                    AddNextEntryAddress(Address const& rAddr) { m_NextEntries.push_back(rAddr); }
+  Address::List const&    GetNextEntryAddresses(void) const         { return m_NextEntries;           }
+
+  //! This method adds an address which must become a function once the analysis is done.
+  void                    AddFunction(Address const& rAddr)         { m_Functions.push_back(rAddr);   }
+  Address::List const&    GetFunctions(void) const                  { return m_Functions;             }
+
+  //! This method buffers a log message, it's written when the batch is committed.
+  void                    AddMessage(std::string const& rMsg)       { m_Messages.push_back(rMsg);     }
+  std::list<std::string> const& GetMessages(void) const             { return m_Messages;              }
+
+  //! Batches are committed by pass, then by entry address.
+  bool                    operator<(AnalysisBatch const& rBatch) const;
+
+private:
+  Address                m_EntryAddr;
+  u32                    m_Pass;
+  InstructionMap         m_Instructions;
+  Address::List          m_NextEntries;
+  Address::List          m_Functions;
+  std::list<std::string> m_Messages;
+};
+
+/*!
+ * AnalysisCommitQueue gathers batches produced by several workers and
+ * applies them in a canonical order. Since neither the content of a batch
+ * nor the commit order depends on thread timing, the resulting document is
+ * the same whatever the number of workers is.
+ */
+class Medusa_EXPORT AnalysisCommitQueue
+{
+public:
+  typedef std::function<void (AnalysisBatch const& rBatch)> CommitFunctionType;
+
+  AnalysisCommitQueue(u32 WorkerNo);
+
+  u32  GetNumberOfWorkers(void) const { return static_cast<u32>(m_WorkerBatches.size()); }
+
+  //! This method must only be called by the worker WorkerId, each worker owns its buffer so no lock is needed.
+  void Push(u32 WorkerId, AnalysisBatch&& rBatch);
+
+  //! This method must be called once all workers are done, it empties the queue.
+  void Commit(CommitFunctionType Commit);
+
+private:
+  std::vector<AnalysisBatch::Vector> m_WorkerBatches;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_ANALYSIS_COMMIT_
@@ -7,9 +7,12 @@
 #include "medusa/architecture.hpp"
 #include "medusa/control_flow_graph.hpp"
 #include "medusa/task.hpp"
+#include "medusa/analysis_commit.hpp"
 
 #include <fstream>
 #include <string>
+#include <thread>
+#include <algorithm>
 
 #include <boost/thread/mutex.hpp>
 #include <boost/graph/graphviz.hpp>
@@ -39,11 +42,24 @@ private:
     virtual std::string GetName(void) const;
     virtual void Run(void);
 
+    /*! This method follows the execution flow of the function at the task address without modifying the document.
+     * \param rBatch receives instructions, next entry points and functions.
+     */
+    bool Explore(AnalysisBatch& rBatch);
+
+    //! This method writes a batch built by Explore to the document.
+    bool Commit(AnalysisBatch const& rBatch);
+
+    bool CreateFunction(Address const& rAddr);
+
   protected:
     bool Disassemble(Address const& rAddr);
-    bool DisassembleBasicBlock(Address const& rAddr, std::list<Instruction::SPtr>& rBasicBlock);
+
+    /*! This method disassembles instructions until the end of a basic block.
+     * \param pBatch if not null, instructions it holds are considered as code and errors are buffered in it.
+     */
+    bool DisassembleBasicBlock(Address const& rAddr, std::list<Instruction::SPtr>& rBasicBlock, AnalysisBatch* pBatch = nullptr);
     bool CreateCrossReferences(Address const& rAddr);
-    bool CreateFunction(Address const& rAddr);
 
     /*! This method computes the size of a function.
     * \param rFuncAddr is the function address.
@@ -74,7 +90,7 @@ private:
   class DisassembleAllFunctionsTask : public Task
   {
   public:
-    DisassembleAllFunctionsTask(Document& rDoc);
+    DisassembleAllFunctionsTask(Document& rDoc, u32 WorkerNo);
     ~DisassembleAllFunctionsTask(void);
 
     virtual std::string GetName(void) const;
@@ -82,6 +98,7 @@ private:
 
   private:
     Document& m_rDoc;
+    u32       m_WorkerNo;
   };
 
   class FindAllStringTask : public Task
@@ -104,16 +121,23 @@ public:
   , m_LabelPrefix("lbl_")
   , m_DataPrefix("dat_")
   , m_StringPrefix("str_")
+  , m_WorkerNo(std::max(std::thread::hardware_concurrency(), 1U))
   {}
 
   ~Analyzer(void) { }
 
+  //! This method returns the number of threads used to disassemble all functions.
+  u32 GetNumberOfWorkers(void) const { return m_WorkerNo; }
+
+  //! This method sets the number of threads used to disassemble all functions, the result doesn't depend on it.
+  void SetNumberOfWorkers(u32 WorkerNo) { m_WorkerNo = WorkerNo != 0 ? WorkerNo : 1; }
+
   Task* CreateDisassembleTask(Document& rDoc, Address const& rAddr, Architecture& rArch, u8 Mode) const
   { return new DisassembleTask(rDoc, rAddr, rArch, Mode); }
   Task* CreateDisassembleFunctionTask(Document& rDoc, Address const& rAddr, Architecture& rArch, u8 Mode) const
   { return new DisassembleFunctionTask(rDoc, rAddr, rArch, Mode); }
   Task* CreateDisassembleAllFunctionsTask(Document& rDoc) const
-  { return new DisassembleAllFunctionsTask(rDoc); }
+  { return new DisassembleAllFunctionsTask(rDoc, m_WorkerNo); }
   Task* CreateFindAllStringTask(Document& rDoc) const
   { return new FindAllStringTask(rDoc); }
 
@@ -140,6 +164,13 @@ public:
   bool BuildControlFlowGraph(Document const& rDoc, std::string const& rLblName, ControlFlowGraph& rCfg) const;
   bool BuildControlFlowGraph(Document const& rDoc, Address const& rAddr,        ControlFlowGraph& rCfg) const;
 
+  bool FormatCell(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddress,
+    Cell          const& rCell,
+    CellText           & rText) const;
+
   bool FormatCell(
     Document      const& rDoc,
     BinaryStream  const& rBinStrm,
@@ -163,6 +194,7 @@ public:
   std::string          m_LabelPrefix;    //! Label prefix
   std::string          m_DataPrefix;     //! Data prefix
   std::string          m_StringPrefix;   //! String prefix
+  u32                  m_WorkerNo;       //! Number of analysis workers
   mutable boost::mutex m_DisasmMutex;
 };
 
@@ -15,6 +15,7 @@
 #include "medusa/character.hpp"
 #include "medusa/value.hpp"
 #include "medusa/instruction.hpp"
+#include "medusa/cell_text.hpp"
 
 #include "medusa/function.hpp"
 #include "medusa/string.hpp"
@@ -51,7 +52,33 @@ public:
   virtual bool        Translate(Address const& rVirtAddr, TOffset& rPhysOff) = 0;
 
   //! This method disassembles one instruction.
-  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode) = 0;
+  bool                Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+  { return Disassemble(FetchWindow(rBinStrm, Offset, GetMaximumInstructionLength()), rInsn, Mode); }
+
+  //! This method disassembles the instruction located at the beginning of the window.
+  virtual bool        Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode) = 0;
+
+  /*! This method disassembles the range [Offset, Offset + Size) with a linear sweep.
+   * \param rRecords receives one record per decoded instruction, it is not cleared.
+   * \return Returns the number of decoded instructions, bytes which can't be decoded are skipped one by one.
+   */
+  u32                 DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, InstructionRecord::Vector& rRecords);
+
+  //! This method decodes only the length and the sub type of one instruction.
+  bool                DecodeLength(BinaryStream const& rBinStrm, TOffset Offset, u8 Mode, u16& rLength, u8& rSubType)
+  { return DecodeLength(FetchWindow(rBinStrm, Offset, GetMaximumInstructionLength()), Mode, rLength, rSubType); }
+
+  /*! This method decodes only the length and the sub type of the instruction located at the beginning of the window.
+   * The default implementation disassembles the whole instruction, architectures can provide a faster decoder
+   * as long as it accepts the same instructions as Disassemble.
+   */
+  virtual bool        DecodeLength(FetchWindow const& rWnd, u8 Mode, u16& rLength, u8& rSubType);
+
+  //! This method returns the maximum number of bytes read to disassemble one instruction.
+  virtual u8          GetMaximumInstructionLength(void) const = 0;
+
+  //! This method builds a semantic deferred with Instruction::SetSemanticBuilder.
+  virtual bool        BuildSemantic(Instruction& rInsn, u32 SemanticId) { return false; }
 
   //! This method returns all available mode
   virtual NamedModeVector GetModes(void) const = 0;
@@ -83,12 +110,23 @@ public:
   ConfigurationModel& GetConfigurationModel(void) { return m_CfgMdl; }
   ConfigurationModel const& GetConfigurationModel(void) const { return m_CfgMdl; }
   bool                DisassembleBasicBlockOnly(void) const { return m_CfgMdl.GetBoolean("Disassembly only basic block"); }
+  bool                UseLazySemantic(void) const { return m_CfgMdl.GetBoolean("Lazy semantic"); }
+  bool                UseSimplifiedSemantic(void) const { return m_CfgMdl.GetBoolean("Simplify semantic"); }
 
   //! This method allows architecture to format cell as it wants.
   //\param rDoc is needed if rCell contains a reference.
   //\param rBinStrm must be the binary stream of the memory area where rCell is located.
   //\param rAddr is the address of rCell.
   //\param rCell is the cell object.
+  //\param rText receives the text and the marks, it's appended so the caller should clear it before reusing it.
+  bool FormatCell(
+    Document      const& rDoc,
+    BinaryStream  const& rBinStrm,
+    Address       const& rAddress,
+    Cell          const& rCell,
+    CellText           & rText) const;
+
+  //! This method is the same as above, but the text and the marks are copied out of a temporary CellText.
   bool FormatCell(
     Document      const& rDoc,
     BinaryStream  const& rBinStrm,
@@ -97,7 +135,7 @@ public:
     std::string        & rStrCell,
     Cell::Mark::List   & rMarks) const;
 
-  //! This method converts an Instruction object to a string and stores the result on it.
+  //! This method converts an Instruction object to a text and appends it to rText.
   //\param rDoc is needed if an operand contains a reference.
   //\param rAddr is the address of rInsn.
   //\param rInsn is the cell object.
@@ -106,8 +144,7 @@ public:
     BinaryStream  const& rBinStrm,
     Address       const& rAddr,
     Instruction   const& rInsn,
-    std::string        & rStrCell,
-    Cell::Mark::List   & rMarks) const;
+    CellText           & rText) const;
 
   //! This method reads and convert a character.
   //\param rDoc is reserved for future use.
@@ -119,8 +156,7 @@ public:
     BinaryStream  const& rBinStrm,
     Address       const& rAddr,
     Character     const& rChar,
-    std::string        & rStrCell,
-    Cell::Mark::List   & rMarks) const;
+    CellText           & rText) const;
 
   //! This method reads and convert a numeric value.
   //\param rDoc is needed if rVal contains a reference.
@@ -132,8 +168,7 @@ public:
     BinaryStream  const& rBinStrm,
     Address       const& rAddr,
     Value         const& rVal,
-    std::string        & rStrCell,
-    Cell::Mark::List   & rMarks) const;
+    CellText           & rText) const;
 
   bool FormatMultiCell(
     Document      const& rDoc,
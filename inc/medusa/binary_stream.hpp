@@ -10,6 +10,7 @@
 #include <string>
 #include <cstring>
 #include <memory>
+#include <algorithm>
 
 #include <boost/type_traits.hpp>
 #include <boost/filesystem/path.hpp>
@@ -223,6 +224,89 @@ public:
   void Close(void);
 };
 
+/*!
+ * FetchWindow gives access to the bytes of one instruction.
+ *
+ * The window is validated once when it is created and shortened if it crosses
+ * the end of the stream, decoders only have to compare the position of each
+ * read with the window size. Positions are offsets in the stream, like with
+ * BinaryStream. Reads outside of the window (e.g. literal pools) go through
+ * the stream the window was created from, if any.
+ */
+class Medusa_EXPORT FetchWindow
+{
+public:
+  FetchWindow(void)
+    : m_pBinStrm(nullptr), m_pBytes(nullptr), m_Offset(0), m_Size(0) {}
+
+  FetchWindow(u8 const* pBytes, TOffset Offset, u32 Size)
+    : m_pBinStrm(nullptr), m_pBytes(pBytes), m_Offset(Offset), m_Size(pBytes != nullptr ? Size : 0) {}
+
+  //! This constructor maps up to MaxSize bytes from Offset, no byte is copied.
+  FetchWindow(BinaryStream const& rBinStrm, TOffset Offset, u32 MaxSize)
+    : m_pBinStrm(&rBinStrm), m_pBytes(nullptr), m_Offset(Offset), m_Size(0)
+  {
+    if (rBinStrm.GetBuffer() == nullptr || Offset >= rBinStrm.GetSize())
+      return;
+    m_pBytes = static_cast<u8 const*>(rBinStrm.GetBuffer()) + Offset;
+    m_Size   = static_cast<u32>(std::min<TOffset>(MaxSize, rBinStrm.GetSize() - Offset));
+  }
+
+  u8 const* GetBytes(void)  const { return m_pBytes; }
+  TOffset   GetOffset(void) const { return m_Offset; }
+  u32       GetSize(void)   const { return m_Size;   }
+
+  //! This method returns true if Length bytes can be read at Position.
+  bool Contains(TOffset Position, size_t Length) const
+  {
+    // A position before the window wraps around and fails the test
+    TOffset RelPos = Position - m_Offset;
+    return RelPos <= m_Size && Length <= m_Size - RelPos;
+  }
+
+protected:
+  BinaryStream const* m_pBinStrm;
+  u8 const*           m_pBytes;
+  TOffset             m_Offset;
+  u32                 m_Size;
+};
+
+//! EndianFetchWindow reads from a FetchWindow, the swap is resolved at compile time.
+template<EEndianness Endianness>
+class EndianFetchWindow : public FetchWindow
+{
+public:
+  explicit EndianFetchWindow(FetchWindow const& rWnd) : FetchWindow(rWnd) {}
+
+  //! This method reads according to the size of rData and performs a swap if needed.
+  template<typename T>
+  bool Read(TOffset Position, T& rData) const
+  {
+    static_assert(boost::is_arithmetic<T>::value, "only scalar types can be read");
+
+    if (Contains(Position, sizeof(T)))
+      memcpy(&rData, m_pBytes + (Position - m_Offset), sizeof(T));
+    else if (m_pBinStrm == nullptr || !m_pBinStrm->Read(Position, &rData, sizeof(T)))
+      return false;
+
+    if (Endianness != MEDUSA_HOST_ENDIANNESS)
+      EndianSwap(rData);
+    return true;
+  }
+
+  template<typename T, size_t N>
+  bool Read(TOffset Position, T (&rData)[N]) const
+  {
+    for (size_t i = 0; i < N; ++i)
+    {
+      if (Read(Position, rData[i]) == false)
+        return false;
+      Position += sizeof(T);
+    }
+    return true;
+  }
+};
+
 MEDUSA_NAMESPACE_END
 
 #endif // _MEDUSA_BINARY_STREAM_
\ No newline at end of file
@@ -2,11 +2,13 @@
 #define _MEDUSA_CELL_
 
 #include <list>
+#include <vector>
 #include <string>
 #include <forward_list>
 #include <memory>
 
 #include <medusa/cell_data.hpp>
+#include <medusa/pool.hpp>
 
 #ifdef _MSC_VER
 # pragma warning(disable: 4251)
@@ -31,7 +33,8 @@ public:
   class Mark
   {
   public:
-    typedef std::list<Mark> List;
+    typedef std::list<Mark>   List;
+    typedef std::vector<Mark> Vector;
 
     enum Type
     {
@@ -70,7 +73,7 @@ public:
     u16 Size = 0x0
     )
   {
-    m_spDna = std::make_shared<CellData>(Type, SubType, Size);
+    m_spDna = MakePooled<CellData>(Type, SubType, Size);
   }
 
   Cell(CellData::SPtr spDna) : m_spDna(spDna) {}
@@ -0,0 +1,80 @@
+#ifndef _MEDUSA_CELL_TEXT_
+#define _MEDUSA_CELL_TEXT_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/cell.hpp"
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4251)
+#endif
+
+MEDUSA_NAMESPACE_BEGIN
+
+class Address;
+class Label;
+
+/*! CellText receives the text representation of a cell and its marks.
+ * The caller owns it and reuses it from one cell to another, Clear keeps the
+ * capacity so formatting a line doesn't allocate once the buffer is warmed up.
+ */
+class Medusa_EXPORT CellText
+{
+public:
+  CellText(void);
+
+  //! This method empties the text and the marks without releasing the memory.
+  void Clear(void) { m_Text.clear(); m_Marks.clear(); }
+
+  std::string        const& GetText(void)   const { return m_Text;          }
+  Cell::Mark::Vector const& GetMarks(void)  const { return m_Marks;         }
+  size_t                    GetLength(void) const { return m_Text.length(); }
+
+  //! This method writes a text without any mark.
+  void Write(char const* pText, size_t Length) { m_Text.append(pText, Length); }
+  void Write(char const* pText)                { Write(pText, strlen(pText)); }
+  void Write(std::string const& rText)         { Write(rText.c_str(), rText.length()); }
+  void Write(char Char)                        { m_Text.push_back(Char); }
+
+  /*! This method writes Value in lowercase hexadecimal without prefix.
+   * \param MinDigitNo is the minimum number of digits, the value is padded with zeros.
+   * \return Returns the number of written characters.
+   */
+  size_t WriteHex(u64 Value, u8 MinDigitNo = 0);
+
+  //! This method writes Value in decimal, it works like WriteHex.
+  size_t WriteDecimal(u64 Value, u8 MinDigitNo = 0);
+
+  //! This method writes an address like Address::ToString and returns the number of written characters.
+  size_t WriteAddress(Address const& rAddr);
+
+  //! This method writes a label like Label::GetLabel and returns the number of written characters.
+  size_t WriteLabel(Label const& rLbl);
+
+  //! This method adds a mark which covers the last Length characters.
+  void Mark(u16 Type, size_t Length) { m_Marks.push_back(Cell::Mark(static_cast<Cell::Mark::Type>(Type), Length)); }
+
+  //! These methods write a text and add its mark.
+  void Append(u16 Type, char const* pText, size_t Length) { Write(pText, Length); Mark(Type, Length); }
+  void Append(u16 Type, char const* pText)                { Append(Type, pText, strlen(pText)); }
+  void Append(u16 Type, std::string const& rText)         { Append(Type, rText.c_str(), rText.length()); }
+
+  //! This method writes "0x" followed by Value and marks both as an immediate.
+  void AppendHex(u64 Value, u8 MinDigitNo = 0) { Write("0x", 2); Mark(Cell::Mark::ImmediateType, WriteHex(Value, MinDigitNo) + 2); }
+
+  //! This method copies the text and the marks, it's used by the API based on std::string and Cell::Mark::List.
+  void CopyTo(std::string& rText, Cell::Mark::List& rMarks) const;
+
+private:
+  std::string        m_Text;
+  Cell::Mark::Vector m_Marks;
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_CELL_TEXT_
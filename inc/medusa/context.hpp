@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <functional>
 
 MEDUSA_NAMESPACE_BEGIN
@@ -85,6 +86,13 @@ protected:
   MemoryChunkSet m_Memories;
 };
 
+/*!
+ * VariableContext holds the temporary variables used by semantics.
+ *
+ * Variable names are interned once into dense slots shared by the whole
+ * process, expressions keep the slot and the context stores its variables in
+ * an array indexed by slot. Names are only needed to display variables.
+ */
 class Medusa_EXPORT VariableContext
 {
 public:
@@ -98,12 +106,30 @@ public:
     Var64Bit   = 64,
   };
 
-  virtual bool ReadVariable(std::string const& rVariableName, u64& rValue) const;
-  virtual bool WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend = false);
-  virtual void* GetVariable(std::string const& rVariableName);
+  //! This method returns the slot of rVariableName, a new slot is created the first time a name is seen.
+  static u32 GetVariableSlot(std::string const& rVariableName);
+  //! This method returns the name of the variable stored in Slot.
+  static std::string const& GetVariableName(u32 Slot);
 
-  virtual bool AllocateVariable(u32 Type, std::string const& rVariableName);
-  virtual bool FreeVariable(std::string const& rVariableName);
+  virtual ~VariableContext(void) {}
+
+  virtual bool ReadVariable(u32 Slot, u64& rValue) const;
+  virtual bool WriteVariable(u32 Slot, u64 Value, bool SignExtend = false);
+  virtual void* GetVariable(u32 Slot);
+
+  virtual bool AllocateVariable(u32 Type, u32 Slot);
+  virtual bool FreeVariable(u32 Slot);
+
+  bool ReadVariable(std::string const& rVariableName, u64& rValue) const
+  { return ReadVariable(GetVariableSlot(rVariableName), rValue); }
+  bool WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend = false)
+  { return WriteVariable(GetVariableSlot(rVariableName), Value, SignExtend); }
+  void* GetVariable(std::string const& rVariableName)
+  { return GetVariable(GetVariableSlot(rVariableName)); }
+  bool AllocateVariable(u32 Type, std::string const& rVariableName)
+  { return AllocateVariable(Type, GetVariableSlot(rVariableName)); }
+  bool FreeVariable(std::string const& rVariableName)
+  { return FreeVariable(GetVariableSlot(rVariableName)); }
 
   virtual std::string ToString(void) const;
 
@@ -132,8 +158,9 @@ protected:
 
     u32 GetSizeInBit(void) const { return m_Type; }
   };
-  typedef std::unordered_map<std::string, VariableInformation> VariableMap;
-  VariableMap m_Variables;
+  //! A slot which is not allocated holds a VarUnknown variable
+  typedef std::vector<VariableInformation> VariableVector;
+  VariableVector m_Variables;
 };
 
 MEDUSA_NAMESPACE_END
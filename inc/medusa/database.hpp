@@ -78,6 +78,9 @@ public:
 
   virtual bool HasCrossReferenceTo(Address const& rFrom) const = 0;
   virtual bool GetCrossReferenceTo(Address const& rFrom, Address& rTo) const = 0;
+  virtual bool GetCrossReferenceTo(Address const& rFrom, Address::List& rToList) const = 0;
+
+  virtual bool CompactCrossReferences(void) = 0;
 
   // MultiCell
   virtual bool AddMultiCell(Address const& rAddress, MultiCell const& rMultiCell) = 0;
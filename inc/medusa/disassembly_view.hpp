@@ -8,6 +8,7 @@
 #include "medusa/medusa.hpp"
 #include "medusa/view.hpp"
 #include "medusa/printer.hpp"
+#include "medusa/mutex.hpp"
 
 #include <map>
 #include <set>
@@ -28,7 +29,7 @@ public:
   void GetDimension(u32& rWidth, u32& rHeight) const;
 
 protected:
-  typedef boost::mutex MutexType;
+  typedef ProfiledMutex<boost::mutex> MutexType;
 
   void          _Prepare(void);
 
@@ -68,7 +69,7 @@ public:
   Address          GetSelectionLastAddress(void)  const { return m_SelectionEnd.m_Address;   }
 
 protected:
-  typedef boost::mutex MutexType;
+  typedef ProfiledMutex<boost::mutex> MutexType;
 
   struct TextPosition
   {
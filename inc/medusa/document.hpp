@@ -14,7 +14,11 @@
 #include "medusa/database.hpp"
 
 #include <set>
+#include <map>
 #include <boost/bimap.hpp>
+#include <boost/shared_ptr.hpp>
+#include "medusa/mutex.hpp"
+
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread.hpp>
@@ -22,6 +26,8 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
+class Architecture;
+
 //! Document handles cell, multicell, xref, label and memory area.
 class Medusa_EXPORT Document
 {
@@ -89,6 +95,7 @@ public:
     virtual void OnTaskUpdated(std::string const& rTaskName, u8 Status) {}
   };
 
+   Document(void);
   ~Document(void);
 
   // Database
@@ -99,6 +106,16 @@ public:
                                 //! This method remove all memory areas.
   void                          RemoveAll(void);
 
+  // Architecture
+
+                                /*! This method makes an architecture available for this document.
+                                 * \param spArch gets an identifier, the first registered architecture is the default one.
+                                 */
+  bool                          RegisterArchitecture(boost::shared_ptr<Architecture> spArch);
+
+                                //! This method returns the architecture registered with ArchTag, MEDUSA_ARCH_UNK means the default one.
+  boost::shared_ptr<Architecture> GetArchitecture(Tag ArchTag) const;
+
   // Subscriber
 
   void                          Connect(u32 Type, Subscriber* pSubscriber);
@@ -147,6 +164,10 @@ public:
 
   bool                          HasCrossReferenceTo(Address const& rFrom) const;
   bool                          GetCrossReferenceTo(Address const& rFrom, Address& rTo) const;
+  bool                          GetCrossReferenceTo(Address const& rFrom, Address::List& rToList) const;
+
+                                //! This method should be called once the analysis settles, it makes cross-references lookup faster.
+  bool                          CompactCrossReferences(void);
 
   // Comment
   bool                          GetComment(Address const& rAddress, std::string& rComment) const;
@@ -241,12 +262,19 @@ public:
 private:
   void RemoveLabelIfNeeded(Address const& rAddr);
 
-  typedef boost::mutex MutexType;
+  typedef ProfiledMutex<boost::mutex> MutexType;
+
+  typedef std::map<Tag, boost::shared_ptr<Architecture>> ArchitectureMapType;
 
   Database::SharedPtr                     m_spDatabase;
   MultiCell::Map                          m_MultiCells;
   mutable MutexType                       m_CellMutex;
 
+  u32                                     m_ArchIdPool;
+  Tag                                     m_DefaultArchitectureTag;
+  ArchitectureMapType                     m_TaggedArchitectures;
+  mutable MutexType                       m_ArchitectureMutex;
+
   Subscriber::QuitSignalType              m_QuitSignal;
   Subscriber::DocumentUpdatedSignalType   m_DocumentUpdatedSignal;
   Subscriber::MemoryAreaUpdatedSignalType m_MemoryAreaUpdatedSignal;
@@ -4,7 +4,7 @@
 #include "medusa/namespace.hpp"
 #include "medusa/types.hpp"
 #include "medusa/export.hpp"
-#include <boost/detail/endian.hpp>
+#include <boost/predef/other/endian.h>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -15,6 +15,15 @@ enum EEndianness
   BigEndian
 };
 
+//! This macro is the endianness of the host, it can be used when the endianness must be known at compile time.
+#if BOOST_ENDIAN_LITTLE_BYTE
+# define MEDUSA_HOST_ENDIANNESS ::medusa::LittleEndian
+#elif BOOST_ENDIAN_BIG_BYTE
+# define MEDUSA_HOST_ENDIANNESS ::medusa::BigEndian
+#else
+# error Unable to determine the current endianness
+#endif
+
 //! This function returns true if a swap if needed, otherwise it returns false.
 Medusa_EXPORT bool TestEndian(EEndianness Endianness);
 
@@ -6,6 +6,7 @@
 #include "medusa/event_handler.hpp"
 
 #include <queue>
+#include <boost/noncopyable.hpp>
 #include <boost/thread.hpp>
 
 MEDUSA_NAMESPACE_BEGIN
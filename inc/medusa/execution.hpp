@@ -10,6 +10,7 @@
 #include "medusa/os.hpp"
 #include "medusa/context.hpp"
 #include "medusa/emulation.hpp"
+#include "medusa/expression.hpp"
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -32,6 +33,7 @@ private:
   MemoryContext*             m_pMemCtxt;
   CpuInformation const*      m_pCpuInfo;
   Emulator::SharedPtr        m_spEmul;
+  ExpressionArena            m_SemArena; //! This arena holds the semantic of the block being executed
 };
 
 MEDUSA_NAMESPACE_END
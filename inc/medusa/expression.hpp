@@ -9,16 +9,70 @@
 #include "medusa/context.hpp"
 
 #include <list>
+#include <vector>
 
 MEDUSA_NAMESPACE_BEGIN
 
 class ExpressionVisitor;
 
+/*!
+ * ExpressionArena is a region which receives the expressions built while one
+ * of its Scope is alive on the current thread.
+ *
+ * Deleting an expression from an arena runs its destructor without releasing
+ * memory, Reset releases all of them at once and keeps the chunks for the next
+ * trees. Every expression of the arena must be deleted before Reset.
+ */
+class Medusa_EXPORT ExpressionArena
+{
+public:
+  //! Scope redirects the allocations of expressions to an arena until it's destroyed, nullptr means the heap
+  class Medusa_EXPORT Scope
+  {
+  public:
+    Scope(ExpressionArena* pArena);
+    ~Scope(void);
+
+  private:
+    ExpressionArena* m_pPrevArena;
+
+    Scope(Scope const&);
+    Scope& operator=(Scope const&);
+  };
+
+  ExpressionArena(size_t ChunkSize = 0x4000);
+  ~ExpressionArena(void);
+
+  void*  Allocate(size_t Size);
+  void   Reset(void);
+
+  //! This method returns the number of bytes used since the last reset.
+  size_t GetUsedSize(void) const { return m_UsedSize; }
+
+  //! This method returns the arena which receives the expressions of the current thread, or nullptr.
+  static ExpressionArena* GetCurrent(void);
+
+private:
+  std::vector<u8*> m_Chunks;
+  size_t           m_ChunkSize;
+  size_t           m_ChunkNo;
+  u8*              m_pCur;
+  u8*              m_pEnd;
+  size_t           m_UsedSize;
+
+  ExpressionArena(ExpressionArena const&);
+  ExpressionArena& operator=(ExpressionArena const&);
+};
+
 class Medusa_EXPORT Expression
 {
 public:
   virtual ~Expression(void) {}
 
+  //! Expressions are allocated from the current ExpressionArena if any, otherwise from the heap
+  static void* operator new(size_t Size);
+  static void  operator delete(void* pExpr);
+
   typedef std::list<Expression *> List;
   virtual std::string ToString(void) const = 0;
   virtual Expression *Clone(void) const = 0;
@@ -49,7 +103,7 @@ public:
   virtual Expression* VisitConstant       (u32 Type, u64 Value)                                                                                                         { return nullptr; }
   virtual Expression* VisitIdentifier     (u32 Id, CpuInformation const* pCpuInfo)                                                                                      { return nullptr; }
   virtual Expression* VisitMemory         (u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)                                 { return nullptr; }
-  virtual Expression* VisitVariable       (u32 SizeInBit, std::string const& rName)                                                                                     { return nullptr; }
+  virtual Expression* VisitVariable       (u32 SizeInBit, u32 Slot)                                                                                                     { return nullptr; }
 };
 
 class Medusa_EXPORT ExpressionVisitor_FindOperation : public ExpressionVisitor
@@ -322,24 +376,30 @@ private:
 class Medusa_EXPORT VariableExpression : public ContextExpression
 {
 public:
+  //! The name is interned here, the expression only keeps its slot (see VariableContext::GetVariableSlot)
   VariableExpression(u32 Type, std::string const& rName)
-    : m_Type(Type), m_Name(rName) {}
+    : m_Type(Type), m_Slot(VariableContext::GetVariableSlot(rName)) {}
+  VariableExpression(u32 Type, u32 Slot)
+    : m_Type(Type), m_Slot(Slot) {}
 
   virtual ~VariableExpression(void) {}
 
   virtual std::string ToString(void) const;
   virtual Expression* Clone(void) const;
   virtual u32 GetSizeInBit(void) const;
-  virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitVariable(m_Type, m_Name); }
+  virtual Expression* Visit(ExpressionVisitor* pVisitor) const { return pVisitor->VisitVariable(m_Type, m_Slot); }
   virtual bool SignExtend(u32 NewSizeInBit) { return false; }
 
   virtual bool Read(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, u64& rValue, bool SignExtend = false) const;
   virtual bool Write(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, u64 Value, bool SignExtend = false);
   virtual bool GetAddress(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, Address& rAddress) const;
 
+  u32                GetSlot(void) const { return m_Slot; }
+  std::string const& GetName(void) const { return VariableContext::GetVariableName(m_Slot); }
+
 private:
-  std::string m_Name;
   u32 m_Type;
+  u32 m_Slot;
 };
 
 
@@ -0,0 +1,114 @@
+#ifndef _MEDUSA_EXPRESSION_DAG_
+#define _MEDUSA_EXPRESSION_DAG_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/expression.hpp"
+
+#include <vector>
+#include <unordered_set>
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4251)
+#endif
+
+MEDUSA_NAMESPACE_BEGIN
+
+/*!
+ * ExpressionDag stores expressions as hash-consed immutable nodes.
+ *
+ * Interning an expression returns the id of its node, structurally identical
+ * expressions always get the same id, so comparing two interned expressions
+ * only compares their ids. Ids are dense and start at 0: a pass can memoize its
+ * result per node in a vector of GetNumberOfNodes() entries. Nodes are never
+ * removed, Materialize builds back a tree which can be given to an emulator.
+ */
+class Medusa_EXPORT ExpressionDag
+{
+public:
+  typedef u32 Id;
+  typedef std::vector<Id> IdVector;
+
+  enum { InvalidId = 0xffffffff };
+
+  enum Kind
+  {
+    BindKind,
+    ConditionKind,
+    IfConditionKind,
+    IfElseConditionKind,
+    WhileConditionKind,
+    OperationKind,
+    ConstantKind,
+    IdentifierKind,
+    MemoryKind,
+    VariableKind
+  };
+
+  //! Node is the immutable representation of an expression, its operands are node ids.
+  struct Node
+  {
+    u64 m_Hash;        /*! This integer holds the hash of the node, operands included         */
+    u64 m_Value;       /*! This integer holds the constant, the register id or the variable slot */
+    Id  m_Operands[4]; /*! This array holds operand ids, bind uses the first two as a range    */
+    u32 m_Type;        /*! This integer holds the operation, condition or constant type, or a size */
+    u8  m_Kind;        /*! This integer holds the kind of expression (OperationKind, ...)        */
+    u8  m_Flags;       /*! This integer holds the dereference flag of a memory node            */
+    u16 m_CpuInfoIdx;  /*! This integer holds the index of the CpuInformation of an identifier */
+  };
+
+  ExpressionDag(void);
+
+  //! This method interns pExpr and returns the id of its node, or InvalidId if pExpr is nullptr.
+  Id                Intern(Expression const* pExpr);
+  //! This method interns each expression of rExprList and appends their ids to rIds.
+  void              Intern(Expression::List const& rExprList, IdVector& rIds);
+
+  Node const&       GetNode(Id NodeId) const { return m_Nodes[NodeId]; }
+  u32               GetNumberOfNodes(void) const { return static_cast<u32>(m_Nodes.size()); }
+
+  //! This method returns the operands of a bind node.
+  IdVector          GetBindOperands(Id NodeId) const;
+
+  //! This method builds a new expression tree from a node, the caller owns it.
+  Expression*       Materialize(Id NodeId) const;
+
+  //! This method returns an estimation of the memory used by the nodes and their indexes in bytes.
+  size_t            GetMemoryUsage(void) const;
+
+private:
+  class Interner;
+
+  Id                _Insert(Node& rNode);
+  Id                _InternBind(IdVector const& rOperands);
+  u16               _InternCpuInformation(CpuInformation const* pCpuInfo);
+
+  struct NodeHasher
+  {
+    NodeHasher(std::vector<Node> const& rNodes) : m_rNodes(rNodes) {}
+    size_t operator()(Id NodeId) const { return static_cast<size_t>(m_rNodes[NodeId].m_Hash); }
+    std::vector<Node> const& m_rNodes;
+  };
+
+  struct NodeEqual
+  {
+    NodeEqual(ExpressionDag const& rDag) : m_rDag(rDag) {}
+    bool operator()(Id LeftId, Id RightId) const;
+    ExpressionDag const& m_rDag;
+  };
+
+  typedef std::unordered_set<Id, NodeHasher, NodeEqual> NodeSet;
+
+  std::vector<Node>                  m_Nodes;
+  IdVector                           m_BindOperands;
+  std::vector<CpuInformation const*> m_CpuInfos;
+  NodeSet                            m_NodeSet;
+
+  ExpressionDag(ExpressionDag const&);
+  ExpressionDag& operator=(ExpressionDag const&);
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_EXPRESSION_DAG_
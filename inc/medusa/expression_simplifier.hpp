@@ -0,0 +1,58 @@
+#ifndef _MEDUSA_EXPRESSION_SIMPLIFIER_
+#define _MEDUSA_EXPRESSION_SIMPLIFIER_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+#include "medusa/expression.hpp"
+#include "medusa/expression_dag.hpp"
+
+#include <unordered_map>
+
+MEDUSA_NAMESPACE_BEGIN
+
+/*!
+ * ExpressionSimplifier rewrites a semantic into a smaller one which gives the
+ * same result once interpreted.
+ *
+ * It folds operations and conditions on constants, removes neutral operands
+ * (x + 0, x >> 0, x & mask wider than x, ...) and conditions between identical
+ * operands. A temporary variable assigned once with a constant is replaced by
+ * its value, temporaries which are never read are removed and consecutive
+ * masks applied to the same register are merged.
+ *
+ * Temporary variables are considered local to the list being simplified: the
+ * list must allocate them before use, like the semantics built by architectures.
+ */
+class Medusa_EXPORT ExpressionSimplifier
+{
+public:
+  ExpressionSimplifier(void);
+
+  //! This method replaces each expression of rExprList by its simplified form, the replaced expressions are deleted.
+  void        Simplify(Expression::List& rExprList);
+
+  //! This method returns a simplified copy of pExpr, or nullptr if pExpr has no effect.
+  Expression* Simplify(Expression const* pExpr);
+
+private:
+  class Folder;
+  class UseCollector;
+
+  typedef std::unordered_map<u32, u64> ValueMap;
+  typedef std::unordered_map<u32, u32> TypeMap;
+
+  bool _IsSameExpression(Expression const* pLeftExpr, Expression const* pRightExpr);
+  void _RemoveDeadVariables(Expression::List& rExprList, TypeMap const& rVarTypes);
+  void _MergeRegisterMasks(Expression::List& rExprList);
+
+  ExpressionDag m_Dag;       /*! This DAG is only used to compare operands */
+  ValueMap      m_KnownVars; /*! This map holds the value of the temporaries assigned with a constant */
+
+  ExpressionSimplifier(ExpressionSimplifier const&);
+  ExpressionSimplifier& operator=(ExpressionSimplifier const&);
+};
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_EXPRESSION_SIMPLIFIER_
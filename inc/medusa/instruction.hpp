@@ -10,6 +10,9 @@
 #include "medusa/expression.hpp"
 
 #include <cstring>
+#include <atomic>
+#include <vector>
+#include <type_traits>
 
 #ifdef _MSC_VER
 # pragma warning(disable: 4251)
@@ -22,6 +25,8 @@ MEDUSA_NAMESPACE_BEGIN
 
 #define OPERAND_NO  4
 
+class Architecture;
+
 //! Instruction is a Cell which handles an instruction for any Architecture.
 class Medusa_EXPORT Instruction : public Cell
 {
@@ -71,6 +76,8 @@ public:
     , m_ClearedFlags()
     , m_FixedFlags()
     , m_Expressions()
+    , m_pSemArch(nullptr)
+    , m_SemId()
   {
     m_spDna->Length() = Length;
   }
@@ -85,10 +92,15 @@ public:
     , m_ClearedFlags()
     , m_FixedFlags()
     , m_Expressions()
+    , m_pSemArch(nullptr)
+    , m_SemId()
   {}
 
   ~Instruction(void);
 
+  //! This method restores the state of a newly constructed instruction without releasing its memory.
+  void                    Reset(void);
+
   char const*             GetName(void) const         { return m_pName;           }
 
   void                    SetName(char const* pName)  { m_pName = pName;          }
@@ -102,6 +114,15 @@ public:
   void                    AddPreSemantic(Expression* pExpr);
   void                    AddPostSemantic(Expression* pExpr);
 
+  /*! This method defers the semantic of this instruction
+   * \param pArch must outlive this instruction, its BuildSemantic method is called with
+   * SemanticId the first time the semantic is requested.
+   */
+  void                    SetSemanticBuilder(Architecture* pArch, u32 SemanticId);
+
+  //! This method replaces the semantic by its simplified form, see ExpressionSimplifier.
+  void                    SimplifySemantic(void);
+
   medusa::Operand*        Operand(unsigned int Oprd)
   { return Oprd > OPERAND_NO ? nullptr : &m_Oprd[Oprd];                           }
   medusa::Operand const*  Operand(unsigned int Oprd) const
@@ -125,7 +146,12 @@ public:
   u32                     GetUpdatedFlags(void) const { return m_UpdatedFlags;    }
   u32                     GetClearedFlags(void) const { return m_ClearedFlags;    }
   u32                     GetFixedFlags(void) const   { return m_FixedFlags;      }
-  Expression::List const& GetSemantic(void) const     { return m_Expressions;     }
+  Expression::List const& GetSemantic(void) const
+  {
+    if (m_pSemArch.load(std::memory_order_acquire) != nullptr)
+      _BuildSemantic();
+    return m_Expressions;
+  }
 
   /*! This method gives the offset of a specified operand
    * \param Oprd The operand number between 0 (included) and OPERAND_NO (excluded).
@@ -147,12 +173,33 @@ private:
   u32                     m_ClearedFlags;     /*! This integer holds flags that are unset by the instruction          */
   u32                     m_FixedFlags;       /*! This integer holds flags that are set by the instruction            */
   Expression::List        m_Expressions;      /*! This list contains semantic for this instruction if not empty       */
+  mutable std::atomic<Architecture*> m_pSemArch; /*! This pointer holds the architecture which builds the semantic      */
+  u32                     m_SemId;            /*! This integer holds the id of the deferred semantic                  */
 
 private:
+  void                    _BuildSemantic(void) const;
+
   Instruction(Instruction const&);
   Instruction& operator=(Instruction const&);
   };
 
+/*! InstructionRecord is a compact and fixed-size summary of an Instruction.
+ * It contains no pointer, so large arrays of records can be filled and copied cheaply.
+ */
+struct InstructionRecord
+{
+  typedef std::vector<InstructionRecord> Vector;
+
+  TOffset m_Offset;                 /*! This integer holds the offset of the instruction in its binary stream  */
+  u64     m_Value;                  /*! This integer holds the value of the first operand                       */
+  u32     m_Opcode;                 /*! This integer holds the instruction id (ARM_Ldr, GB_Swap, ...)           */
+  u32     m_OprdType[OPERAND_NO];   /*! This array holds the type of each operand (O_REG, O_IMM, ...)           */
+  u16     m_Length;                 /*! This integer holds the length of the instruction                        */
+  u8      m_SubType;                /*! This integer holds the control flow kind (JumpType, CallType, ...)      */
+};
+
+static_assert(std::is_pod<InstructionRecord>::value, "InstructionRecord must stay a POD");
+
 MEDUSA_NAMESPACE_END
 
 #endif // _MEDUSA_INSTRUCTION_
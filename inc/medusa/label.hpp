@@ -47,6 +47,9 @@ public:
   void        SetType(u16 Type) { m_Type = Type; }
   std::string GetLabel(void) const;
 
+  //! This method appends the label to rLabel, it doesn't allocate if rLabel has enough capacity.
+  void        AppendLabel(std::string& rLabel) const;
+
   void IncrementVersion(void);
 
   bool IsAutoGenerated(void) const;
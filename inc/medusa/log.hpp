@@ -10,78 +10,136 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include <atomic>
 #include <boost/function.hpp>
-#include <boost/thread/recursive_mutex.hpp>
-#include <boost/thread/locks.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/type_traits.hpp>
 
+// Messages below this level are removed at compile time when written with MEDUSA_LOG
+#ifndef MEDUSA_LOG_LEVEL
+# define MEDUSA_LOG_LEVEL 0
+#endif
+
+//! Unlike Log::Write, operands are not evaluated when the level is disabled.
+#define MEDUSA_LOG(Lvl, Type)                           \
+  if (!::medusa::Log::IsEnabled(::medusa::Log::Lvl))    \
+    ;                                                   \
+  else                                                  \
+    ::medusa::Log::Write(Type, ::medusa::Log::Lvl)
+
 #ifdef _MSC_VER
 # pragma warning(disable: 4251 4275)
 #endif
 
 MEDUSA_NAMESPACE_BEGIN
 
-class Medusa_EXPORT LogWrapper
+class LogWrapper;
+
+/*!
+ * Log allows core or modules to log information.
+ *
+ * Messages are pushed into a ring owned by the calling thread and a
+ * background thread hands them to the logger callback, so logging never
+ * waits for the console or the user interface. If a ring is full, the
+ * message is dropped and counted instead of blocking the caller.
+ */
+class Medusa_EXPORT Log : boost::noncopyable
 {
 public:
   typedef boost::function<void(std::string const&)> LoggerCallback;
+
+  enum Level
+  {
+    Debug,    //! Verbose information, e.g. each analyzed function or emulated instruction.
+    Info,     //! Default level.
+    Warning,
+    Error,
+    Disabled  //! Nothing is logged.
+  };
+
+  static void SetLog(LoggerCallback pLog);
+
+  //! This method sets the minimal level of messages written at runtime, MEDUSA_LOG_LEVEL is the compile-time one.
+  static void  SetLevel(Level Lvl)        { m_Level.store(Lvl, std::memory_order_relaxed);        }
+  static Level GetLevel(void)             { return m_Level.load(std::memory_order_relaxed);       }
+  static bool  IsEnabled(Level Lvl)       { return Lvl >= MEDUSA_LOG_LEVEL && Lvl >= m_Level.load(std::memory_order_relaxed); }
+
+  static LogWrapper Write(std::string const& rType, Level Lvl = Info);
+
+  //! This method waits until every message written before the call is handed to the logger callback.
+  static void Flush(void);
+
+  //! This method returns the number of messages dropped because a ring was full.
+  static u64 GetNumberOfDroppedMessages(void);
+
+private:
+  Log(void);
+  ~Log(void);
+
+  static std::atomic<Level> m_Level;
+};
+
+class Medusa_EXPORT LogWrapper
+{
+public:
+  typedef Log::LoggerCallback LoggerCallback;
   typedef LogWrapper& (*LoggerFunction)(LogWrapper&);
 
-  LogWrapper(LoggerCallback pLog, std::string Name, std::string& rBuffer)
-    : m_pLog(pLog)
-    , m_Name(Name)
+  LogWrapper(std::string const& rName, std::string& rBuffer, bool Enabled)
+    : m_Name(rName)
     , m_rBuffer(rBuffer)
+    , m_Enabled(Enabled)
   {
-    if (m_rBuffer.empty())
+    if (m_Enabled && m_rBuffer.empty())
     {
-      m_rBuffer  = Name;
+      m_rBuffer  = rName;
       m_rBuffer += ": ";
     }
   }
 
   template<typename T> LogWrapper& operator<<(T Value)
   {
-    std::ostringstream oss;
-
-    if (boost::is_arithmetic<T>::value)
-      oss << std::hex << std::internal << std::showbase << std::setfill('0') << std::setw(sizeof(Value) * 2 + 2) << Value;
-    else
-      oss << Value;
-    m_rBuffer += oss.str();
+    if (!m_Enabled)
+      return *this;
 
+    // Integers are written in hexadecimal, bytes keep the stream behavior
+    _Format(Value, boost::integral_constant<bool,
+      boost::is_integral<T>::value && (sizeof(T) > 1) && !boost::is_same<T, bool>::value>());
     return *this;
   }
 
-  LogWrapper& Flush(void)
-  {
-    if (m_pLog)
-    {
-      boost::recursive_mutex::scoped_lock(m_Mutex);
-      m_pLog(m_rBuffer);
-      m_rBuffer = m_Name;
-      m_rBuffer += ": ";
-    }
-    return *this;
-  }
+  LogWrapper& Flush(void);
 
   std::string& GetBuffer(void) { return m_rBuffer;  }
-  void Write(char const* pMsg) { m_rBuffer += pMsg; }
-  void Lock(void)              { m_Mutex.lock();    }
-  void Unlock(void)            { m_Mutex.unlock();  }
+  void Write(char const* pMsg) { if (m_Enabled) m_rBuffer += pMsg; }
 
 private:
-  static std::string StringToWString(std::string const& rString);
+  template<typename T> void _Format(T Value, boost::true_type)
+  {
+    _AppendHex(static_cast<u64>(static_cast<typename boost::make_unsigned<T>::type>(Value)), sizeof(Value) * 2);
+  }
+
+  template<typename T> void _Format(T const& rValue, boost::false_type)
+  {
+    std::ostringstream oss;
+
+    if (boost::is_arithmetic<T>::value)
+      oss << std::hex << std::internal << std::showbase << std::setfill('0') << std::setw(sizeof(rValue) * 2 + 2) << rValue;
+    else
+      oss << rValue;
+    m_rBuffer += oss.str();
+  }
 
-  typedef boost::recursive_mutex MutexType;
+  void _AppendHex(u64 Value, u8 DigitNo);
 
-  LoggerCallback   m_pLog;
-  std::string      m_Name;
-  std::string&     m_rBuffer;
-  static MutexType m_Mutex;
+  std::string  m_Name;
+  std::string& m_rBuffer;
+  bool         m_Enabled;
 };
 
 template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(s16 Value);
 template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(u16 Value);
+template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(char const* pMsg);
 template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(Address Addr);
 template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(std::string Msg);
 template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(LogWrapper::LoggerFunction pFunc);
@@ -89,25 +147,6 @@ template<> Medusa_EXPORT LogWrapper& LogWrapper::operator<<(LogWrapper::LoggerFu
 Medusa_EXPORT LogWrapper& LogFlush(LogWrapper& rLogWrapper);
 Medusa_EXPORT LogWrapper& LogEnd(LogWrapper& rLogWrapper);
 
-//! this class allows core or modules to log information
-class Medusa_EXPORT Log : boost::noncopyable
-{
-public:
-  static void SetLog(LogWrapper::LoggerCallback pLog)
-  { m_pLog = pLog; }
-
-  static LogWrapper Write(std::string const& rType);
-
-private:
-  Log(void);
-  ~Log(void);
-
-  typedef std::map<std::string, std::string> LogMap;
-
-  static LogMap                     m_LogMap;
-  static LogWrapper::LoggerCallback m_pLog;
-};
-
 MEDUSA_NAMESPACE_END
 
 #endif // !__MEDUSA_LOG__
\ No newline at end of file
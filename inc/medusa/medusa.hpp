@@ -80,6 +80,9 @@ public:
   Document&                       GetDocument(void)       { return m_Document; }
   Document const&                 GetDocument(void) const { return m_Document; }
 
+                                  //! This method returns the analyzer used by this instance.
+  Analyzer&                       GetAnalyzer(void)       { return m_Analyzer; }
+
                                   /*! This method starts the analyze.
                                    * \param spArch is the selected Architecture.
                                    * \param rAddr is the start address of disassembling.
@@ -95,6 +98,10 @@ public:
 
   Cell::SPtr                      GetCell(Address const& rAddr);
   Cell::SPtr const                GetCell(Address const& rAddr) const;
+  bool FormatCell(
+    Address       const& rAddress,
+    Cell          const& rCell,
+    CellText           & rText) const;
   bool FormatCell(
     Address       const& rAddress,
     Cell          const& rCell,
@@ -132,7 +139,7 @@ private:
 
   Analyzer                         m_Analyzer;
 
-  typedef boost::mutex             MutexType;
+  typedef ProfiledMutex<boost::mutex> MutexType;
   mutable MutexType                m_Mutex;
 };
 
@@ -8,6 +8,7 @@
 #include "medusa/binary_stream.hpp"
 #include "medusa/types.hpp"
 #include "medusa/address.hpp"
+#include "medusa/mutex.hpp"
 
 #include <string>
 #include <vector>
@@ -106,6 +107,7 @@ public:
     : MemoryArea(rName, Access, DefaultArchitectureTag, DefaultArchitectureMode)
     , m_FileOffset(FileOffset), m_FileSize(FileSize)
     , m_VirtualBase(rVirtualBase), m_VirtualSize(VirtualSize)
+    , m_Mutex("memory_area")
   {}
 
   virtual ~MappedMemoryArea(void);
@@ -144,7 +146,7 @@ protected:
   u32                m_VirtualSize;
   CellDataVectorType m_Cells;
 
-  typedef boost::mutex    MutexType;
+  typedef ProfiledMutex<boost::mutex> MutexType;
   mutable MutexType       m_Mutex;
 };
 
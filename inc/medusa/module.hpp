@@ -9,7 +9,13 @@
 
 #include "medusa/exception.hpp"
 #include "medusa/export.hpp"
+#include "medusa/mutex.hpp"
 #include <map>
+#include <set>
+#include <vector>
+#include <string>
+
+#include <boost/thread/mutex.hpp>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -52,10 +58,18 @@ private:
   TModuleMap m_ModuleMap;
 };
 
+/*!
+ * ModuleManager is the registry of modules, it's shared by the whole process.
+ *
+ * A module directory is scanned only once, then the registry only keeps
+ * factories. Getters create new module objects on each call, so each
+ * document owns its loader, architectures, operating system and database
+ * and several documents can be analyzed concurrently.
+ */
 class Medusa_EXPORT ModuleManager
 {
 private:
-  ModuleManager(void) : m_ArchIdPool(0x0), m_DefaultArchitectureTag(MEDUSA_ARCH_UNK) {}
+  ModuleManager(void) : m_Mutex("module_manager") {}
   ~ModuleManager(void) {}
   ModuleManager(ModuleManager const&);
   ModuleManager& operator=(ModuleManager const&);
@@ -70,38 +84,32 @@ public:
     return ModMgr;
   }
 
-  void LoadDatabases(boost::filesystem::path const& rModPath); // TODO: since we can't afford to have binstrm, we should change this method name
-  void LoadModules(boost::filesystem::path const& rModPath, BinaryStream const& rBinStrm);
+  //! This method loads modules from rModPath, it does nothing if this directory has already been loaded.
+  void LoadModules(boost::filesystem::path const& rModPath);
   void UnloadModules(void);
 
   // Architecture
-  Architecture::SharedPtr       GetArchitecture(Tag ArchTag) const;
+  Architecture::VectorSharedPtr GetArchitectures(void) const;
   Architecture::SharedPtr       FindArchitecture(Tag ArchTag) const;
-  bool                          RegisterArchitecture(Architecture::SharedPtr spArch);
-  bool                          UnregisterArchitecture(Architecture::SharedPtr spArch);
-  void                          ResetArchitecture(void);
 
-  TGetEmulator                  GetEmulator(std::string const& rEmulatorName);
+  TGetEmulator                  GetEmulator(std::string const& rEmulatorName) const;
   OperatingSystem::SharedPtr    GetOperatingSystem(Loader::SharedPtr spLdr, Architecture::SharedPtr spArch) const;
-  Database::SharedPtr           GetDatabase(std::string const& rDatabaseName);
+  Database::SharedPtr           GetDatabase(std::string const& rDatabaseName) const;
   Database::VectorSharedPtr     GetDatabases(void) const;
 
-  Loader::VectorSharedPtr       GetLoaders(void) const;
-  Architecture::VectorSharedPtr GetArchitectures(void) const;
+  //! This method returns loaders which are able to handle rBinStrm, the deepest first.
+  Loader::VectorSharedPtr       GetLoaders(BinaryStream const& rBinStrm) const;
 
 private:
-  typedef boost::mutex MutexType;
-  MutexType                        m_Mutex;
-
-  u32                              m_ArchIdPool;
-  Tag                              m_DefaultArchitectureTag;
-  Architecture::TagMap             m_TaggedArchitectures;
-
-  Loader::VectorSharedPtr          m_Loaders;
-  Architecture::VectorSharedPtr    m_Architectures;
-  Database::VectorSharedPtr        m_Databases;
-  OperatingSystem::VectorSharedPtr m_OperatingSystems;
-  EmulatorMap                      m_Emulators;
+  typedef ProfiledMutex<boost::mutex> MutexType;
+  mutable MutexType                 m_Mutex;
+
+  std::set<std::string>             m_LoadedPaths;
+  std::vector<TGetLoader>           m_Loaders;
+  std::vector<TGetArchitecture>     m_Architectures;
+  std::vector<TGetDabatase>         m_Databases;
+  std::vector<TGetOperatingSystem>  m_OperatingSystems;
+  EmulatorMap                       m_Emulators;
 };
 
 MEDUSA_NAMESPACE_END
@@ -0,0 +1,172 @@
+#ifndef _MEDUSA_MUTEX_
+#define _MEDUSA_MUTEX_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+#include <boost/thread/locks.hpp>
+
+#ifdef _MSC_VER
+# pragma warning(disable: 4251)
+#endif
+
+MEDUSA_NAMESPACE_BEGIN
+
+//! Counters shared by all locks with the same name, durations are in nanoseconds
+struct Medusa_EXPORT LockCounters
+{
+  LockCounters(void);
+
+  std::atomic<u64> m_AcquisitionNo;
+  std::atomic<u64> m_ContendedNo;
+  std::atomic<u64> m_TotalWait;
+  std::atomic<u64> m_MaxWait;
+  std::atomic<u64> m_TotalHold;
+  std::atomic<u64> m_MaxHold;
+};
+
+/*!
+ * LockProfiler gathers the statistics of every ProfiledMutex.
+ *
+ * Statistics are only recorded when Medusa is built with MEDUSA_PROFILE_LOCKS,
+ * otherwise GetStatistics always returns an empty vector.
+ */
+class Medusa_EXPORT LockProfiler
+{
+public:
+  struct Statistics
+  {
+    std::string m_Name;
+    u64         m_AcquisitionNo;
+    u64         m_ContendedNo;
+    u64         m_TotalWait;
+    u64         m_MaxWait;
+    u64         m_TotalHold;
+    u64         m_MaxHold;
+  };
+  typedef std::vector<Statistics> StatisticsVector;
+
+  //! Return true if Medusa was built with lock profiling
+  static bool             IsEnabled(void);
+
+  //! Return the counters for a lock name, the reference stays valid until exit
+  static LockCounters&    GetCounters(char const* pName);
+
+  //! Return a snapshot of all counters sorted by total wait time
+  static StatisticsVector GetStatistics(void);
+
+  //! Reset all counters to zero
+  static void             Reset(void);
+};
+
+#ifdef MEDUSA_PROFILE_LOCKS
+
+/*!
+ * ProfiledMutex wraps a lockable type and records acquisitions, contended
+ * acquisitions, wait time and hold time under a lock name.
+ *
+ * Recursive mutexes are supported: the hold time is measured from the
+ * first lock to the last unlock.
+ */
+template<typename MutexT>
+class ProfiledMutex
+{
+public:
+  typedef boost::unique_lock<ProfiledMutex> scoped_lock;
+
+  explicit ProfiledMutex(char const* pName)
+    : m_rCounters(LockProfiler::GetCounters(pName)), m_Depth(0) {}
+
+  void lock(void)
+  {
+    if (m_Mutex.try_lock())
+    {
+      _Acquired(0, false);
+      return;
+    }
+
+    auto Start = ClockType::now();
+    m_Mutex.lock();
+    _Acquired(_ElapsedSince(Start), true);
+  }
+
+  bool try_lock(void)
+  {
+    if (!m_Mutex.try_lock())
+      return false;
+    _Acquired(0, false);
+    return true;
+  }
+
+  void unlock(void)
+  {
+    if (--m_Depth == 0)
+    {
+      u64 Hold = _ElapsedSince(m_AcquiredAt);
+      m_rCounters.m_TotalHold.fetch_add(Hold, std::memory_order_relaxed);
+      _UpdateMax(m_rCounters.m_MaxHold, Hold);
+    }
+    m_Mutex.unlock();
+  }
+
+private:
+  ProfiledMutex(ProfiledMutex const&);
+  ProfiledMutex& operator=(ProfiledMutex const&);
+
+  typedef std::chrono::steady_clock ClockType;
+
+  static u64 _ElapsedSince(ClockType::time_point Start)
+  {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(ClockType::now() - Start).count());
+  }
+
+  static void _UpdateMax(std::atomic<u64>& rMax, u64 Value)
+  {
+    u64 CurMax = rMax.load(std::memory_order_relaxed);
+    while (Value > CurMax && !rMax.compare_exchange_weak(CurMax, Value, std::memory_order_relaxed))
+      ;
+  }
+
+  // m_Depth and m_AcquiredAt are only touched by the owner of the lock
+  void _Acquired(u64 Wait, bool Contended)
+  {
+    m_rCounters.m_AcquisitionNo.fetch_add(1, std::memory_order_relaxed);
+    if (Contended)
+    {
+      m_rCounters.m_ContendedNo.fetch_add(1, std::memory_order_relaxed);
+      m_rCounters.m_TotalWait.fetch_add(Wait, std::memory_order_relaxed);
+      _UpdateMax(m_rCounters.m_MaxWait, Wait);
+    }
+    if (m_Depth++ == 0)
+      m_AcquiredAt = ClockType::now();
+  }
+
+  MutexT                m_Mutex;
+  LockCounters&         m_rCounters;
+  u32                   m_Depth;
+  ClockType::time_point m_AcquiredAt;
+};
+
+#else
+
+//! Without MEDUSA_PROFILE_LOCKS, ProfiledMutex is the wrapped type and the name is ignored
+template<typename MutexT>
+class ProfiledMutex : public MutexT
+{
+public:
+  typedef boost::unique_lock<ProfiledMutex> scoped_lock;
+
+  explicit ProfiledMutex(char const*) {}
+};
+
+#endif
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_MUTEX_
@@ -131,6 +131,17 @@ public:
 }
   ~Operand(void) {}
 
+  //! This method restores the state of a newly constructed operand, the name keeps its buffer.
+  void Reset(void)
+  {
+    m_Type = O_NONE;
+    m_Name.clear();
+    m_Offset = 0;
+    m_Reg = m_SecReg = m_Seg = 0;
+    m_Value = 0;
+    m_SegValue = 0;
+  }
+
   u32&        Type(void)                         { return m_Type;            }
   u16&        Reg(void)                          { return m_Reg;             }
   u16&        SecReg(void)                       { return m_SecReg;          }
@@ -138,7 +149,7 @@ public:
   u64&        Value(void)                        { return m_Value;           }
   u16&        SegValue(void)                     { return m_SegValue;        }
 
-  std::string GetName(void)     const            { return m_Name;            }
+  std::string const& GetName(void) const         { return m_Name;            }
   u8          GetOffset(void)   const            { return m_Offset;          }
   u32         GetType(void)     const            { return m_Type;            }
   u16         GetReg(void)      const            { return m_Reg;             }
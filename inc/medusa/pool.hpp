@@ -0,0 +1,86 @@
+#ifndef _MEDUSA_POOL_
+#define _MEDUSA_POOL_
+
+#include "medusa/namespace.hpp"
+#include "medusa/export.hpp"
+#include "medusa/types.hpp"
+
+#include <new>
+#include <memory>
+#include <utility>
+
+MEDUSA_NAMESPACE_BEGIN
+
+/*!
+ * MemoryPool hands out small fixed-size blocks carved from slabs.
+ *
+ * Blocks are sorted by size class, each thread keeps its own free lists and
+ * exchanges batches of blocks with a shared depot, so allocating and releasing
+ * a block usually takes no lock and no call to malloc. A freed block is
+ * recycled by the next allocation of the same size class, whatever the thread.
+ * Slabs are never given back, the pool keeps the peak of used memory.
+ */
+class Medusa_EXPORT MemoryPool
+{
+public:
+  //! Blocks bigger than this size are directly allocated with operator new
+  enum { MaxBlockSize = 0x200 };
+
+  static void* Allocate(size_t Size);
+  static void  Free(void* pBlock, size_t Size);
+
+  //! This method returns the number of slabs allocated since the start.
+  static u64   GetNumberOfSlabs(void);
+};
+
+//! PoolAllocator is a standard allocator on top of MemoryPool, it's mostly used with std::allocate_shared.
+template<typename Type>
+class PoolAllocator
+{
+public:
+  typedef Type      value_type;
+  typedef Type*     pointer;
+  typedef Type const* const_pointer;
+  typedef Type&     reference;
+  typedef Type const& const_reference;
+  typedef size_t    size_type;
+  typedef ptrdiff_t difference_type;
+
+  template<typename OtherType> struct rebind { typedef PoolAllocator<OtherType> other; };
+
+  PoolAllocator(void) {}
+  template<typename OtherType> PoolAllocator(PoolAllocator<OtherType> const&) {}
+
+  Type* allocate(size_t Number)
+  { return static_cast<Type*>(MemoryPool::Allocate(Number * sizeof(Type))); }
+  void  deallocate(Type* pObject, size_t Number)
+  { MemoryPool::Free(pObject, Number * sizeof(Type)); }
+
+  template<typename OtherType, typename... Args>
+  void construct(OtherType* pObject, Args&&... rArgs)
+  { ::new(static_cast<void*>(pObject)) OtherType(std::forward<Args>(rArgs)...); }
+  template<typename OtherType>
+  void destroy(OtherType* pObject)
+  { pObject->~OtherType(); }
+
+  size_t max_size(void) const { return static_cast<size_t>(-1) / sizeof(Type); }
+};
+
+template<typename Type, typename OtherType>
+bool operator==(PoolAllocator<Type> const&, PoolAllocator<OtherType> const&) { return true;  }
+template<typename Type, typename OtherType>
+bool operator!=(PoolAllocator<Type> const&, PoolAllocator<OtherType> const&) { return false; }
+
+/*! This function works like std::make_shared, but the object and its reference
+ * counter share one block from MemoryPool. The returned pointer can be kept as
+ * long as needed, the block goes back to the pool with the last reference.
+ */
+template<typename Type, typename... Args>
+std::shared_ptr<Type> MakePooled(Args&&... rArgs)
+{
+  return std::allocate_shared<Type>(PoolAllocator<Type>(), std::forward<Args>(rArgs)...);
+}
+
+MEDUSA_NAMESPACE_END
+
+#endif // !_MEDUSA_POOL_
@@ -36,6 +36,9 @@ protected:
   virtual u32 PrintEmpty     (Address const& rAddress, u32 xOffset, u32 yOffset) { return 0; }
 
   Medusa const& m_rCore;
+
+  //! The text of the last formatted cell, it's kept to reuse its memory.
+  mutable CellText m_CellText;
 };
 
 class Medusa_EXPORT StreamPrinter : public Printer
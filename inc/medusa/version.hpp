@@ -0,0 +1,14 @@
+#ifndef __MEDUSA_VERSION_HPP__
+#define __MEDUSA_VERSION_HPP__
+
+namespace Version
+{
+  enum
+  {
+    Major = 0,
+    Minor = 4,
+    Patch = 0
+  };
+}
+
+#endif // !__MEDUSA_VERSION_HPP__
@@ -7,8 +7,9 @@
 #include "medusa/address.hpp"
 
 #include <list>
-#include <boost/bimap.hpp>
-#include <boost/bimap/multiset_of.hpp>
+#include <vector>
+#include <functional>
+#include <unordered_map>
 
 #ifdef _MSC_VER
 # pragma warning(disable: 4251)
@@ -16,30 +17,39 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
-//! XRefs handles a cross-reference.
+/*!
+ * XRefs handles cross-references.
+ *
+ * New cross-references are first stored in a pending area which is cheap to
+ * update while the analysis is running. Compact moves them into two
+ * compressed-sparse-row indexes (to→froms and from→tos) which share a sorted
+ * address table, so a settled document costs two u32 per cross-reference.
+ * A source address can reference several targets (indirect jumps, tables...).
+ */
 class Medusa_EXPORT XRefs
 {
 public:
-   XRefs(void) {}
+   XRefs(void);
   ~XRefs(void) {}
 
-  typedef boost::bimap<
-    boost::bimaps::multiset_of<Address>,
-    Address
-  > TXRefs;
+  typedef u32 AddressId;
+  typedef std::unordered_multimap<Address, Address> TPendingXRefs;
 
   //! Add new cross-reference
   bool AddXRef(Address const& rTo, Address const& rFrom);
 
-  //! Remove a cross-reference
+  //! Remove all cross-references from a specific address
   bool RemoveRef(Address const& rFrom);
 
   //! Get all addresses which access to a specific address
   bool From(Address const& rTo, Address::List& rFromList) const;
 
-  //! Get accessed address from a specific address
+  //! Get the first accessed address from a specific address
   bool To(Address const& rFrom, Address& rTo) const;
 
+  //! Get all accessed addresses from a specific address
+  bool To(Address const& rFrom, Address::List& rToList) const;
+
   //! Test if a specific address has a cross-reference
   bool HasXRefTo(Address const& rFrom) const;
 
@@ -49,13 +59,40 @@ public:
   //! Erase all cross-references
   void EraseAll(void);
 
-  //! Get all cross-references
-  TXRefs const& GetAllXRefs(void) const { return m_XRefs; }
+  //! Move pending cross-references into the compact indexes
+  void Compact(void);
+
+  //! Call XRefPredicat for each target with all its sources, ordered by target
+  void ForEachXRef(std::function<void (Address const& rTo, Address::List const& rFromList)> XRefPredicat);
+
+  //! Get the number of cross-references
+  size_t GetSize(void) const;
+
+  //! Get the number of bytes used to hold cross-references
+  size_t GetMemoryUsage(void) const;
 
 private:
-  TXRefs m_XRefs;
+  bool _GetAddressId(Address const& rAddr, AddressId& rId) const;
+  void _BuildBuckets(void);
+  bool _HasCompactedXRef(Address const& rTo, Address const& rFrom) const;
+  bool _HasPendingXRef(Address const& rTo, Address const& rFrom) const;
+
+  // Compact area
+  Address::Vector        m_Addresses;   //! sorted, unique
+  std::vector<u32>       m_ToOffsets;   //! m_Addresses.size() + 1 entries, index m_FromIds
+  std::vector<AddressId> m_FromIds;
+  std::vector<u32>       m_FromOffsets; //! m_Addresses.size() + 1 entries, index m_ToIds
+  std::vector<AddressId> m_ToIds;
+  std::vector<u32>       m_Buckets;     //! first address index for each range of offsets
+  u8                     m_BucketShift;
+  std::vector<bool>      m_Removed;     //! sources removed since the last compaction
+  size_t                 m_RemovedCount;
+
+  // Pending area
+  TPendingXRefs          m_PendingFrom; //! to → from
+  TPendingXRefs          m_PendingTo;   //! from → to
 };
 
 MEDUSA_NAMESPACE_END
 
-#endif // !_MEDUSA_XREF_
\ No newline at end of file
+#endif // !_MEDUSA_XREF_
@@ -5,6 +5,7 @@ import ast
 import sys
 import yaml
 import time
+import copy
 import string
 import itertools
 from compiler.ast import flatten
@@ -68,10 +69,83 @@ class ArchConvertion:
         res += '}\n'
         return res
 
+    # entries is a list of (mask, value, statement) where the first matching entry wins,
+    # it generates nested switches on contiguous bit fields of var to reach each entry
+    def _GenerateDecisionTree(self, var, entries, default, known_mask = 0x0, bits = 32, leaf_size = 4):
+        def Compatible(entry, field, key):
+            return (entry[0] & field & (key ^ entry[1])) == 0
+
+        def Leaf(entries, known_mask):
+            res = ''
+            for mask, value, statm in entries:
+                if (mask & ~known_mask) == 0:
+                    return res + statm + '\n'
+                res += self._GenerateCondition('if', '(%s & %#010x) == %#010x' % (var, mask, value), statm)
+            return res + default + '\n'
+
+        if len(entries) <= leaf_size:
+            return Leaf(entries, known_mask)
+
+        # Pick the field which gives the smallest buckets, entries with don't care bits
+        # in the field are duplicated in several buckets so this duplication is bounded
+        best = None
+        constraints = {}
+        for mask, value, statm in entries:
+            constraints[(mask, value & mask)] = constraints.get((mask, value & mask), 0) + 1
+        for shift in range(bits):
+            for width in range(1, 9):
+                field = ((1 << width) - 1) << shift
+                if shift + width > bits or (field & known_mask) != 0:
+                    break
+                counts = [0] * (1 << width)
+                for (mask, value), entry_no in constraints.items():
+                    for key in range(1 << width):
+                        if Compatible((mask, value), field, key << shift):
+                            counts[key] += entry_no
+                score = (max(counts), sum(counts))
+                if score[0] >= len(entries) or score[1] > len(entries) * 3 / 2:
+                    continue
+                if best == None or score < best[0]:
+                    best = (score, shift, width)
+
+        if best == None:
+            return Leaf(entries, known_mask)
+
+        score, shift, width = best
+        field = ((1 << width) - 1) << shift
+        buckets = []
+        for key in range(1 << width):
+            bucket = [e for e in entries if Compatible(e, field, key << shift)]
+            if len(bucket) == 0:
+                continue
+            for b in buckets:
+                if b[1] == bucket:
+                    b[0].append(key)
+                    break
+            else:
+                buckets.append(([key], bucket))
+
+        res = 'switch ((%s >> %d) & %#x)\n' % (var, shift, (1 << width) - 1)
+        res += '{\n'
+        for keys, bucket in buckets:
+            for key in keys:
+                res += 'case %#04x:\n' % key
+            res += Indent(self._GenerateBrace(self._GenerateDecisionTree(var, bucket, default, known_mask | field, bits, leaf_size)))
+        res += 'default:\n'
+        res += Indent(default + '\n')
+        res += '}\n'
+        return res
+
     def _GenerateRead(self, var_name, addr, sz):
-        return 'u%d %s;\nif (!rBinStrm.Read(%s, %s))\n  return false;\n\n' % (sz, var_name, addr, var_name)
+        return 'u%d %s;\nif (!rWnd.Read(%s, %s))\n  return false;\n\n' % (sz, var_name, addr, var_name)
 
     def _ConvertSemanticToCode(self, opcd, sem, id_mapper):
+        res = self._ConvertSemanticToStatements(opcd, sem, id_mapper)
+        if len(res) == 0:
+            return ''
+        return self._GenerateBrace(res)
+
+    def _ConvertSemanticToStatements(self, opcd, sem, id_mapper):
         class SemVisitor(ast.NodeVisitor):
             def __init__(self, id_mapper):
                 ast.NodeVisitor.__init__(self)
@@ -359,7 +433,7 @@ class ArchConvertion:
         var = 'Expression::List AllExpr;\n'
         res += 'rInsn.SetSemantic(AllExpr);\n'
 
-        return self._GenerateBrace(var + res)
+        return var + res
 
     def GenerateHeader(self):
         pass
@@ -379,18 +453,38 @@ class ArchConvertion:
     def GenerateOperandCode(self):
         pass
 
+    def GenerateSemanticDefinition(self):
+        return ''
+
+    def GenerateSemanticCode(self):
+        return ''
+
+    def GenerateLengthDefinition(self):
+        return ''
+
+    def GenerateLengthCode(self):
+        return ''
+
 class X86ArchConvertion(ArchConvertion):
     def __init__(self, arch):
         ArchConvertion.__init__(self, arch)
         self.all_mnemo = set()
         self.all_oprd = set()
         self.all_dec = set()
+        self.all_sem = []
+
+        # The decoder generation overrides the operands of group entries, the
+        # length rules walk their own copy of the description the same way
+        self.len_arch = copy.deepcopy(arch)
+        self.len_tables = []
+        self.len_groups = []
+        self.len_rules = None
 
     # Architecture dependant methods
     def __X86_GenerateMethodName(self, type_name, opcd_no, in_class = False):
-        meth_fmt = 'bool %s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)'
+        meth_fmt = 'template<u8 Mode> bool %s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)'
         if in_class == False:
-            meth_fmt = 'bool %sArchitecture::%%s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)' % self.arch['arch_info']['name'].capitalize()
+            meth_fmt = 'template<u8 Mode>\nbool %sArchitecture::%%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)' % self.arch['arch_info']['name'].capitalize()
 
         if opcd_no == None:
             return meth_fmt % 'Invalid'
@@ -516,7 +610,7 @@ class X86ArchConvertion(ArchConvertion):
             res += 'rInsn.Length()++;\n'
             if 'mnemonic' in opcd:
                 res += 'rInsn.Prefix() |= X86_Prefix_%s;\n' % opcd['mnemonic']
-            res += 'return Disassemble(rBinStrm, Offset + %d, rInsn, Mode);\n' % (pfx_n - 1)
+            res += 'return Disassemble<Mode>(rWnd, Offset + %d, rInsn);\n' % (pfx_n - 1)
             return res
 
         if 'suffix' in opcd:
@@ -567,10 +661,15 @@ class X86ArchConvertion(ArchConvertion):
                 'r8':'X86_Reg_R8', 'r9':'X86_Reg_R9', 'r10':'X86_Reg_R10', 'r11':'X86_Reg_R11',
                 'r12':'X86_Reg_R12', 'r13':'X86_Reg_R13', 'r14':'X86_Reg_R14', 'r15':'X86_Reg_R15' }
 
+        # Semantics are built by a separate method, so the decoder can defer them
         if 'semantic' in opcd:
-            res += self._ConvertSemanticToCode(opcd, opcd['semantic'], id_mapper)
+            sem = self._ConvertSemanticToStatements(opcd, opcd['semantic'], id_mapper)
         else:
-            res += self._ConvertSemanticToCode(opcd, None, id_mapper)
+            sem = self._ConvertSemanticToStatements(opcd, None, id_mapper)
+        if len(sem) != 0:
+            if not sem in self.all_sem:
+                self.all_sem.append(sem)
+            res += 'ApplySemantic(rInsn, %#x);\n' % self.all_sem.index(sem)
         res += 'return true;\n'
         return res
 
@@ -629,7 +728,7 @@ class X86ArchConvertion(ArchConvertion):
         return ' && '.join(cond)
 
     def __X86_GenerateOperandMethod(self, oprd):
-        res = 'Operand__%s(rBinStrm, Offset, rInsn, Mode)' % '_'.join(oprd)
+        res = 'Operand__%s<Mode>(rWnd, Offset, rInsn)' % '_'.join(oprd)
         self.all_oprd.add('_'.join(oprd))
         return res
 
@@ -643,8 +742,8 @@ class X86ArchConvertion(ArchConvertion):
         if ref.startswith('table_'):
             res += self._GenerateRead('Opcode', 'Offset', 8)
             res += 'rInsn.Length()++;\n'
-            res += self._GenerateCondition('if', 'Opcode + 1 > sizeof(m_%s)' % ref.capitalize(), 'return false;')
-            res += 'return (this->*m_%s[Opcode%s])(rBinStrm, Offset + 1, rInsn, Mode);\n' % (ref.capitalize(), tbl_off)
+            res += self._GenerateCondition('if', 'Opcode + 1 > sizeof(ModeTable<Mode>::m_%s)' % ref.capitalize(), 'return false;')
+            res += 'return (this->*ModeTable<Mode>::m_%s[Opcode%s])(rWnd, Offset + 1, rInsn);\n' % (ref.capitalize(), tbl_off)
 
         elif ref.startswith('group_'):
             grp = self.arch['insn']['group'][ref]
@@ -696,13 +795,20 @@ class X86ArchConvertion(ArchConvertion):
         res = ''
 
         res += 'private:\n'
-        res += Indent('typedef bool (%sArchitecture:: *TDisassembler)(BinaryStream const&, TOffset, Instruction&, u8);\n' % self.arch['arch_info']['name'].capitalize())
+        res += Indent('typedef bool (%sArchitecture:: *TDisassembler)(FetchWindowType const&, TOffset, Instruction&);\n\n' % self.arch['arch_info']['name'].capitalize())
+
+        # Handlers are instantiated for each mode, so are the tables which refer to them
+        tbl = ''
+        for name in sorted(self.arch['insn']['table']):
+            if 'FP' in name:  opcd_no = 0xc0
+            else:             opcd_no = 0x00
+            tbl += 'static const TDisassembler m_%s[%#x];\n' % (name.capitalize(), 0x100 - opcd_no)
+        res += Indent('template<u8 Mode> struct ModeTable\n' + self._GenerateBrace(tbl)[:-1] + ';\n\n')
 
         for name in sorted(self.arch['insn']['table']):
             if 'FP' in name:  opcd_no = 0xc0
             else:             opcd_no = 0x00
 
-            res += Indent('static const TDisassembler m_%s[%#x];\n' % (name.capitalize(), 0x100 - opcd_no))
             for opcd in self.arch['insn']['table'][name]:
                 res += Indent('%s;\n' % self.__X86_GenerateMethodName(name, opcd_no, True))
                 opcd_no += 1
@@ -718,15 +824,28 @@ class X86ArchConvertion(ArchConvertion):
             if 'FP' in name:  opcd_no = 0xc0
             else:             opcd_no = 0x00
 
-            res += 'const %sArchitecture::TDisassembler %sArchitecture::m_%s[%#x] =\n' % (arch_name, arch_name, name.capitalize(), 0x100 - opcd_no)
+            res += 'template<u8 Mode>\n'
+            res += 'const %sArchitecture::TDisassembler %sArchitecture::ModeTable<Mode>::m_%s[%#x] =\n' % (arch_name, arch_name, name.capitalize(), 0x100 - opcd_no)
             res += '{\n'
             tbl_elm = []
             for opcd in self.arch['insn']['table'][name]:
-                tbl_elm.append(Indent('&%sArchitecture::%s_%02x\n' % (arch_name, name.capitalize(), opcd_no))[:-1])
+                tbl_elm.append(Indent('&%sArchitecture::%s_%02x<Mode>\n' % (arch_name, name.capitalize(), opcd_no))[:-1])
                 opcd_no += 1
             res += ',\n'.join(tbl_elm)
             res += '\n};\n\n'
 
+        # The entry point is the only specialization used outside of this file
+        res += '// Prefixes are decoded recursively, they share the window of the instruction\n'
+        res += 'template<u8 Mode>\n'
+        res += 'bool %sArchitecture::Disassemble(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)\n' % arch_name
+        res += self._GenerateBrace(
+                self._GenerateRead('Opcode', 'Offset', 8) +
+                'return (this->*ModeTable<Mode>::m_Table_1[Opcode])(rWnd, Offset + 1, rInsn);\n')
+        res += '\n'
+        for mode in [ 'X86_Bit_16', 'X86_Bit_32', 'X86_Bit_64' ]:
+            res += 'template bool %sArchitecture::Disassemble<%s>(FetchWindowType const&, TOffset, Instruction&);\n' % (arch_name, mode)
+        res += '\n'
+
         for name in sorted(self.arch['insn']['table']):
             if 'FP' in name: opcd_no = 0xc0
             else:            opcd_no = 0x00
@@ -752,14 +871,39 @@ class X86ArchConvertion(ArchConvertion):
         res = ''
         for oprd in self.all_oprd:
             if oprd == '': continue
-            res += Indent('bool Operand__%s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);\n' % oprd)
+            res += Indent('template<u8 Mode> bool Operand__%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);\n' % oprd)
+        return res
+
+    def GenerateSemanticDefinition(self):
+        res = ''
+        res += 'typedef bool (%sArchitecture:: *TSemantic)(Instruction&);\n' % self.arch['arch_info']['name'].capitalize()
+        res += 'static const TSemantic m_Semantic[%#x];\n' % len(self.all_sem)
+        for sem_no in range(len(self.all_sem)):
+            res += 'bool Semantic_%02x(Instruction& rInsn);\n' % sem_no
+        return Indent(res)
+
+    def GenerateSemanticCode(self):
+        res = ''
+        arch_name = self.arch['arch_info']['name'].capitalize()
+
+        res += 'const %sArchitecture::TSemantic %sArchitecture::m_Semantic[%#x] =\n' % (arch_name, arch_name, len(self.all_sem))
+        res += '{\n'
+        res += ',\n'.join([Indent('&%sArchitecture::Semantic_%02x' % (arch_name, sem_no)) for sem_no in range(len(self.all_sem))])
+        res += '\n};\n\n'
+
+        for sem_no in range(len(self.all_sem)):
+            res += 'bool %sArchitecture::Semantic_%02x(Instruction& rInsn)\n' % (arch_name, sem_no)
+            res += self._GenerateBrace(self.all_sem[sem_no] + 'return true;\n')
+            res += '\n'
+
         return res
 
     def GenerateOperandCode(self):
         res = ''
         for oprd in self.all_oprd:
             if oprd == '': continue
-            res += 'bool %sArchitecture::Operand__%s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)\n' % (self.arch['arch_info']['name'].capitalize(), oprd)
+            res += 'template<u8 Mode>\n'
+            res += 'bool %sArchitecture::Operand__%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)\n' % (self.arch['arch_info']['name'].capitalize(), oprd)
             dec_op = []
             op_no = 0
             oprd = oprd.split('_')
@@ -777,12 +921,12 @@ class X86ArchConvertion(ArchConvertion):
 
                     for o in oprd:
                         if o[0] == 'I' and (oprd[0][0] == 'E' or (len(oprd) > 1 and oprd[1][0] == 'E')):
-                            ei_hack += self._GenerateCondition('if', '!Decode_%s(rBinStrm, Offset + (rInsn.GetLength() - PrefixOpcodeLength), rInsn, rInsn.Operand(%d), Mode)' % (o, op_no),\
+                            ei_hack += self._GenerateCondition('if', '!Decode_%s<Mode>(rWnd, Offset + (rInsn.GetLength() - PrefixOpcodeLength), rInsn, rInsn.Operand(%d))' % (o, op_no),\
                                     'return false;')
                         else:
-                            ei_hack += self._GenerateCondition('if', '!Decode_%s(rBinStrm, Offset, rInsn, rInsn.Operand(%d), Mode)' % (o, op_no),\
+                            ei_hack += self._GenerateCondition('if', '!Decode_%s<Mode>(rWnd, Offset, rInsn, rInsn.Operand(%d))' % (o, op_no),\
                                     'return false;')
-                        self.all_dec.add('Decode_%s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)' % o)
+                        self.all_dec.add('Decode_%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)' % o)
                         op_no += 1
 
                     ei_hack += seg
@@ -794,12 +938,280 @@ class X86ArchConvertion(ArchConvertion):
                 continue
 
             for o in oprd:
-                dec_op.append('Decode_%s(rBinStrm, Offset, rInsn, rInsn.Operand(%d), Mode)' % (o, op_no))
+                dec_op.append('Decode_%s<Mode>(rWnd, Offset, rInsn, rInsn.Operand(%d))' % (o, op_no))
                 op_no += 1
-                self.all_dec.add('Decode_%s(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)' % o)
+                self.all_dec.add('Decode_%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)' % o)
             res += self._GenerateBrace('bool Res =\n' + Indent(' &&\n'.join(dec_op) + ';\n') + seg + 'return Res;\n')
         return res
 
+    # Length rules, they follow the decoder generation step by step
+    def __X86_LengthRule(self, kind, cond = None):
+        rule = { 'kind':kind, 'modes':0x7, 'test':0, 'byte':0, 'vendor':'0', 'arg':[0, 0], 'length':0, 'sub_type':[], 'prefix':'0', 'oprd':[] }
+        if cond != None:
+            rule['modes'], rule['test'], rule['byte'], rule['vendor'] = cond
+        return rule
+
+    def __X86_LengthOperand(self, oprd):
+        conv_oprd = {
+                'ModRm':['Eb', 'Ed', 'Ev', 'Ew', 'Ey', 'Qd', 'Qq', 'Wo', 'Wx'],
+                'ModRmReg':['Nq', 'Rv', 'Ry', 'Uo', 'Uq', 'Ux'],
+                'Mem':['M', 'Mw', 'm16int', 'm32fp', 'm32int', 'm64fp', 'm64int', 'm80bcd', 'm80dec', 'm80fp'],
+                'Mem32':['My'],
+                'Ib':['Ib', 'Ibs', 'Jb'], 'Iw':['Iw'], 'Iz':['Iz'], 'Iv':['Iv'], 'Jz':['Jz'],
+                'Moffs':['Ob', 'Ov'], 'Ap':['Ap'],
+                'Invalid':['By', 'Edb', 'Eyb', 'Eyw', 'Ho', 'Hx', 'Hy', 'Lx', 'Ma', 'Md', 'Mo', 'Mod', 'Moq', 'Mp', 'Mq', 'Mqo', 'Mv', 'Mx',
+                    'Uod', 'Vod', 'Voq', 'Vy', 'Wd', 'Wob', 'Wod', 'Woo', 'Woq', 'Woqo', 'Wow', 'Wq', 'Wy', 'b', 'd', 'q', 'w', 'x'] }
+
+        res = []
+        for o in oprd:
+            kind = 'None'
+            for k, v in conv_oprd.items():
+                if o in v:
+                    kind = k
+            res.append('X86_LengthOprd_%s' % kind)
+
+        # A ModR/M byte must only be counted once
+        if len([x for x in oprd if x[0] in 'EMNQRUWm']) > 1 and not 'X86_LengthOprd_Invalid' in res:
+            raise Exception('Several ModR/M operands %s' % str(oprd))
+        return res
+
+    def __X86_LengthCondition(self, opcd):
+        # Each term is (modes, test, vendor, valid), they follow the order of __X86_GenerateInstructionCondition
+        terms = []
+
+        if 'cpu_model' in opcd:
+            # Only the latest architecture is available
+            res = False
+            for x in opcd['cpu_model'].split(','):
+                op, arch = x.split()
+                latest = arch == 'X86_Arch_Latest'
+                res = res or { '>=':True, '<=':latest, '==':latest, '>':not latest, '<':False, '!=':not latest }[op]
+            terms.append((0x7, 0, None, res))
+
+        if 'attr' in opcd:
+            for f in opcd['attr']:
+                if f == 'm64':
+                    terms.append((0x4, 0, None, True))
+                elif f == 'nm64':
+                    terms.append((0x3, 0, None, True))
+                elif f == 'a64':
+                    terms.append((0x4, 0x4, None, True))
+                elif f == 'na16':
+                    terms.append('na16')
+                elif f == 'rexb':
+                    terms.append((0x7, 0x10, None, True))
+                elif f == 'rexw':
+                    terms.append((0x7, 0x20, None, True))
+                elif f in [ 'ia64', 'amd', 'intel', 'cyrix', 'iit' ]:
+                    terms.append((0x7, 0x40, 'X86_ProcType_%s' % f.upper(), True))
+
+        if 'prefix' in opcd and 'suffix' in opcd:
+            raise Exception('Prefix and suffix conditions\n%s' % str(opcd))
+        if 'prefix' in opcd:
+            terms.append('prefix')
+        if 'suffix' in opcd:
+            terms.append('suffix')
+
+        if len(terms) == 0:
+            return None
+
+        # The na16 condition is not enclosed by parentheses, so it splits the generated condition in two
+        alts = [ terms ]
+        if 'na16' in terms:
+            na16 = terms.index('na16')
+            alts = [ terms[:na16] + [ (0x1, 0x8, None, True) ], [ (0x6, 0x4, None, True) ] + terms[na16 + 1:] ]
+
+        res = []
+        for alt in alts:
+            modes, test, vendor, valid = 0x7, 0, None, True
+            byte = [ 0 ]
+            for term in alt:
+                if term == 'prefix':
+                    test |= 0x1
+                    byte = opcd['prefix'] if type(opcd['prefix']) == list else [ opcd['prefix'] ]
+                elif term == 'suffix':
+                    test |= 0x2
+                    byte = [ opcd['suffix'] ]
+                else:
+                    if term[2] != None:
+                        if vendor != None and vendor != term[2]:
+                            valid = False
+                        vendor = term[2]
+                    modes &= term[0]
+                    test |= term[1]
+                    valid = valid and term[3]
+            if not valid or modes == 0:
+                continue
+            res += [ (modes, test, x, vendor or '0') for x in byte ]
+        return res
+
+    def __X86_LengthBody(self, opcd, cond):
+        if 'invalid' in opcd:
+            return self.__X86_LengthRule('Invalid', cond)
+
+        if 'constraint' in opcd and opcd['constraint'].startswith('pfx'):
+            rule = self.__X86_LengthRule('Prefix', cond)
+            rule['arg'][0] = int(opcd['constraint'][-1]) - 1
+            if 'mnemonic' in opcd:
+                rule['prefix'] = 'X86_Prefix_%s' % opcd['mnemonic']
+            return rule
+
+        rule = self.__X86_LengthRule('Instruction', cond)
+        rule['length'] = 2 if 'suffix' in opcd else 1
+        if 'constraint' in opcd and (opcd['constraint'] == 'd64' or opcd['constraint'] == 'df64'):
+            rule['prefix'] = 'X86_Prefix_REX_w'
+        conv_optype = { 'jmp':'Instruction::JumpType', 'call':'Instruction::CallType', 'ret':'Instruction::ReturnType', 'cond':'Instruction::ConditionalType' }
+        if 'operation_type' in opcd:
+            rule['sub_type'] = [ conv_optype[x] for x in opcd['operation_type'] ]
+        if 'operand' in opcd:
+            rule['oprd'] = self.__X86_LengthOperand(opcd['operand'])
+        return rule
+
+    def __X86_LengthFetch(self, opcd_arr):
+        test = 0
+        for opcd in opcd_arr:
+            if 'prefix' in opcd: test |= 0x1
+            if 'suffix' in opcd: test |= 0x2
+        if test == 0:
+            return []
+        rule = self.__X86_LengthRule('Fetch')
+        rule['test'] = test
+        return [ rule ]
+
+    def __X86_LengthInstruction(self, opcd):
+        if 'sub_opcodes' in opcd:
+            res = self.__X86_LengthFetch(opcd['sub_opcodes'])
+            for sub_opcd in reversed(opcd['sub_opcodes']):
+                if 'cpu_model' in sub_opcd or 'attr' in sub_opcd or 'prefix' in sub_opcd or 'suffix' in sub_opcd:
+                    cond = self.__X86_LengthCondition(sub_opcd)
+                    if cond == None:
+                        res.append(self.__X86_LengthBody(sub_opcd, None))
+                    else:
+                        res += [ self.__X86_LengthBody(sub_opcd, x) for x in cond ]
+                else:
+                    res += self.__X86_LengthInstruction(sub_opcd)
+                    break
+            return res
+
+        res = self.__X86_LengthFetch([ opcd ])
+        if 'reference' in opcd:
+            ref_oprd = None
+            if 'operand' in opcd:
+                ref_oprd = opcd['operand']
+            res.append(self.__X86_LengthReference(opcd['reference'], ref_oprd))
+            return res
+
+        if 'cpu_model' in opcd or 'attr' in opcd or 'prefix' in opcd or 'suffix' in opcd:
+            cond = self.__X86_LengthCondition(opcd)
+            if cond != None:
+                return res + [ self.__X86_LengthBody(opcd, x) for x in cond ]
+
+        res.append(self.__X86_LengthBody(opcd, None))
+        return res
+
+    def __X86_LengthReference(self, ref, oprd = None):
+        if ref.startswith('table_'):
+            rule = self.__X86_LengthRule('Table')
+            rule['arg'] = [ self.len_tables.index(ref), 0xc0 if ref.startswith('table_FP') else 0x00 ]
+            return rule
+
+        if ref.startswith('group_'):
+            chains = []
+            for opcd_g in self.len_arch['insn']['group'][ref]:
+                if oprd != None:
+                    opcd_g['operand'] = oprd
+                    chains.append(self.__X86_LengthInstruction(opcd_g))
+                elif 'invalid' in opcd_g:
+                    chains.append([ self.__X86_LengthRule('Invalid') ])
+                else:
+                    chains.append(self.__X86_LengthInstruction(opcd_g))
+            chains += [ [] ] * (8 - len(chains))
+
+            if not chains in self.len_groups:
+                self.len_groups.append(chains)
+            rule = self.__X86_LengthRule('Group')
+            rule['arg'][0] = self.len_groups.index(chains)
+            return rule
+
+        if ref.startswith('fpu'):
+            fpu_info = self.len_arch['insn']['fpu'][ref]
+            fpu_oprd = None
+            if 'operand' in fpu_info:
+                fpu_oprd = fpu_info['operand']
+            rule = self.__X86_LengthRule('Fpu')
+            rule['arg'] = [ self.__X86_LengthReference(fpu_info['group'], fpu_oprd)['arg'][0], self.len_tables.index(fpu_info['table']) ]
+            return rule
+
+        raise Exception('Unknown reference %s' % ref)
+
+    def __X86_GenerateLengthRules(self):
+        if self.len_rules != None:
+            return self.len_rules
+
+        self.len_tables = sorted(self.len_arch['insn']['table'])
+        self.len_groups = []
+        if self.len_tables[0] != 'table_1':
+            raise Exception('Length rules expect table_1 first')
+
+        chains = []
+        table_chains = []
+        for name in self.len_tables:
+            table_chains.append(len(chains))
+            for opcd in self.len_arch['insn']['table'][name]:
+                chains.append(self.__X86_LengthInstruction(opcd))
+
+        # Groups can be added while walking other groups
+        group_chains = []
+        group_no = 0
+        while group_no < len(self.len_groups):
+            group_chains.append(len(chains))
+            chains += self.len_groups[group_no]
+            group_no += 1
+
+        self.len_rules = (chains, table_chains, group_chains)
+        return self.len_rules
+
+    def GenerateLengthDefinition(self):
+        chains, table_chains, group_chains = self.__X86_GenerateLengthRules()
+        rule_no = sum(len(x) for x in chains)
+
+        res = ''
+        res += 'static const LengthRule m_LengthRule[%#x];\n' % rule_no
+        res += 'static const u16 m_LengthChain[%#x];\n' % (len(chains) + 1)
+        res += 'static const u16 m_LengthTable[%#x];\n' % len(table_chains)
+        res += 'static const u16 m_LengthGroup[%#x];\n' % len(group_chains)
+        return Indent(res)
+
+    def GenerateLengthCode(self):
+        chains, table_chains, group_chains = self.__X86_GenerateLengthRules()
+        arch_name = self.arch['arch_info']['name'].capitalize()
+
+        def Format(rule):
+            sub_type = ' | '.join(rule['sub_type']) if len(rule['sub_type']) else '0'
+            oprd = [ x for x in rule['oprd'] if x != 'X86_LengthOprd_None' ]
+            oprd = (oprd + [ 'X86_LengthOprd_None' ] * 4)[:4]
+            return '{ %s, X86_Length_%s, %#x, %#04x, %#04x, %s, { %#04x, %#04x }, %d, %s, { %s } }' % (
+                    rule['prefix'], rule['kind'], rule['modes'], rule['test'], rule['byte'], rule['vendor'],
+                    rule['arg'][0], rule['arg'][1], rule['length'], sub_type, ', '.join(oprd))
+
+        rules = []
+        chain_idx = []
+        for chain in chains:
+            chain_idx.append(len(rules))
+            rules += [ Format(x) for x in chain ]
+        chain_idx.append(len(rules))
+
+        res = ''
+        res += 'const %sArchitecture::LengthRule %sArchitecture::m_LengthRule[%#x] =\n' % (arch_name, arch_name, len(rules))
+        res += self._GenerateBrace(',\n'.join(rules) + '\n')[:-1] + ';\n\n'
+
+        for name, idx in (('Chain', chain_idx), ('Table', table_chains), ('Group', group_chains)):
+            res += 'const u16 %sArchitecture::m_Length%s[%#x] =\n' % (arch_name, name, len(idx))
+            lines = [ ', '.join('%#06x' % x for x in idx[i:i + 8]) for i in range(0, len(idx), 8) ]
+            res += self._GenerateBrace(',\n'.join(lines) + '\n')[:-1] + ';\n\n'
+
+        return res
+
 class ArmArchConvertion(ArchConvertion):
     def __init__(self, arch):
         ArchConvertion.__init__(self, arch)
@@ -1190,11 +1602,34 @@ class ArmArchConvertion(ArchConvertion):
         value = self.__ARM_GetValue(insn)
         return 'Instruction_%s_%s_%08x_%08x' % (mnem, mode, mask, value)
 
+    # Overlapping encodings are resolved by the order of this list, the first matching instruction wins
+    def __ARM_SortInstructions(self, insns):
+        insns_dict = {}
+
+        for insn in insns:
+            mask = self.__ARM_GetMask(insn)
+            if not mask in insns_dict:
+                insns_dict[mask] = []
+            insns_dict[mask].append(insn)
+
+        res = []
+        for mask, insn_list in insns_dict.items():
+            res += insn_list
+        return res
+
+    # Encodings of different sizes are looked up separately, it keeps the decision trees small
+    def __ARM_GetLookUps(self, name, insns):
+        res = []
+        for size in (16, 32):
+            if len([insn for insn in insns if len(insn['encoding']) == size]) != 0:
+                res.append(('LookUp%s%d' % (name, size), size))
+        return res
+
     def __ARM_GenerateMethodPrototype(self, insn, in_class = False):
         mnem = self.__ARM_GetMnemonic(insn)
-        meth_fmt = 'bool %s(BinaryStream const& rBinStrm, TOffset Offset, u32 Opcode, Instruction& rInsn)'
+        meth_fmt = 'bool %s(FetchWindowType const& rWnd, TOffset Offset, u32 Opcode, Instruction& rInsn)'
         if in_class == False:
-            meth_fmt = 'bool %sArchitecture::%%s(BinaryStream const& rBinStrm, TOffset Offset, u32 Opcode, Instruction& rInsn)' % self.arch['arch_info']['name'].capitalize()
+            meth_fmt = 'bool %sArchitecture::%%s(FetchWindowType const& rWnd, TOffset Offset, u32 Opcode, Instruction& rInsn)' % self.arch['arch_info']['name'].capitalize()
 
         return meth_fmt % self.__ARM_GenerateMethodName(insn)
 
@@ -1205,58 +1640,71 @@ class ArmArchConvertion(ArchConvertion):
         for insn in sorted(self.arch['insn'], key=lambda a:self.__ARM_GetMnemonic(a)):
             res += self.__ARM_GenerateMethodPrototype(insn, True) + ';\n'
 
-        res += 'bool DisassembleArm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);\n'
-        res += 'bool DisassembleThumb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);\n'
+        res += 'typedef bool (ArmArchitecture:: *TDisassembler)(FetchWindowType const&, TOffset, u32, Instruction&);\n'
+        for name, insns in (('Arm', self.arm_insns), ('Thumb', self.thumb_insns)):
+            res += 'static const TDisassembler m_%sDisassembler[%#x];\n' % (name, len(insns))
+            for lookup, size in self.__ARM_GetLookUps(name, insns):
+                res += 'static u16 %s(u32 Opcode);\n' % lookup
+
+        res += 'bool DisassembleArm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);\n'
+        res += 'bool DisassembleThumb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);\n'
 
         return res
 
     def GenerateSource(self):
         res = ''
 
-        res += 'bool ArmArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)\n'
+        res += 'bool ArmArchitecture::Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode)\n'
         res += self._GenerateBrace(
+                'FetchWindowType Wnd(rWnd);\n'+
                 self._GenerateSwitch('Mode',
-                    [('ARM_ModeArm',   'return DisassembleArm(rBinStrm, Offset, rInsn);\n',   False),
-                     ('ARM_ModeThumb', 'return DisassembleThumb(rBinStrm, Offset, rInsn);\n', False)],
+                    [('ARM_ModeArm',   'return DisassembleArm(Wnd, Wnd.GetOffset(), rInsn);\n',   False),
+                     ('ARM_ModeThumb', 'return DisassembleThumb(Wnd, Wnd.GetOffset(), rInsn);\n', False)],
                     'return false;\n')
                 )
 
-        def __ARM_GenerateDispatcher(arm, insns):
+        def __ARM_GenerateDispatcher(arm, name, insns):
             res = ''
-            insns_dict = {}
-
-            for insn in insns:
-                mask = arm.__ARM_GetMask(insn)
-                if not mask in insns_dict:
-                    insns_dict[mask] = []
-                insns_dict[mask].append(insn)
-
-            for mask, insn_list in insns_dict.items():
-                if len(insn_list) == 1:
-                    value = arm.__ARM_GetValue(insn_list[0])
-                    res += arm._GenerateCondition('if', '(Opcode & %#010x) == %#010x' % (mask, value), self.__ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode, rInsn);' % arm.__ARM_GenerateMethodName(insn_list[0]))
-                else:
-                    cases = []
-                    for insn in insn_list:
-                        value = arm.__ARM_GetValue(insn)
-                        cases.append( ('%#010x' % value, self.__ARM_GenerateInstructionComment(insn) + 'return %s(rBinStrm, Offset, Opcode, rInsn);\n' % arm.__ARM_GenerateMethodName(insn), False) )
-                    res += arm._GenerateSwitch('Opcode & %#010x' % mask, cases, 'break;\n')
+            insns = arm.__ARM_SortInstructions(insns)
+            tbl_name = 'm_%sDisassembler' % name
 
-            return res
+            res += 'const ArmArchitecture::TDisassembler ArmArchitecture::%s[%#x] =\n' % (tbl_name, len(insns))
+            res += '{\n'
+            res += ',\n'.join([Indent('&ArmArchitecture::%s' % arm.__ARM_GenerateMethodName(insn)) for insn in insns])
+            res += '\n};\n\n'
 
-        res += 'bool ArmArchitecture::DisassembleArm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)\n'
-        res += self._GenerateBrace(
-                self._GenerateRead('Opcode', 'Offset', 32)+
-                __ARM_GenerateDispatcher(self, self.arm_insns)+
-                'return false;\n'
-                )
+            # Each lookup returns the index of the first matching instruction or the size of the table
+            lookups = arm.__ARM_GetLookUps(name, insns)
+            for lookup, size in lookups:
+                entries = []
+                for insn_no in range(len(insns)):
+                    insn = insns[insn_no]
+                    if len(insn['encoding']) != size:
+                        continue
+                    entries.append( (arm.__ARM_GetMask(insn), arm.__ARM_GetValue(insn), 'return %#05x; // %s' % (insn_no, insn['format'])) )
+
+                res += 'u16 ArmArchitecture::%s(u32 Opcode)\n' % lookup
+                res += arm._GenerateBrace(arm._GenerateDecisionTree('Opcode', entries, 'return %#05x;' % len(insns)))
+                res += '\n'
 
-        res += 'bool ArmArchitecture::DisassembleThumb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)\n'
-        res += self._GenerateBrace(
-                self._GenerateRead('Opcode', 'Offset', 32)+
-                __ARM_GenerateDispatcher(self, self.thumb_insns)+
-                'return false;\n'
-                )
+            if len(lookups) == 1:
+                entry = '%s(Opcode)' % lookups[0][0]
+            else:
+                entry = 'std::min(%s)' % ', '.join(['%s(Opcode)' % lookup for lookup, size in lookups])
+
+            res += 'bool ArmArchitecture::Disassemble%s(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)\n' % name
+            res += arm._GenerateBrace(
+                    arm._GenerateRead('Opcode', 'Offset', 32)+
+                    'u16 Entry = %s;\n' % entry+
+                    arm._GenerateCondition('if', 'Entry >= sizeof(%s) / sizeof(*%s)' % (tbl_name, tbl_name), 'return false;')+
+                    'return (this->*%s[Entry])(rWnd, Offset, Opcode, rInsn);\n' % tbl_name
+                    )
+            res += '\n'
+
+            return res
+
+        res += __ARM_GenerateDispatcher(self, 'Arm', self.arm_insns)
+        res += __ARM_GenerateDispatcher(self, 'Thumb', self.thumb_insns)
 
         for insn in self.arm_insns + self.thumb_insns:
             res += self.__ARM_GenerateInstructionComment(insn)
@@ -1299,6 +1747,10 @@ def main():
         mns = conv.GenerateOpcodeString()
         opd = conv.GenerateOperandDefinition()
         opc = conv.GenerateOperandCode()
+        smd = conv.GenerateSemanticDefinition()
+        smc = conv.GenerateSemanticCode()
+        lnd = conv.GenerateLengthDefinition()
+        lnc = conv.GenerateLengthCode()
 
         arch_hpp = open('%s_opcode.ipp' % d['arch_info']['name'], 'w')
         arch_cpp = open('%s_opcode.cpp' % d['arch_info']['name'], 'w')
@@ -1307,12 +1759,16 @@ def main():
         arch_hpp.write(enm)
         arch_hpp.write(hdr)
         arch_hpp.write(opd)
+        arch_hpp.write(smd)
+        arch_hpp.write(lnd)
 
         arch_cpp.write(conv.GenerateBanner())
         arch_cpp.write('#include "%s_architecture.hpp"\n' % d['arch_info']['name'])
         arch_cpp.write(mns)
         arch_cpp.write(src)
         arch_cpp.write(opc)
+        arch_cpp.write(smc)
+        arch_cpp.write(lnc)
 
 if __name__ == "__main__":
     main()
@@ -1,6 +1,5 @@
 #include "arm_architecture.hpp"
 
-#include <boost/algorithm/string/join.hpp>
 
 ArmArchitecture::ArmArchitecture(void)
   : Architecture(MEDUSA_ARCH_TAG('a', 'r', 'm'))
@@ -23,26 +22,27 @@ char const* ArmArchitecture::ARMCpuInformation::ConvertIdentifierToName(u32 Id)
 
 u32 ArmArchitecture::ARMCpuInformation::ConvertNameToIdentifier(std::string const& rName) const
 {
-  static std::map<std::string, u32> s_NameToId;
-  if (s_NameToId.empty())
+  static std::map<std::string, u32> const s_NameToId = []()
   {
-    s_NameToId["r0"]  = ARM_RegR0;
-    s_NameToId["r1"]  = ARM_RegR1;
-    s_NameToId["r2"]  = ARM_RegR2;
-    s_NameToId["r3"]  = ARM_RegR3;
-    s_NameToId["r4"]  = ARM_RegR4;
-    s_NameToId["r5"]  = ARM_RegR5;
-    s_NameToId["r6"]  = ARM_RegR6;
-    s_NameToId["r7"]  = ARM_RegR7;
-    s_NameToId["r8"]  = ARM_RegR8;
-    s_NameToId["r9"]  = ARM_RegR9;
-    s_NameToId["r10"] = ARM_RegR10;
-    s_NameToId["r11"] = ARM_RegR11;
-    s_NameToId["r12"] = ARM_RegR12;
-    s_NameToId["sp"]  = ARM_RegR13;
-    s_NameToId["lr"]  = ARM_RegR14;
-    s_NameToId["pc"]  = ARM_RegR15;
-  }
+    std::map<std::string, u32> NameToId;
+    NameToId["r0"]  = ARM_RegR0;
+    NameToId["r1"]  = ARM_RegR1;
+    NameToId["r2"]  = ARM_RegR2;
+    NameToId["r3"]  = ARM_RegR3;
+    NameToId["r4"]  = ARM_RegR4;
+    NameToId["r5"]  = ARM_RegR5;
+    NameToId["r6"]  = ARM_RegR6;
+    NameToId["r7"]  = ARM_RegR7;
+    NameToId["r8"]  = ARM_RegR8;
+    NameToId["r9"]  = ARM_RegR9;
+    NameToId["r10"] = ARM_RegR10;
+    NameToId["r11"] = ARM_RegR11;
+    NameToId["r12"] = ARM_RegR12;
+    NameToId["sp"]  = ARM_RegR13;
+    NameToId["lr"]  = ARM_RegR14;
+    NameToId["pc"]  = ARM_RegR15;
+    return NameToId;
+  }();
   auto itResult = s_NameToId.find(rName);
   if (itResult == std::end(s_NameToId))
     return 0;
@@ -136,20 +136,19 @@ bool ArmArchitecture::FormatInstruction(
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
   Instruction   const& rInsn,
-  std::string        & rStrCell,
-  Cell::Mark::List   & rMarks) const
+  CellText           & rText) const
 {
   static char const* Suffix[] = { "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc", "hi", "ls", "ge", "lt", "gt", "le", "", "" };
   char Sep = '\0';
-  std::ostringstream oss;
+  size_t MnemBeg = rText.GetLength();
 
-  oss << m_Mnemonic[rInsn.GetOpcode()];
-  oss << Suffix[rInsn.GetTestedFlags() & 0xf];
+  rText.Write(m_Mnemonic[rInsn.GetOpcode()]);
+  rText.Write(Suffix[rInsn.GetTestedFlags() & 0xf]);
   if (rInsn.GetPrefix() & ARM_Prefix_S)
-    oss << "s";
-  oss << " ";
+    rText.Write('s');
+  rText.Write(' ');
 
-  rMarks.push_back(Cell::Mark(Cell::Mark::MnemonicType, oss.str().size()));
+  rText.Mark(Cell::Mark::MnemonicType, rText.GetLength() - MnemBeg);
 
   for (int i = 0; i < 4; ++i)
   {
@@ -159,153 +158,104 @@ bool ArmArchitecture::FormatInstruction(
       Sep = ',';
     else
     {
-      oss << Sep << " ";
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 2));
+      rText.Write(Sep);
+      rText.Write(' ');
+      rText.Mark(Cell::Mark::OperatorType, 2);
     }
 
     if ((pOprd->GetType() & O_MEM32) == O_MEM32)
     {
-      oss << "[";
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Append(Cell::Mark::OperatorType, "[", 1);
 
-      auto RegStr = RegisterToString(pOprd->GetReg(), rInsn.GetMode());
-      oss << RegStr;
-      rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, RegStr.size()));
+      rText.Mark(Cell::Mark::RegisterType, WriteRegister(rText, pOprd->GetReg(), rInsn.GetMode()));
 
       if (pOprd->GetType() & O_SREG)
       {
-        oss << ",";
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
-
-        auto SecRegStr = RegisterToString(pOprd->GetSecReg(), rInsn.GetMode());
-        oss << SecRegStr;
-        rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, SecRegStr.size()));
+        rText.Append(Cell::Mark::OperatorType, ",", 1);
+        rText.Mark(Cell::Mark::RegisterType, WriteRegister(rText, pOprd->GetSecReg(), rInsn.GetMode()));
       }
       else if (pOprd->GetType() & O_DISP)
       {
-        oss << ",";
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
-
-        std::ostringstream Imm;
-        Imm << "#";
-        rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, 1));
-
-        Imm << "0x" << std::setfill('0') << std::setw(8) << std::hex << pOprd->GetValue();
-        oss << Imm.str();
-        rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, Imm.str().size() - 1));
+        rText.Append(Cell::Mark::OperatorType, ",", 1);
+        rText.Append(Cell::Mark::KeywordType, "#", 1);
+        rText.AppendHex(pOprd->GetValue(), 8);
       }
 
-      oss << "]";
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Append(Cell::Mark::OperatorType, "]", 1);
     }
     else if ((pOprd->GetType() & O_REG32) == O_REG32)
-    {
-      auto RegStr = RegisterToString(pOprd->GetReg(), rInsn.GetMode());
-      oss << RegStr;
-      rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, RegStr.size()));
-    }
+      rText.Mark(Cell::Mark::RegisterType, WriteRegister(rText, pOprd->GetReg(), rInsn.GetMode()));
 
-    else if ((pOprd->GetType() & O_IMM32) == O_IMM32)
+    // Immediates are prefixed with #, literal pool addresses with =
+    else if ((pOprd->GetType() & O_IMM32) == O_IMM32 || (pOprd->GetType() & O_ABS32) == O_ABS32)
     {
-      std::ostringstream ImmStrm;
-      ImmStrm << "#";
-      rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, 1));
+      rText.Append(Cell::Mark::KeywordType, ((pOprd->GetType() & O_IMM32) == O_IMM32) ? "#" : "=", 1);
       Label Lbl = rDoc.GetLabelFromAddress(pOprd->GetValue());
 
       if (Lbl.GetType() == Label::Unknown)
-      {
-        ImmStrm << "0x" << std::setfill('0') << std::setw(8) << std::hex << pOprd->GetValue();
-        rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ImmStrm.str().size() - 1));
-      }
-
+        rText.AppendHex(pOprd->GetValue(), 8);
       else
-      {
-        ImmStrm << Lbl.GetLabel();
-        rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, ImmStrm.str().size() - 1));
-      }
-
-      oss << ImmStrm.str();
-    }
-
-    else if ((pOprd->GetType() & O_ABS32) == O_ABS32)
-    {
-      std::ostringstream ImmStrm;
-      ImmStrm << "=";
-      rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, 1));
-      Label Lbl = rDoc.GetLabelFromAddress(pOprd->GetValue());
-
-      if (Lbl.GetType() == Label::Unknown)
-      {
-        ImmStrm << "0x" << std::setfill('0') << std::setw(8) << std::hex << pOprd->GetValue();
-        rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ImmStrm.str().size() - 1));
-      }
-
-      else
-      {
-        ImmStrm << Lbl.GetLabel();
-        rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, ImmStrm.str().size() - 1));
-      }
-
-      oss << ImmStrm.str();
+        rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(Lbl));
     }
 
     else if ((pOprd->GetType() & O_REL32) == O_REL32)
     {
       Address DstAddr;
-      std::string OprdName = "";
 
       if (rInsn.GetOperandReference(rDoc, 0, rAddr, DstAddr))
       {
         Label Lbl = rDoc.GetLabelFromAddress(DstAddr);
-        OprdName = Lbl.GetLabel();
-        Cell::Mark::Type MarkType = Cell::Mark::LabelType;
-
-        if (OprdName.empty())
-        {
-          OprdName = DstAddr.ToString();
-          MarkType = Cell::Mark::ImmediateType;
-        }
+        size_t LblLen = rText.WriteLabel(Lbl);
 
-        oss << OprdName;
-        rMarks.push_back(Cell::Mark(MarkType, OprdName.size()));
+        if (LblLen == 0)
+          rText.Mark(Cell::Mark::ImmediateType, rText.WriteAddress(DstAddr));
+        else
+          rText.Mark(Cell::Mark::LabelType, LblLen);
       }
       else
-      {
-        oss << OprdName;
-        rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, OprdName.size()));
-      }
+        rText.Mark(Cell::Mark::ImmediateType, 0);
     }
   }
 
-  rStrCell = oss.str();
   return true;
 }
 
-std::string ArmArchitecture::RegisterToString(u32 Register, u8 Mode) const
+size_t ArmArchitecture::WriteRegister(CellText& rText, u32 Register, u8 Mode) const
 {
   static char const *s_RegisterName[] = { "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "fp", "ip", "sp", "lr", "pc" };
-  std::list<std::string> RegsStr;
+  size_t TextBeg = rText.GetLength();
 
+  // Consecutive registers are merged as a range, a list of several ranges or registers is enclosed in braces
+  u8 RangeNo = 0;
+  for (unsigned i = 0; i < 16; ++i)
+    if ((Register & (1 << i)) && (i == 0 || !(Register & (1 << (i - 1)))))
+      ++RangeNo;
+
+  if (RangeNo > 1)
+    rText.Write('{');
+
+  char Sep = '\0';
   for (unsigned i = 0; i < 16; ++i)
   {
-    if (Register & (1 << i))
+    if (!(Register & (1 << i)))
+      continue;
+
+    if (Sep != '\0')
+      rText.Write(Sep);
+    Sep = ',';
+
+    rText.Write(s_RegisterName[i]);
+    if (((Register >> i) & 3) == 3)
     {
-      if (((Register >> i) & 3) == 3)
-      {
-        std::string Res;
-        Res += s_RegisterName[i];
-        Res += "-";
-        while (i < 15 && (Register & (1 << (i + 1))))
-          ++i;
-        Res += s_RegisterName[i];
-        RegsStr.push_back(Res);
-      }
-      else
-        RegsStr.push_back(s_RegisterName[i]);
+      rText.Write('-');
+      while (i < 15 && (Register & (1 << (i + 1))))
+        ++i;
+      rText.Write(s_RegisterName[i]);
     }
   }
 
-  if (RegsStr.size() > 1)
-    return std::string("{") + boost::join(RegsStr, ",") + std::string("}");
-  return *std::begin(RegsStr);
+  if (RangeNo > 1)
+    rText.Write('}');
+
+  return rText.GetLength() - TextBeg;
 }
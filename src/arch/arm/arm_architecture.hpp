@@ -57,13 +57,18 @@ class ArmArchitecture : public Architecture
   };
 
 public:
+  typedef EndianFetchWindow<LittleEndian> FetchWindowType;
+
   ArmArchitecture(void);
   ~ArmArchitecture(void) {}
 
+  using Architecture::Disassemble;
+
   virtual std::string           GetName(void) const                                    { return "ARM"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhysOff) { return false; }
   virtual EEndianness           GetEndianness(void)                                    { return LittleEndian; }
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode);
+  virtual u8                    GetMaximumInstructionLength(void) const                { return 4; }
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector ArmModes;
@@ -79,14 +84,14 @@ public:
     BinaryStream  const& rBinStrm,
     Address       const& rAddr,
     Instruction   const& rInsn,
-    std::string        & rStrCell,
-    Cell::Mark::List   & rMarks) const;
+    CellText           & rText) const;
   virtual CpuInformation const* GetCpuInformation(void) const                          { static ARMCpuInformation ArmCpuInfo; return &ArmCpuInfo; }
   virtual CpuContext*           MakeCpuContext(void) const                             { return nullptr; }
   virtual MemoryContext*        MakeMemoryContext(void) const                          { return nullptr; }
 
 private:
-  std::string RegisterToString(u32 Register, u8 Mode) const;
+  //! This method writes a register or a register list and returns the number of written characters.
+  size_t WriteRegister(CellText& rText, u32 Register, u8 Mode) const;
 
 #include "arm_opcode.ipp"
 };
@@ -1,5 +1,7 @@
 #include "avr8_architecture.hpp"
-#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <map>
 #include <medusa/medusa.hpp>
 
 char const *Avr8Architecture::m_RegName[] =
@@ -17,72 +19,236 @@ bool Avr8Architecture::Translate(Address const& rVirtAddr, TOffset& rPhysOff)
   return true;
 }
 
-bool Avr8Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+Avr8Architecture::TDecoder const Avr8Architecture::m_Decoder[] =
+{
+  &Avr8Architecture::Decode_Invalid,
+  &Avr8Architecture::Decode_Word,
+  &Avr8Architecture::Decode_ProgramAddress,
+  &Avr8Architecture::Decode_LoadAddress,
+  &Avr8Architecture::Decode_StoreAddress
+};
+
+bool Avr8Architecture::Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode)
+{
+  FetchWindowType Wnd(rWnd);
+  TOffset Offset = Wnd.GetOffset();
+  bool Result;
+
+  if (m_CfgMdl.GetBoolean("Opcode table"))
+  {
+    u16 Opcode;
+    if (!Wnd.Read(Offset, Opcode))
+      return false;
+
+    OpcodeEntry const& rEntry = GetOpcodeTable().m_Entries[Opcode];
+    return (this->*m_Decoder[rEntry.m_Decoder])(Wnd, Offset, rEntry, rInsn);
+  }
+
+  Result = DecodeOpcode(Wnd, Offset, rInsn);
+  if (Result == true)
+  {
+    FormatOperand(rInsn.FirstOperand(),  Offset);
+    FormatOperand(rInsn.SecondOperand(), Offset);
+    FormatOperand(rInsn.ThirdOperand(),  Offset);
+    FormatOperand(rInsn.FourthOperand(), Offset);
+  }
+  return Result;
+}
+
+Avr8Architecture::OpcodeTable const& Avr8Architecture::GetOpcodeTable(void)
+{
+  static OpcodeTable const s_OpcodeTable = MakeOpcodeTable();
+  return s_OpcodeTable;
+}
+
+// The table is filled by running the decoder on every opcode word,
+// the word which follows is zero so only the address of long instructions is missing
+Avr8Architecture::OpcodeTable Avr8Architecture::MakeOpcodeTable(void)
+{
+  OpcodeTable Table;
+  std::map<std::string, u16> OprdNames;
+
+  Table.m_Entries.resize(0x10000);
+  for (u32 Opcode = 0; Opcode < 0x10000; ++Opcode)
+  {
+    u8 Bytes[4] = { static_cast<u8>(Opcode), static_cast<u8>(Opcode >> 8), 0x00, 0x00 };
+    FetchWindowType Wnd(FetchWindow(Bytes, 0, sizeof(Bytes)));
+    Instruction Insn;
+    OpcodeEntry& rEntry = Table.m_Entries[Opcode];
+
+    memset(&rEntry, 0, sizeof(rEntry));
+    rEntry.m_Decoder = DecodeInvalid;
+    if (!DecodeOpcode(Wnd, 0, Insn))
+      continue;
+
+    rEntry.m_pName   = Insn.GetName();
+    rEntry.m_Opcode  = static_cast<u16>(Insn.GetOpcode());
+    rEntry.m_Length  = static_cast<u8>(Insn.GetLength());
+    rEntry.m_SubType = Insn.GetSubType();
+    for (u8 OprdIdx = 0; OprdIdx < 2; ++OprdIdx)
+    {
+      Operand& rOprd = *Insn.Operand(OprdIdx);
+      rEntry.m_Type[OprdIdx]  = rOprd.Type();
+      rEntry.m_Reg[OprdIdx]   = static_cast<u8>(rOprd.Reg());
+      rEntry.m_Value[OprdIdx] = static_cast<s32>(rOprd.Value());
+
+      FormatOperand(rOprd, 0);
+      auto itOprdName = OprdNames.find(rOprd.GetName());
+      if (itOprdName == std::end(OprdNames))
+      {
+        itOprdName = OprdNames.insert(std::make_pair(rOprd.GetName(), static_cast<u16>(Table.m_OprdNames.size()))).first;
+        Table.m_OprdNames.push_back(rOprd.GetName());
+      }
+      rEntry.m_OprdName[OprdIdx] = itOprdName->second;
+    }
+
+    switch (rEntry.m_Opcode)
+    {
+    case AVR8_Jmp: case AVR8_Call: rEntry.m_Decoder = DecodeProgramAddress; break;
+    case AVR8_Lds:                 rEntry.m_Decoder = DecodeLoadAddress;    break;
+    case AVR8_Sts:                 rEntry.m_Decoder = DecodeStoreAddress;   break;
+    default:                       rEntry.m_Decoder = DecodeWord;           break;
+    }
+  }
+
+  return Table;
+}
+
+bool Avr8Architecture::Decode_Invalid(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn)
+{
+  return false;
+}
+
+bool Avr8Architecture::Decode_Word(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn)
+{
+  rInsn.SetName(rEntry.m_pName);
+  rInsn.Opcode()  = rEntry.m_Opcode;
+  rInsn.Length()  = rEntry.m_Length;
+  rInsn.SubType() = rEntry.m_SubType;
+
+  auto const& rOprdNames = GetOpcodeTable().m_OprdNames;
+  for (u8 OprdIdx = 0; OprdIdx < 2; ++OprdIdx)
+  {
+    Operand& rOprd = *rInsn.Operand(OprdIdx);
+    rOprd.Type()   = rEntry.m_Type[OprdIdx];
+    rOprd.Reg()    = rEntry.m_Reg[OprdIdx];
+    // Relative operands are stored sign-extended
+    rOprd.Value()  = static_cast<s64>(rEntry.m_Value[OprdIdx]);
+    rOprd.SetName(rOprdNames[rEntry.m_OprdName[OprdIdx]]);
+  }
+
+  return true;
+}
+
+bool Avr8Architecture::Decode_ProgramAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn)
+{
+  u16 Addr;
+
+  if (!rWnd.Read(Offset + 2, Addr))
+    return false;
+
+  Decode_Word(rWnd, Offset, rEntry, rInsn);
+  // Program memory is word addressable
+  rInsn.FirstOperand().Value() |= Addr << 1;
+  FormatOperand(rInsn.FirstOperand(), Offset);
+  return true;
+}
+
+bool Avr8Architecture::Decode_LoadAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn)
+{
+  u16 Addr;
+
+  if (!rWnd.Read(Offset + 2, Addr))
+    return false;
+
+  Decode_Word(rWnd, Offset, rEntry, rInsn);
+  rInsn.SecondOperand().Value() = Addr;
+  FormatOperand(rInsn.SecondOperand(), Offset);
+  return true;
+}
+
+bool Avr8Architecture::Decode_StoreAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn)
+{
+  u16 Addr;
+
+  if (!rWnd.Read(Offset + 2, Addr))
+    return false;
+
+  Decode_Word(rWnd, Offset, rEntry, rInsn);
+  rInsn.FirstOperand().Value() = Addr;
+  FormatOperand(rInsn.FirstOperand(), Offset);
+  return true;
+}
+
+bool Avr8Architecture::DecodeOpcode(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1;
   bool Result;
 
-  rBinStrm.Read(Offset + 1, Opcode1);
+  if (!rWnd.Read(Offset + 1, Opcode1))
+    return false;
 
   switch (Opcode1 & 0xf0)
     {
     case 0x00:
-      Result = Insn_0xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_0xxx(rWnd, Offset, rInsn);  break;
     case 0x10:
-      Result = Insn_1xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_1xxx(rWnd, Offset, rInsn);  break;
     case 0x20:
-      Result = Insn_2xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_2xxx(rWnd, Offset, rInsn);  break;
     case 0x30: case 0x40: case 0x50: case 0x60: case 0x70:
-      Result = Insn_3xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_3xxx(rWnd, Offset, rInsn);  break;
     case 0x80:
-      Result = Insn_8xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_8xxx(rWnd, Offset, rInsn);  break;
     case 0x90:
-      Result = Insn_9xxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_9xxx(rWnd, Offset, rInsn);  break;
     case 0xa0:
-      Result = Insn_axxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_axxx(rWnd, Offset, rInsn);  break;
     case 0xb0:
-      Result = Insn_bxxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_bxxx(rWnd, Offset, rInsn);  break;
     case 0xc0:
-      Result = Insn_Rjmp(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_Rjmp(rWnd, Offset, rInsn);  break;
     case 0xd0:
-      Result = Insn_Rcall(rBinStrm, Offset, rInsn); break;
+      Result = Insn_Rcall(rWnd, Offset, rInsn); break;
     case 0xe0:
-      Result = Insn_Ldi(rBinStrm, Offset, rInsn);   break;
+      Result = Insn_Ldi(rWnd, Offset, rInsn);   break;
     case 0xf0:
-      Result = Insn_fxxx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_fxxx(rWnd, Offset, rInsn);  break;
     }
 
-  if (Result == true)
-  {
-    FormatOperand(rInsn.FirstOperand(),  Offset);
-    FormatOperand(rInsn.SecondOperand(), Offset);
-    FormatOperand(rInsn.ThirdOperand(),  Offset);
-    FormatOperand(rInsn.FourthOperand(), Offset);
-  }
   return Result;
 }
 
 void Avr8Architecture::FormatOperand(Operand& Op, TOffset Offset)
 {
-  std::ostringstream oss;
+  // Most operands are decoded from the opcode table, a stream would cost more than the decoding
+  char Buf[64];
+  int Len = 0;
+
+  if (Op.Type() == O_NONE)
+  {
+    Op.SetName("");
+    return;
+  }
 
   if (Op.Type() & O_REG)
     if (Op.Reg() <= (sizeof(m_RegName) / sizeof(*m_RegName)))
-      oss << m_RegName[Op.Reg()];
+      Len += snprintf(Buf + Len, sizeof(Buf) - Len, "%s", m_RegName[Op.Reg()]);
 
+  // A negative relative value is printed as its 16-bit two's complement
   if (Op.Type() & O_REL)
-    oss << std::hex << std::showpos << static_cast<s16>(Op.Value() & 0xffff);
+    Len += snprintf(Buf + Len, sizeof(Buf) - Len, "%x", static_cast<u16>(Op.Value() & 0xffff));
 
   if (Op.Type() & O_IMM)
-    oss << "0x" << std::hex << Op.GetValue();
+    Len += snprintf(Buf + Len, sizeof(Buf) - Len, "0x%llx", static_cast<unsigned long long>(Op.GetValue()));
 
   if (Op.Type() & O_MEM  && Op.Type() & O_DISP)
-    oss << "+" << std::hex << Op.GetValue();
+    Len += snprintf(Buf + Len, sizeof(Buf) - Len, "+%llx", static_cast<unsigned long long>(Op.GetValue()));
 
-  Op.SetName(oss.str().c_str());
+  Op.SetName(std::string(Buf, Len));
 }
 
-bool Avr8Architecture::Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_axxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   /*  u8 Opcode1, Opcode2;
 
@@ -90,8 +256,8 @@ bool Avr8Architecture::Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, I
   rInsn.Length() = 2;
   rInsn.SetName("");
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = 0;
@@ -106,13 +272,13 @@ bool Avr8Architecture::Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return false;
 }
 
-bool Avr8Architecture::Insn_fxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_fxxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
 
-  rBinStrm.Read(Offset    , Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset    , Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
   rInsn.Length() = 2;
 
   if ((Opcode1 & 0x0c) > 0x04)
@@ -184,13 +350,13 @@ bool Avr8Architecture::Insn_fxxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_1xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_1xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   //u8 Operand1, Operand2;
 
-  rBinStrm.Read(Offset    , Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset    , Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
   rInsn.Length() = 2;
 
   switch (Opcode1 & 0x0c)
@@ -212,14 +378,14 @@ bool Avr8Architecture::Insn_1xxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_0xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_0xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   u8 Operand1, Operand2;
   bool Result;
 
-  rBinStrm.Read(Offset    , Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset    , Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
   rInsn.Length() = 2;
 
   if (!(Opcode1 & 0x0c))
@@ -282,14 +448,14 @@ bool Avr8Architecture::Insn_0xxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_8xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_8xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   if (!(Opcode1 & 0x0c) && !(Opcode2 & 0x07))
     {
@@ -351,14 +517,14 @@ bool Avr8Architecture::Insn_8xxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_3xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_3xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -380,14 +546,14 @@ bool Avr8Architecture::Insn_3xxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_94xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
 
   rInsn.Length() = 2;
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   if ((Opcode1 & 0x0f) == 0x04)
     {
@@ -417,7 +583,7 @@ bool Avr8Architecture::Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, I
 
           default:
             if ((Opcode2 & 0x0f) == 0x0b)
-              Result = Insn_Des(rBinStrm, Offset, rInsn);
+              Result = Insn_Des(rWnd, Offset, rInsn);
             else
               Result = false;
             break;
@@ -487,8 +653,8 @@ bool Avr8Architecture::Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, I
       rInsn.Length() = 4;
       Operand& FrstOperand = rInsn.FirstOperand();
       FrstOperand.Type()   = O_ABS;
-      rBinStrm.Read(Offset + 2, Addr4);
-      rBinStrm.Read(Offset + 3, Addr3);
+      rWnd.Read(Offset + 2, Addr4);
+      rWnd.Read(Offset + 3, Addr3);
       FrstOperand.Value()  = ( ((Opcode1 & 0x01) << 21)
                                | ((Opcode2 & 0xf0) << 13) | ((Opcode2 & 0x01) << 16)
                                | (Addr3 << 8)
@@ -500,7 +666,7 @@ bool Avr8Architecture::Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_Des(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Des(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode2;
 
@@ -508,7 +674,7 @@ bool Avr8Architecture::Insn_Des(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 2;
   rInsn.SetName("des");
 
-  rBinStrm.Read(Offset,     Opcode2);
+  rWnd.Read(Offset,     Opcode2);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_IMM;
@@ -517,7 +683,7 @@ bool Avr8Architecture::Insn_Des(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Pop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -525,8 +691,8 @@ bool Avr8Architecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 2;
   rInsn.SetName("pop");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -535,7 +701,7 @@ bool Avr8Architecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Lds(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   u16 Addr;
@@ -544,9 +710,9 @@ bool Avr8Architecture::Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 4;
   rInsn.SetName("lds");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
-  rBinStrm.Read(Offset + 2, Addr);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset + 2, Addr);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -559,32 +725,32 @@ bool Avr8Architecture::Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_90xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_90xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode2;
   bool Result;
 
-  rBinStrm.Read(Offset, Opcode2);
+  rWnd.Read(Offset, Opcode2);
 
   switch (Opcode2 & 0x0f)
     {
     case 0x00:
-      Result = Insn_Lds(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_Lds(rWnd, Offset, rInsn);  break;
     case 0x01: case 0x02: case 0x09: case 0x0a: case 0x0c: case 0x0d: case 0x0e:
-      Result = Insn_Ld(rBinStrm, Offset, rInsn);   break;
+      Result = Insn_Ld(rWnd, Offset, rInsn);   break;
     case 0x04: case 0x05:
-      Result = Insn_Lpm(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_Lpm(rWnd, Offset, rInsn);  break;
     case 0x06: case 0x07:
-      Result = Insn_Elpm(rBinStrm, Offset, rInsn); break;
+      Result = Insn_Elpm(rWnd, Offset, rInsn); break;
     case 0x0f:
-      Result = Insn_Pop(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_Pop(rWnd, Offset, rInsn);  break;
     default:
       Result = false; break;
     }
   return Result;
 }
 
-bool Avr8Architecture::Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Elpm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
@@ -593,8 +759,8 @@ bool Avr8Architecture::Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, I
   rInsn.Length() = 2;
   rInsn.SetName("elpm");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -613,7 +779,7 @@ bool Avr8Architecture::Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_Lpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Lpm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
@@ -622,8 +788,8 @@ bool Avr8Architecture::Insn_Lpm(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 2;
   rInsn.SetName("lpm");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -642,7 +808,7 @@ bool Avr8Architecture::Insn_Lpm(BinaryStream const& rBinStrm, TOffset Offset, In
   return Result;
 }
 
-bool Avr8Architecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Ld(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
@@ -651,8 +817,8 @@ bool Avr8Architecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Ins
   rInsn.Length() = 2;
   rInsn.SetName("ld");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -676,7 +842,7 @@ bool Avr8Architecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Ins
   return Result;
 }
 
-bool Avr8Architecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Push(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -684,8 +850,8 @@ bool Avr8Architecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, I
   rInsn.Length() = 2;
   rInsn.SetName("push");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -694,7 +860,7 @@ bool Avr8Architecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_St(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
@@ -703,8 +869,8 @@ bool Avr8Architecture::Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Ins
   rInsn.Length() = 2;
   rInsn.SetName("st");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_MEM8 | O_REG16;
@@ -728,7 +894,7 @@ bool Avr8Architecture::Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Ins
   return Result;
 }
 
-bool Avr8Architecture::Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Sts(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   u16 Addr;
@@ -737,9 +903,9 @@ bool Avr8Architecture::Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 4;
   rInsn.SetName("sts");
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
-  rBinStrm.Read(Offset + 2, Addr);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset + 2, Addr);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_MEM8 | O_IMM16;
@@ -752,21 +918,21 @@ bool Avr8Architecture::Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_92xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_92xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode2;
   bool Result;
 
-  rBinStrm.Read(Offset, Opcode2);
+  rWnd.Read(Offset, Opcode2);
 
   switch (Opcode2 & 0x0f)
     {
     case 0x00:
-      Result = Insn_Sts(rBinStrm, Offset, rInsn); break;
+      Result = Insn_Sts(rWnd, Offset, rInsn); break;
     case 0x01: case 0x02: case 0x09: case 0x0a: case 0x0c: case 0x0d: case 0x0e:
-      Result = Insn_St(rBinStrm, Offset, rInsn); break;
+      Result = Insn_St(rWnd, Offset, rInsn); break;
     case 0x0f:
-      Result = Insn_Push(rBinStrm, Offset, rInsn); break;
+      Result = Insn_Push(rWnd, Offset, rInsn); break;
     default:
       Result = false; break;
     }
@@ -774,15 +940,15 @@ bool Avr8Architecture::Insn_92xx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_98xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_98xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_IMM; // Actually it's an address in I/O space.
@@ -804,15 +970,15 @@ bool Avr8Architecture::Insn_98xx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_96xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_96xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
   bool Result;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset, Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset, Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG;
@@ -831,32 +997,32 @@ bool Avr8Architecture::Insn_96xx(BinaryStream const& rBinStrm, TOffset Offset, I
   return Result;
 }
 
-bool Avr8Architecture::Insn_9xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_9xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1;
   bool Result;
 
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset + 1, Opcode1);
 
   switch (Opcode1 & 0x0e)
     {
     case 0x00:
-      Result = Insn_90xx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_90xx(rWnd, Offset, rInsn);  break;
     case 0x02:
-      Result = Insn_92xx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_92xx(rWnd, Offset, rInsn);  break;
     case 0x04:
-      Result = Insn_94xx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_94xx(rWnd, Offset, rInsn);  break;
     case 0x06:
-      Result = Insn_96xx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_96xx(rWnd, Offset, rInsn);  break;
     case 0x08: case 0x0a:
-      Result = Insn_98xx(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_98xx(rWnd, Offset, rInsn);  break;
     case 0x0c: case 0x0e:
-      Result = Insn_Mulu(rBinStrm, Offset, rInsn);  break;
+      Result = Insn_Mulu(rWnd, Offset, rInsn);  break;
     }
   return Result;
 }
 
-bool Avr8Architecture::Insn_Mulu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Mulu(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -864,8 +1030,8 @@ bool Avr8Architecture::Insn_Mulu(BinaryStream const& rBinStrm, TOffset Offset, I
   rInsn.Length() = 2;
   rInsn.SetName("mulu");
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -878,7 +1044,7 @@ bool Avr8Architecture::Insn_Mulu(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_Rcall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Rcall(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -887,8 +1053,8 @@ bool Avr8Architecture::Insn_Rcall(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.Length() = 2;
   rInsn.SetName("rcall");
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REL;
@@ -904,7 +1070,7 @@ bool Avr8Architecture::Insn_Rcall(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool Avr8Architecture::Insn_Rjmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Rjmp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -913,8 +1079,8 @@ bool Avr8Architecture::Insn_Rjmp(BinaryStream const& rBinStrm, TOffset Offset, I
   rInsn.Length() = 2;
   rInsn.SetName("rjmp");
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REL;
@@ -930,7 +1096,7 @@ bool Avr8Architecture::Insn_Rjmp(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Ldi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
@@ -938,8 +1104,8 @@ bool Avr8Architecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, In
   rInsn.Length() = 2;
   rInsn.SetName("ldi");
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   Operand& FrstOperand = rInsn.FirstOperand();
   FrstOperand.Type()   = O_REG8;
@@ -952,14 +1118,14 @@ bool Avr8Architecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool Avr8Architecture::Insn_bxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_bxxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
   Operand& FrstOperand = rInsn.FirstOperand();
   Operand& ScdOperand = rInsn.SecondOperand();
 
@@ -985,14 +1151,14 @@ bool Avr8Architecture::Insn_bxxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_2xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_2xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode1, Opcode2;
 
   rInsn.Length() = 2;
 
-  rBinStrm.Read(Offset,     Opcode2);
-  rBinStrm.Read(Offset + 1, Opcode1);
+  rWnd.Read(Offset,     Opcode2);
+  rWnd.Read(Offset + 1, Opcode1);
 
   switch (Opcode1 & 0x0c)
     {
@@ -1013,7 +1179,7 @@ bool Avr8Architecture::Insn_2xxx(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-bool Avr8Architecture::Insn_Invalid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool Avr8Architecture::Insn_Invalid(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("invalid");
   rInsn.Opcode() = AVR8_Invalid_Insn;
@@ -6,6 +6,8 @@
 #include "medusa/binary_stream.hpp"
 #include "medusa/instruction.hpp"
 
+#include <vector>
+
 #include "avr8_instruction.hpp"
 #include "avr8_register.hpp"
 
@@ -26,11 +28,17 @@ extern "C" ARCH_AVR8_EXPORT Architecture* GetArchitecture(void);
 class Avr8Architecture : public Architecture
 {
 public:
-  Avr8Architecture(void) : Architecture(MEDUSA_ARCH_TAG('a','v','r')) {}
+  typedef EndianFetchWindow<LittleEndian> FetchWindowType;
+
+  Avr8Architecture(void) : Architecture(MEDUSA_ARCH_TAG('a','v','r'))
+  { m_CfgMdl.InsertBoolean("Opcode table", true); }
+
+  using Architecture::Disassemble;
 
   virtual std::string GetName(void) const { return "Atmel AVR 8-bit"; }
   virtual bool        Translate(Address const& rVirtAddr, TOffset& rPhyslOff);
-  virtual bool        Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool        Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode);
+  virtual u8          GetMaximumInstructionLength(void) const { return 4; }
   virtual NamedModeVector GetModes(void) const
   {
     NamedModeVector Avr8Modes;
@@ -46,141 +54,185 @@ public:
 private:
   static char const *m_RegName[];
 
+  //! OpcodeEntry holds everything decoded from one opcode word, operand names included.
+  struct OpcodeEntry
+  {
+    char const* m_pName;
+    u32         m_Type[2];
+    s32         m_Value[2];
+    u16         m_OprdName[2];
+    u16         m_Opcode;
+    u8          m_Reg[2];
+    u8          m_Length;
+    u8          m_SubType;
+    u8          m_Decoder;
+  };
+
+  enum
+  {
+    DecodeInvalid,
+    DecodeWord,
+    DecodeProgramAddress,
+    DecodeLoadAddress,
+    DecodeStoreAddress
+  };
+
+  typedef bool (Avr8Architecture:: *TDecoder)(FetchWindowType const&, TOffset, OpcodeEntry const&, Instruction&);
+  static const TDecoder m_Decoder[];
+
+  struct OpcodeTable
+  {
+    std::vector<OpcodeEntry> m_Entries;
+    std::vector<std::string> m_OprdNames;
+  };
+
+  OpcodeTable const& GetOpcodeTable(void);
+  OpcodeTable MakeOpcodeTable(void);
+
+  // Applies one entry of the opcode table
+  bool Decode_Invalid(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn);
+  bool Decode_Word(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn);
+  bool Decode_ProgramAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn);
+  bool Decode_LoadAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn);
+  bool Decode_StoreAddress(FetchWindowType const& rWnd, TOffset Offset, OpcodeEntry const& rEntry, Instruction& rInsn);
+
+  // Decodes one opcode with the bit field switches, it fills the opcode table
+  bool DecodeOpcode(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
   void FormatOperand(Operand& Op, TOffset Offset);
 
-  bool Insn_(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn); // DELETE WHEN FINISH
+  bool Insn_(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn); // DELETE WHEN FINISH
 
   // Handles one instruction
-  bool Insn_Invalid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Add(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Adiw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_And(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Andi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Asr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Bclr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Bld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brbc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brbs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brcc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brcs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Break(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Breq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brge(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brhc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brhs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brie(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brlo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brlt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brmi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brne(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brpl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brsh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brtc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brts(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brvc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Brvs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Bset(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Bst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Call(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cbi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cbr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cli(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cln(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Clz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Com(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cpc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cpi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cpse(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Des(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Eicall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Eijmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Elpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Eor(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Fmul(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Fmuls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Fmulsu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Icall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ijmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_In(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Jmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Lds(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Lpm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Lsl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Lsr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Mov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Movw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Muls(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Mulsu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Mulu(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Neg(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Nop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Or(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ori(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Out(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rcall(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rjmp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rol(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ror(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbci(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbic(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbis(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbiw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbrc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbrs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Seh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sei(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sen(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ser(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ses(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Set(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sez(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sleep(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Spm(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sts(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_St(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Subi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Tst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Wdr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_Invalid(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Adc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Add(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Adiw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_And(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Andi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Asr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Bclr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Bld(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brbc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brbs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brcc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brcs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Break(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Breq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brge(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brhc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brhs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brid(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brie(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brlo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brlt(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brmi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brne(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brpl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brsh(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brtc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brts(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brvc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Brvs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Bset(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Bst(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Call(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cbi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cbr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clh(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cli(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cln(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cls(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clt(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Clz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Com(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cpc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cpi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cpse(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Des(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Eicall(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Eijmp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Elpm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Eor(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Fmul(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Fmuls(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Fmulsu(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Icall(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ijmp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_In(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Inc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Jmp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Lds(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ld(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Lpm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Lsl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Lsr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Mov(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Movw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Muls(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Mulsu(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Mulu(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Neg(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Nop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Or(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ori(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Out(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Pop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Push(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rcall(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ret(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Reti(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rjmp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rol(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ror(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbci(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbic(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbis(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbiw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbrc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbrs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Seh(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sei(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sen(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ser(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ses(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Set(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sez(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sleep(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Spm(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sts(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_St(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sub(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Subi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Swap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Tst(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Wdr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
   // Handles multiple instructions
-  bool Insn_0xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_1xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_2xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_3xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_8xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_9xxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_axxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_90xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_92xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_94xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_96xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_98xx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_bxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_fxxx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_0xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_1xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_2xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_3xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_8xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_9xxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_axxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_90xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_92xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_94xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_96xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_98xx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_bxxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_fxxx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 };
 
 #endif
\ No newline at end of file
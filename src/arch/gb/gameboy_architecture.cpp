@@ -44,17 +44,18 @@ char const* GameBoyArchitecture::GameBoyCpuInformation::ConvertIdentifierToName(
 
 u32 GameBoyArchitecture::GameBoyCpuInformation::ConvertNameToIdentifier(std::string const& rName) const
 {
-  static std::unordered_map<std::string, u32> s_NameToId;
-  if (s_NameToId.empty())
-  {
-    s_NameToId["a"] = GB_RegA; s_NameToId["f"] = GB_RegF; s_NameToId["af"] = GB_RegAF;
-    s_NameToId["b"] = GB_RegB; s_NameToId["c"] = GB_RegC; s_NameToId["bc"] = GB_RegBC;
-    s_NameToId["d"] = GB_RegD; s_NameToId["e"] = GB_RegE; s_NameToId["de"] = GB_RegDE;
-    s_NameToId["h"] = GB_RegH; s_NameToId["l"] = GB_RegL; s_NameToId["hl"] = GB_RegHL;
-    s_NameToId["pc"] = GB_RegPc; s_NameToId["sp"] = GB_RegSp; s_NameToId["flags"] = GB_RegFl;
-    s_NameToId["cf"] = GB_FlCf; s_NameToId["hl"] = GB_FlHf;
-    s_NameToId["nf"] = GB_FlNf; s_NameToId["zf"] = GB_FlZf;
-  }
+  static std::unordered_map<std::string, u32> const s_NameToId = []()
+  {
+    std::unordered_map<std::string, u32> NameToId;
+    NameToId["a"] = GB_RegA; NameToId["f"] = GB_RegF; NameToId["af"] = GB_RegAF;
+    NameToId["b"] = GB_RegB; NameToId["c"] = GB_RegC; NameToId["bc"] = GB_RegBC;
+    NameToId["d"] = GB_RegD; NameToId["e"] = GB_RegE; NameToId["de"] = GB_RegDE;
+    NameToId["h"] = GB_RegH; NameToId["l"] = GB_RegL; NameToId["hl"] = GB_RegHL;
+    NameToId["pc"] = GB_RegPc; NameToId["sp"] = GB_RegSp; NameToId["flags"] = GB_RegFl;
+    NameToId["cf"] = GB_FlCf; NameToId["hl"] = GB_FlHf;
+    NameToId["nf"] = GB_FlNf; NameToId["zf"] = GB_FlZf;
+    return NameToId;
+  }();
   auto itId = s_NameToId.find(rName);
   if (itId == std::end(s_NameToId))
     return 0;
@@ -126,19 +127,23 @@ bool GameBoyArchitecture::Translate(Address const& rVirtAddr, TOffset& rPhysOff)
   return true;
 }
 
-bool GameBoyArchitecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+bool GameBoyArchitecture::Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode)
 {
+  FetchWindowType Wnd(rWnd);
+  TOffset Offset = Wnd.GetOffset();
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  if (!Wnd.Read(Offset, Opcode))
+    return false;
   bool Result;
 
   if (Opcode == 0xCB)
   {
-    rBinStrm.Read(Offset + 1, Opcode);
-    Result = (this->*m_CbPrefix[Opcode])(rBinStrm, Offset + 1, rInsn);
+    if (!Wnd.Read(Offset + 1, Opcode))
+      return false;
+    Result = (this->*m_CbPrefix[Opcode])(Wnd, Offset + 1, rInsn);
   }
   else
-    Result = (this->*m_OpcodeMap[Opcode])(rBinStrm, Offset, rInsn);
+    Result = (this->*m_OpcodeMap[Opcode])(Wnd, Offset, rInsn);
 
   return Result;
 }
@@ -218,14 +223,14 @@ void GameBoyArchitecture::FormatOperand(Operand& Op, TOffset Offset)
   Op.SetName(oss.str().c_str());
 }
 
-bool GameBoyArchitecture::Insn_Invalid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Invalid(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("invalid");
   rInsn.Opcode() = GB_Invalid_Insn;
   return false;
 }
 
-bool GameBoyArchitecture::Insn_Nop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Nop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode() = GB_Nop;
   rInsn.Length() = 1;
@@ -234,7 +239,7 @@ bool GameBoyArchitecture::Insn_Nop(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Inc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u16 Reg;
   u32 Type = O_REG;
@@ -244,7 +249,7 @@ bool GameBoyArchitecture::Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.Length() = 1;
   rInsn.Opcode() = GB_Inc;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
   switch (Opcode)
   {
   case 0x03: Reg = GB_RegBC;  break;
@@ -283,7 +288,7 @@ bool GameBoyArchitecture::Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u16 Reg;
   u32 Type = O_REG;
@@ -293,7 +298,7 @@ bool GameBoyArchitecture::Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.Length() = 1;
   rInsn.Opcode() = GB_Dec;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
   switch (Opcode)
   {
   case 0x0B: Reg = GB_RegBC;  break;
@@ -332,7 +337,7 @@ bool GameBoyArchitecture::Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Add(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
@@ -346,7 +351,7 @@ bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset,
   FrstOp.Reg()  = GB_RegA;
   ScdOp.Type()  = O_REG;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   if ((Opcode & 0x0F) == 0x09)
   {
@@ -380,7 +385,7 @@ bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -395,7 +400,7 @@ bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset,
 
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -428,7 +433,7 @@ bool GameBoyArchitecture::Insn_Add(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Sub(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
@@ -440,7 +445,7 @@ bool GameBoyArchitecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset,
   FrstOp.Type()  = O_REG;
   FrstOp.Reg()   = GB_RegA;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   // A, Reg8
   if (Opcode >= 0x90 && Opcode <= 0x97)
@@ -461,7 +466,7 @@ bool GameBoyArchitecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -494,12 +499,12 @@ bool GameBoyArchitecture::Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Adc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp = rInsn.SecondOperand();
@@ -528,7 +533,7 @@ bool GameBoyArchitecture::Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -563,12 +568,12 @@ bool GameBoyArchitecture::Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Sbc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -598,7 +603,7 @@ bool GameBoyArchitecture::Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -633,7 +638,7 @@ bool GameBoyArchitecture::Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Daa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Daa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("daa");
   rInsn.Length() = 1;
@@ -641,12 +646,12 @@ bool GameBoyArchitecture::Insn_Daa(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_And(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_And(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -676,7 +681,7 @@ bool GameBoyArchitecture::Insn_And(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -710,12 +715,12 @@ bool GameBoyArchitecture::Insn_And(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Or(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Or(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -744,7 +749,7 @@ bool GameBoyArchitecture::Insn_Or(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -777,12 +782,12 @@ bool GameBoyArchitecture::Insn_Or(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Xor(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Xor(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp = rInsn.SecondOperand();
@@ -811,7 +816,7 @@ bool GameBoyArchitecture::Insn_Xor(BinaryStream const& rBinStrm, TOffset Offset,
   {
     u8 Data;
     ScdOp.Type() = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
 
     rInsn.Length() = 2;
@@ -844,7 +849,7 @@ bool GameBoyArchitecture::Insn_Xor(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Bit(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Bit(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("bit");
   rInsn.Opcode() = GB_Bit;
@@ -854,7 +859,7 @@ bool GameBoyArchitecture::Insn_Bit(BinaryStream const& rBinStrm, TOffset Offset,
   Operand& ScdOp  = rInsn.SecondOperand();
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   FrstOp.Type()  = (O_IMM8 | O_NO_REF);
   FrstOp.Value() = (Opcode >> 3) & 0x07;
@@ -890,7 +895,7 @@ bool GameBoyArchitecture::Insn_Bit(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Set(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Set(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("set");
   rInsn.Opcode() = GB_Set;
@@ -900,7 +905,7 @@ bool GameBoyArchitecture::Insn_Set(BinaryStream const& rBinStrm, TOffset Offset,
   Operand& ScdOp  = rInsn.SecondOperand();
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   FrstOp.Type()  = (O_IMM8 | O_NO_REF);
   FrstOp.Value() = (Opcode >> 3) & 0x07;
@@ -929,7 +934,7 @@ bool GameBoyArchitecture::Insn_Set(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Res(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Res(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("res");
   rInsn.Opcode() = GB_Res;
@@ -939,7 +944,7 @@ bool GameBoyArchitecture::Insn_Res(BinaryStream const& rBinStrm, TOffset Offset,
   Operand& ScdOp  = rInsn.SecondOperand();
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   FrstOp.Type()  = (O_IMM8 | O_NO_REF);
   FrstOp.Value() = (Opcode >> 3) & 0x07;
@@ -968,10 +973,10 @@ bool GameBoyArchitecture::Insn_Res(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Rl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Rl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("rl");
   rInsn.Opcode() = GB_Rl;
@@ -1013,10 +1018,10 @@ bool GameBoyArchitecture::Insn_Rl(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Rr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Rr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("rr");
   rInsn.Opcode() = GB_Rr;
@@ -1060,10 +1065,10 @@ bool GameBoyArchitecture::Insn_Rr(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Rlc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Rlc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("rlc");
   rInsn.Opcode() = GB_Rlc;
@@ -1119,10 +1124,10 @@ bool GameBoyArchitecture::Insn_Rlc(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Rrc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Rrc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("rrc");
   rInsn.Opcode() = GB_Rrc;
@@ -1178,10 +1183,10 @@ bool GameBoyArchitecture::Insn_Rrc(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Sla(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Sla(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("sla");
   rInsn.Opcode() = GB_Sla;
@@ -1231,10 +1236,10 @@ bool GameBoyArchitecture::Insn_Sla(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Sra(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Sra(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("sra");
   rInsn.Opcode() = GB_Sra;
@@ -1288,10 +1293,10 @@ bool GameBoyArchitecture::Insn_Sra(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Srl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Srl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("srl");
   rInsn.Opcode() = GB_Srl;
@@ -1357,10 +1362,10 @@ bool GameBoyArchitecture::Insn_Srl(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Swap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("swap");
   rInsn.Opcode() = GB_Swap;
@@ -1404,7 +1409,7 @@ bool GameBoyArchitecture::Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Cpl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Cpl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("cpl");
   rInsn.Length() = 1;
@@ -1425,7 +1430,7 @@ bool GameBoyArchitecture::Insn_Cpl(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ccf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ccf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("ccf");
   rInsn.Length() = 1;
@@ -1446,7 +1451,7 @@ bool GameBoyArchitecture::Insn_Ccf(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Scf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Scf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("scf");
   rInsn.Length() = 1;
@@ -1457,12 +1462,12 @@ bool GameBoyArchitecture::Insn_Scf(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Cp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   bool Res = false;
   u8 Opcode;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -1494,7 +1499,7 @@ bool GameBoyArchitecture::Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset,
 
     u8 Data;
     ScdOp.Type()   = (O_IMM8 | O_NO_REF);
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value()  = Data;
 
     rInsn.Length() = 2;
@@ -1525,7 +1530,7 @@ bool GameBoyArchitecture::Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset,
   return Res;
 }
 
-bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ld(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8  Opcode;
   u32 O1Type    = O_NONE,         O2Type      = O_NONE;
@@ -1534,7 +1539,7 @@ bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset,
   rInsn.SetName("ld");
   rInsn.Opcode() = GB_Ld;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   switch (Opcode)
   {
@@ -1667,14 +1672,14 @@ bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset,
   if ((O1Type & DS_MASK) == DS_8BIT)
   {
     u8 Data;
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     FstOp.Value() = Data;
     InsnLen++;
   }
   else if ((O1Type & DS_MASK) == DS_16BIT)
   {
     u16 Data;
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     FstOp.Value() = Data;
     InsnLen += 2;
   }
@@ -1682,14 +1687,14 @@ bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset,
   if ((O2Type & DS_MASK) == DS_8BIT)
   {
     u8 Data;
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
     InsnLen++;
   }
   else if ((O2Type & DS_MASK) == DS_16BIT)
   {
     u16 Data;
-    rBinStrm.Read(Offset + 1, Data);
+    rWnd.Read(Offset + 1, Data);
     ScdOp.Value() = Data;
     InsnLen += 2;
   }
@@ -1719,14 +1724,14 @@ bool GameBoyArchitecture::Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ldi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("ldi");
   rInsn.Opcode()  = GB_Ldi;
   rInsn.Length()  = 1;
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -1786,14 +1791,14 @@ bool GameBoyArchitecture::Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ldd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("ldd");
   rInsn.Opcode()  = GB_Ldd;
   rInsn.Length()  = 1;
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   Operand& FrstOp = rInsn.FirstOperand();
   Operand& ScdOp  = rInsn.SecondOperand();
@@ -1851,16 +1856,16 @@ bool GameBoyArchitecture::Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ldh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ldh(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("ldh");
   rInsn.Opcode()  = GB_Ldh;
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   u8 Data;
-  rBinStrm.Read(Offset + 1, Data);
+  rWnd.Read(Offset + 1, Data);
 
   rInsn.Length()  = Opcode & 0x0f ? 1 : 2;
   Operand& FrstOp = rInsn.FirstOperand();
@@ -1918,7 +1923,7 @@ bool GameBoyArchitecture::Insn_Ldh(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ldhl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ldhl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("ld");
   rInsn.Length()               = 2;
@@ -1929,7 +1934,7 @@ bool GameBoyArchitecture::Insn_Ldhl(BinaryStream const& rBinStrm, TOffset Offset
   rInsn.SecondOperand().Type() = O_REG;
   rInsn.SecondOperand().Reg()  = GB_RegSp;
   s8 Immediate;
-  rBinStrm.Read(Offset + 1, Immediate);
+  rWnd.Read(Offset + 1, Immediate);
   rInsn.ThirdOperand().Type()  = O_IMM8;
   rInsn.ThirdOperand().Value() = Immediate;
 
@@ -1955,12 +1960,12 @@ bool GameBoyArchitecture::Insn_Ldhl(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Push(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
   u16 Reg;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("push");
   rInsn.Opcode() = GB_Push;
@@ -2004,12 +2009,12 @@ bool GameBoyArchitecture::Insn_Push(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Pop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
   u16 Reg;
 
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.SetName("pop");
   rInsn.Opcode() = GB_Pop;
@@ -2053,12 +2058,12 @@ bool GameBoyArchitecture::Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Jr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Jr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
   s8 Relative;
-  rBinStrm.Read(Offset, Opcode);
-  rBinStrm.Read(Offset + 1, Relative);
+  rWnd.Read(Offset, Opcode);
+  rWnd.Read(Offset + 1, Relative);
 
   rInsn.Length()  = 2;
   rInsn.Opcode()  = GB_Jr;
@@ -2101,10 +2106,10 @@ bool GameBoyArchitecture::Insn_Jr(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Jp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Jp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.Opcode()  = GB_Jp;
   rInsn.SubType() = Instruction::JumpType;
@@ -2120,7 +2125,7 @@ bool GameBoyArchitecture::Insn_Jp(BinaryStream const& rBinStrm, TOffset Offset,
   }
 
   u16 Absolute;
-  rBinStrm.Read(Offset + 1, Absolute);
+  rWnd.Read(Offset + 1, Absolute);
 
   rInsn.Length()               = 3;
   rInsn.FirstOperand().Type()  = O_ABS16;
@@ -2160,12 +2165,12 @@ bool GameBoyArchitecture::Insn_Jp(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Call(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Call(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   u8 Opcode;
   u16 Absolute;
-  rBinStrm.Read(Offset, Opcode);
-  rBinStrm.Read(Offset + 1, Absolute);
+  rWnd.Read(Offset, Opcode);
+  rWnd.Read(Offset + 1, Absolute);
 
   rInsn.Length()  = 3;
   rInsn.Opcode()  = GB_Call;
@@ -2234,14 +2239,14 @@ bool GameBoyArchitecture::Insn_Call(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Rst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Rst(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("rst");
   rInsn.Opcode() = GB_Rst;
   rInsn.Length() = 1;
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   rInsn.FirstOperand().Type()  = (O_IMM8 | O_NO_REF);
   rInsn.FirstOperand().Value() = ((Opcode >> 3) & 0x07) * 0x08;
@@ -2278,14 +2283,14 @@ bool GameBoyArchitecture::Insn_Rst(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ret(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode()        = GB_Ret;
   rInsn.Length()        = 1;
   rInsn.SubType() = Instruction::ReturnType;
 
   u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
+  rWnd.Read(Offset, Opcode);
 
   u32 Flags = 0;
   bool Equal = true;
@@ -2330,7 +2335,7 @@ bool GameBoyArchitecture::Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Reti(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.SetName("reti");
   rInsn.Opcode()        = GB_Reti;
@@ -2358,7 +2363,7 @@ bool GameBoyArchitecture::Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Halt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Halt(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode() = GB_Halt;
   rInsn.Length() = 1;
@@ -2367,7 +2372,7 @@ bool GameBoyArchitecture::Insn_Halt(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Stop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Stop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode() = GB_Stop;
   rInsn.Length() = 1;
@@ -2376,7 +2381,7 @@ bool GameBoyArchitecture::Insn_Stop(BinaryStream const& rBinStrm, TOffset Offset
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Ei(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Ei(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode() = GB_Ei;
   rInsn.Length() = 1;
@@ -2385,7 +2390,7 @@ bool GameBoyArchitecture::Insn_Ei(BinaryStream const& rBinStrm, TOffset Offset,
   return true;
 }
 
-bool GameBoyArchitecture::Insn_Di(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn)
+bool GameBoyArchitecture::Insn_Di(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn)
 {
   rInsn.Opcode() = GB_Di;
   rInsn.Length() = 1;
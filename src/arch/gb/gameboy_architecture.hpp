@@ -38,11 +38,16 @@ private:
   } m_CpuInfo;
 
 public:
+  typedef EndianFetchWindow<LittleEndian> FetchWindowType;
+
   GameBoyArchitecture(void) : Architecture(MEDUSA_ARCH_TAG('n','g','b')) {}
 
+  using Architecture::Disassemble;
+
   virtual std::string           GetName(void) const { return "Nintendo GameBoy Z80"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhyslOff);
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode);
+  virtual u8                    GetMaximumInstructionLength(void) const { return 3; }
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector GbModes;
@@ -56,7 +61,7 @@ public:
   virtual MemoryContext*        MakeMemoryContext(void) const { return new MemoryContext(m_CpuInfo); }
 
 private:
-  typedef bool (GameBoyArchitecture:: *TDisassembler)(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  typedef bool (GameBoyArchitecture:: *TDisassembler)(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
   typedef struct  SRegName
   {
@@ -71,55 +76,55 @@ private:
   u16  GetRegisterByOpcode(u8 Opcode);
   void FormatOperand(Operand& Op, TOffset Offset);
 
-  bool Insn_Invalid(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Nop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  bool Insn_Inc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Add(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sub(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Adc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sbc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Daa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  bool Insn_And(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Or(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Xor(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Bit(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Set(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Res(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rlc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rrc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sla(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Sra(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Srl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Swap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cpl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ccf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Scf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Cp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  bool Insn_Ld(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ldi(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ldd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ldh(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ldhl(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Push(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Pop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  bool Insn_Jr(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Jp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Call(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Rst(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ret(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Reti(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-
-  bool Insn_Halt(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Stop(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Ei(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
-  bool Insn_Di(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn);
+  bool Insn_Invalid(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Nop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  bool Insn_Inc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Add(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sub(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Adc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sbc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Daa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  bool Insn_And(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Or(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Xor(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Bit(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Set(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Res(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rlc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rrc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sla(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Sra(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Srl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Swap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cpl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ccf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Scf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Cp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  bool Insn_Ld(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldi(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldh(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ldhl(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Push(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Pop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  bool Insn_Jr(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Jp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Call(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Rst(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ret(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Reti(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  bool Insn_Halt(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Stop(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Ei(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  bool Insn_Di(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 };
 
 #endif // _GAMEBOY_ARCHITECTURE_
\ No newline at end of file
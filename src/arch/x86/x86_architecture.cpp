@@ -90,49 +90,50 @@ char const* X86Architecture::X86CpuInformation::ConvertIdentifierToName(u32 Id)
 
 u32 X86Architecture::X86CpuInformation::ConvertNameToIdentifier(std::string const& rName) const
 {
-  static std::unordered_map<std::string, u32> s_NameToId;
-  if (s_NameToId.empty())
-    {
-    s_NameToId["al"] = X86_Reg_Al; s_NameToId["cl"] = X86_Reg_Cl; s_NameToId["dl"] = X86_Reg_Dl; s_NameToId["bl"] = X86_Reg_Bl;
-    s_NameToId["ah"] = X86_Reg_Ah; s_NameToId["ch"] = X86_Reg_Ch; s_NameToId["dh"] = X86_Reg_Dh; s_NameToId["bh"] = X86_Reg_Bh;
-    s_NameToId["spl"] = X86_Reg_Spl; s_NameToId["bpl"] = X86_Reg_Bpl; s_NameToId["sil"] = X86_Reg_Sil; s_NameToId["dil"] = X86_Reg_Dil;
-    s_NameToId["r8b"] = X86_Reg_R8b; s_NameToId["r9b"] = X86_Reg_R9b; s_NameToId["r10b"] = X86_Reg_R10b; s_NameToId["r11b"] = X86_Reg_R11b;
-    s_NameToId["r12b"] = X86_Reg_R12b; s_NameToId["r13b"] = X86_Reg_R13b; s_NameToId["r14b"] = X86_Reg_R14b; s_NameToId["r15b"] = X86_Reg_R15b;
-    s_NameToId["ax"] = X86_Reg_Ax; s_NameToId["cx"] = X86_Reg_Cx; s_NameToId["dx"] = X86_Reg_Dx; s_NameToId["bx"] = X86_Reg_Bx;
-    s_NameToId["sp"] = X86_Reg_Sp; s_NameToId["bp"] = X86_Reg_Bp; s_NameToId["si"] = X86_Reg_Si; s_NameToId["di"] = X86_Reg_Di;
-    s_NameToId["r8w"] = X86_Reg_R8w; s_NameToId["r9w"] = X86_Reg_R9w; s_NameToId["r10w"] = X86_Reg_R10w; s_NameToId["r11w"] = X86_Reg_R11w;
-    s_NameToId["r12w"] = X86_Reg_R12w; s_NameToId["r13w"] = X86_Reg_R13w; s_NameToId["r14w"] = X86_Reg_R14w; s_NameToId["r15w"] = X86_Reg_R15w;
-    s_NameToId["ip"] = X86_Reg_Ip; s_NameToId["flags"] = X86_Reg_Flags; s_NameToId["es"] = X86_Reg_Es; s_NameToId["cs"] = X86_Reg_Cs;
-    s_NameToId["ss"] = X86_Reg_Ss; s_NameToId["ds"] = X86_Reg_Ds; s_NameToId["fs"] = X86_Reg_Fs; s_NameToId["gs"] = X86_Reg_Gs;
-    s_NameToId["seg6"] = X86_Reg_Seg6; s_NameToId["seg7"] = X86_Reg_Seg7; s_NameToId["eax"] = X86_Reg_Eax; s_NameToId["ecx"] = X86_Reg_Ecx;
-    s_NameToId["edx"] = X86_Reg_Edx; s_NameToId["ebx"] = X86_Reg_Ebx; s_NameToId["esp"] = X86_Reg_Esp; s_NameToId["ebp"] = X86_Reg_Ebp;
-    s_NameToId["esi"] = X86_Reg_Esi; s_NameToId["edi"] = X86_Reg_Edi; s_NameToId["r8d"] = X86_Reg_R8d; s_NameToId["r9d"] = X86_Reg_R9d;
-    s_NameToId["r10d"] = X86_Reg_R10d; s_NameToId["r11d"] = X86_Reg_R11d; s_NameToId["r12d"] = X86_Reg_R12d; s_NameToId["r13d"] = X86_Reg_R13d;
-    s_NameToId["r14d"] = X86_Reg_R14d; s_NameToId["r15d"] = X86_Reg_R15d; s_NameToId["eip"] = X86_Reg_Eip; s_NameToId["eflags"] = X86_Reg_Eflags;
-    s_NameToId["cr0"] = X86_Reg_Cr0; s_NameToId["cr1"] = X86_Reg_Cr1; s_NameToId["cr2"] = X86_Reg_Cr2; s_NameToId["cr3"] = X86_Reg_Cr3;
-    s_NameToId["cr4"] = X86_Reg_Cr4; s_NameToId["cr5"] = X86_Reg_Cr5; s_NameToId["cr6"] = X86_Reg_Cr6; s_NameToId["cr7"] = X86_Reg_Cr7;
-    s_NameToId["cr8"] = X86_Reg_Cr8; s_NameToId["cr9"] = X86_Reg_Cr9; s_NameToId["cr10"] = X86_Reg_Cr10; s_NameToId["cr11"] = X86_Reg_Cr11;
-    s_NameToId["cr12"] = X86_Reg_Cr12; s_NameToId["cr13"] = X86_Reg_Cr13; s_NameToId["cr14"] = X86_Reg_Cr14; s_NameToId["cr15"] = X86_Reg_Cr15;
-    s_NameToId["dr0"] = X86_Reg_Dr0; s_NameToId["dr1"] = X86_Reg_Dr1; s_NameToId["dr2"] = X86_Reg_Dr2; s_NameToId["dr3"] = X86_Reg_Dr3;
-    s_NameToId["dr4"] = X86_Reg_Dr4; s_NameToId["dr5"] = X86_Reg_Dr5; s_NameToId["dr6"] = X86_Reg_Dr6; s_NameToId["dr7"] = X86_Reg_Dr7;
-    s_NameToId["dr8"] = X86_Reg_Dr8; s_NameToId["dr9"] = X86_Reg_Dr9; s_NameToId["dr10"] = X86_Reg_Dr10; s_NameToId["dr11"] = X86_Reg_Dr11;
-    s_NameToId["dr12"] = X86_Reg_Dr12; s_NameToId["dr13"] = X86_Reg_Dr13; s_NameToId["dr14"] = X86_Reg_Dr14; s_NameToId["dr15"] = X86_Reg_Dr15;
-    s_NameToId["tr0"] = X86_Reg_Tr0; s_NameToId["tr1"] = X86_Reg_Tr1; s_NameToId["tr2"] = X86_Reg_Tr2; s_NameToId["tr3"] = X86_Reg_Tr3;
-    s_NameToId["tr4"] = X86_Reg_Tr4; s_NameToId["tr5"] = X86_Reg_Tr5; s_NameToId["tr6"] = X86_Reg_Tr6; s_NameToId["tr7"] = X86_Reg_Tr7;
-    s_NameToId["rax"] = X86_Reg_Rax; s_NameToId["rcx"] = X86_Reg_Rcx; s_NameToId["rdx"] = X86_Reg_Rdx; s_NameToId["rbx"] = X86_Reg_Rbx;
-    s_NameToId["rsp"] = X86_Reg_Rsp; s_NameToId["rbp"] = X86_Reg_Rbp; s_NameToId["rsi"] = X86_Reg_Rsi; s_NameToId["rdi"] = X86_Reg_Rdi;
-    s_NameToId["r8"] = X86_Reg_R8; s_NameToId["r9"] = X86_Reg_R9; s_NameToId["r10"] = X86_Reg_R10; s_NameToId["r11"] = X86_Reg_R11;
-    s_NameToId["r12"] = X86_Reg_R12; s_NameToId["r13"] = X86_Reg_R13; s_NameToId["r14"] = X86_Reg_R14; s_NameToId["r15"] = X86_Reg_R15;
-    s_NameToId["rip"] = X86_Reg_Rip; s_NameToId["rflags"] = X86_Reg_Rflags; s_NameToId["st0"] = X86_Reg_St0; s_NameToId["st1"] = X86_Reg_St1;
-    s_NameToId["st2"] = X86_Reg_St2; s_NameToId["st3"] = X86_Reg_St3; s_NameToId["st4"] = X86_Reg_St4; s_NameToId["st5"] = X86_Reg_St5;
-    s_NameToId["st6"] = X86_Reg_St6; s_NameToId["st7"] = X86_Reg_St7; s_NameToId["mm0"] = X86_Reg_Mm0; s_NameToId["mm1"] = X86_Reg_Mm1;
-    s_NameToId["mm2"] = X86_Reg_Mm2; s_NameToId["mm3"] = X86_Reg_Mm3; s_NameToId["mm4"] = X86_Reg_Mm4; s_NameToId["mm5"] = X86_Reg_Mm5;
-    s_NameToId["mm6"] = X86_Reg_Mm6; s_NameToId["mm7"] = X86_Reg_Mm7; s_NameToId["xmm0"] = X86_Reg_Xmm0; s_NameToId["xmm1"] = X86_Reg_Xmm1;
-    s_NameToId["xmm2"] = X86_Reg_Xmm2; s_NameToId["xmm3"] = X86_Reg_Xmm3; s_NameToId["xmm4"] = X86_Reg_Xmm4; s_NameToId["xmm5"] = X86_Reg_Xmm5;
-    s_NameToId["xmm6"] = X86_Reg_Xmm6; s_NameToId["xmm7"] = X86_Reg_Xmm7; s_NameToId["xmm8"] = X86_Reg_Xmm8; s_NameToId["xmm9"] = X86_Reg_Xmm9;
-    s_NameToId["xmm10"] = X86_Reg_Xmm10; s_NameToId["xmm11"] = X86_Reg_Xmm11; s_NameToId["xmm12"] = X86_Reg_Xmm12; s_NameToId["xmm13"] = X86_Reg_Xmm13;
-    s_NameToId["xmm14"] = X86_Reg_Xmm14; s_NameToId["xmm15"] = X86_Reg_Xmm15;
-    }
+  static std::unordered_map<std::string, u32> const s_NameToId = []()
+  {
+    std::unordered_map<std::string, u32> NameToId;
+    NameToId["al"] = X86_Reg_Al; NameToId["cl"] = X86_Reg_Cl; NameToId["dl"] = X86_Reg_Dl; NameToId["bl"] = X86_Reg_Bl;
+    NameToId["ah"] = X86_Reg_Ah; NameToId["ch"] = X86_Reg_Ch; NameToId["dh"] = X86_Reg_Dh; NameToId["bh"] = X86_Reg_Bh;
+    NameToId["spl"] = X86_Reg_Spl; NameToId["bpl"] = X86_Reg_Bpl; NameToId["sil"] = X86_Reg_Sil; NameToId["dil"] = X86_Reg_Dil;
+    NameToId["r8b"] = X86_Reg_R8b; NameToId["r9b"] = X86_Reg_R9b; NameToId["r10b"] = X86_Reg_R10b; NameToId["r11b"] = X86_Reg_R11b;
+    NameToId["r12b"] = X86_Reg_R12b; NameToId["r13b"] = X86_Reg_R13b; NameToId["r14b"] = X86_Reg_R14b; NameToId["r15b"] = X86_Reg_R15b;
+    NameToId["ax"] = X86_Reg_Ax; NameToId["cx"] = X86_Reg_Cx; NameToId["dx"] = X86_Reg_Dx; NameToId["bx"] = X86_Reg_Bx;
+    NameToId["sp"] = X86_Reg_Sp; NameToId["bp"] = X86_Reg_Bp; NameToId["si"] = X86_Reg_Si; NameToId["di"] = X86_Reg_Di;
+    NameToId["r8w"] = X86_Reg_R8w; NameToId["r9w"] = X86_Reg_R9w; NameToId["r10w"] = X86_Reg_R10w; NameToId["r11w"] = X86_Reg_R11w;
+    NameToId["r12w"] = X86_Reg_R12w; NameToId["r13w"] = X86_Reg_R13w; NameToId["r14w"] = X86_Reg_R14w; NameToId["r15w"] = X86_Reg_R15w;
+    NameToId["ip"] = X86_Reg_Ip; NameToId["flags"] = X86_Reg_Flags; NameToId["es"] = X86_Reg_Es; NameToId["cs"] = X86_Reg_Cs;
+    NameToId["ss"] = X86_Reg_Ss; NameToId["ds"] = X86_Reg_Ds; NameToId["fs"] = X86_Reg_Fs; NameToId["gs"] = X86_Reg_Gs;
+    NameToId["seg6"] = X86_Reg_Seg6; NameToId["seg7"] = X86_Reg_Seg7; NameToId["eax"] = X86_Reg_Eax; NameToId["ecx"] = X86_Reg_Ecx;
+    NameToId["edx"] = X86_Reg_Edx; NameToId["ebx"] = X86_Reg_Ebx; NameToId["esp"] = X86_Reg_Esp; NameToId["ebp"] = X86_Reg_Ebp;
+    NameToId["esi"] = X86_Reg_Esi; NameToId["edi"] = X86_Reg_Edi; NameToId["r8d"] = X86_Reg_R8d; NameToId["r9d"] = X86_Reg_R9d;
+    NameToId["r10d"] = X86_Reg_R10d; NameToId["r11d"] = X86_Reg_R11d; NameToId["r12d"] = X86_Reg_R12d; NameToId["r13d"] = X86_Reg_R13d;
+    NameToId["r14d"] = X86_Reg_R14d; NameToId["r15d"] = X86_Reg_R15d; NameToId["eip"] = X86_Reg_Eip; NameToId["eflags"] = X86_Reg_Eflags;
+    NameToId["cr0"] = X86_Reg_Cr0; NameToId["cr1"] = X86_Reg_Cr1; NameToId["cr2"] = X86_Reg_Cr2; NameToId["cr3"] = X86_Reg_Cr3;
+    NameToId["cr4"] = X86_Reg_Cr4; NameToId["cr5"] = X86_Reg_Cr5; NameToId["cr6"] = X86_Reg_Cr6; NameToId["cr7"] = X86_Reg_Cr7;
+    NameToId["cr8"] = X86_Reg_Cr8; NameToId["cr9"] = X86_Reg_Cr9; NameToId["cr10"] = X86_Reg_Cr10; NameToId["cr11"] = X86_Reg_Cr11;
+    NameToId["cr12"] = X86_Reg_Cr12; NameToId["cr13"] = X86_Reg_Cr13; NameToId["cr14"] = X86_Reg_Cr14; NameToId["cr15"] = X86_Reg_Cr15;
+    NameToId["dr0"] = X86_Reg_Dr0; NameToId["dr1"] = X86_Reg_Dr1; NameToId["dr2"] = X86_Reg_Dr2; NameToId["dr3"] = X86_Reg_Dr3;
+    NameToId["dr4"] = X86_Reg_Dr4; NameToId["dr5"] = X86_Reg_Dr5; NameToId["dr6"] = X86_Reg_Dr6; NameToId["dr7"] = X86_Reg_Dr7;
+    NameToId["dr8"] = X86_Reg_Dr8; NameToId["dr9"] = X86_Reg_Dr9; NameToId["dr10"] = X86_Reg_Dr10; NameToId["dr11"] = X86_Reg_Dr11;
+    NameToId["dr12"] = X86_Reg_Dr12; NameToId["dr13"] = X86_Reg_Dr13; NameToId["dr14"] = X86_Reg_Dr14; NameToId["dr15"] = X86_Reg_Dr15;
+    NameToId["tr0"] = X86_Reg_Tr0; NameToId["tr1"] = X86_Reg_Tr1; NameToId["tr2"] = X86_Reg_Tr2; NameToId["tr3"] = X86_Reg_Tr3;
+    NameToId["tr4"] = X86_Reg_Tr4; NameToId["tr5"] = X86_Reg_Tr5; NameToId["tr6"] = X86_Reg_Tr6; NameToId["tr7"] = X86_Reg_Tr7;
+    NameToId["rax"] = X86_Reg_Rax; NameToId["rcx"] = X86_Reg_Rcx; NameToId["rdx"] = X86_Reg_Rdx; NameToId["rbx"] = X86_Reg_Rbx;
+    NameToId["rsp"] = X86_Reg_Rsp; NameToId["rbp"] = X86_Reg_Rbp; NameToId["rsi"] = X86_Reg_Rsi; NameToId["rdi"] = X86_Reg_Rdi;
+    NameToId["r8"] = X86_Reg_R8; NameToId["r9"] = X86_Reg_R9; NameToId["r10"] = X86_Reg_R10; NameToId["r11"] = X86_Reg_R11;
+    NameToId["r12"] = X86_Reg_R12; NameToId["r13"] = X86_Reg_R13; NameToId["r14"] = X86_Reg_R14; NameToId["r15"] = X86_Reg_R15;
+    NameToId["rip"] = X86_Reg_Rip; NameToId["rflags"] = X86_Reg_Rflags; NameToId["st0"] = X86_Reg_St0; NameToId["st1"] = X86_Reg_St1;
+    NameToId["st2"] = X86_Reg_St2; NameToId["st3"] = X86_Reg_St3; NameToId["st4"] = X86_Reg_St4; NameToId["st5"] = X86_Reg_St5;
+    NameToId["st6"] = X86_Reg_St6; NameToId["st7"] = X86_Reg_St7; NameToId["mm0"] = X86_Reg_Mm0; NameToId["mm1"] = X86_Reg_Mm1;
+    NameToId["mm2"] = X86_Reg_Mm2; NameToId["mm3"] = X86_Reg_Mm3; NameToId["mm4"] = X86_Reg_Mm4; NameToId["mm5"] = X86_Reg_Mm5;
+    NameToId["mm6"] = X86_Reg_Mm6; NameToId["mm7"] = X86_Reg_Mm7; NameToId["xmm0"] = X86_Reg_Xmm0; NameToId["xmm1"] = X86_Reg_Xmm1;
+    NameToId["xmm2"] = X86_Reg_Xmm2; NameToId["xmm3"] = X86_Reg_Xmm3; NameToId["xmm4"] = X86_Reg_Xmm4; NameToId["xmm5"] = X86_Reg_Xmm5;
+    NameToId["xmm6"] = X86_Reg_Xmm6; NameToId["xmm7"] = X86_Reg_Xmm7; NameToId["xmm8"] = X86_Reg_Xmm8; NameToId["xmm9"] = X86_Reg_Xmm9;
+    NameToId["xmm10"] = X86_Reg_Xmm10; NameToId["xmm11"] = X86_Reg_Xmm11; NameToId["xmm12"] = X86_Reg_Xmm12; NameToId["xmm13"] = X86_Reg_Xmm13;
+    NameToId["xmm14"] = X86_Reg_Xmm14; NameToId["xmm15"] = X86_Reg_Xmm15;
+    return NameToId;
+  }();
 
   auto itId = s_NameToId.find(rName);
   if (itId == std::end(s_NameToId))
@@ -412,11 +413,42 @@ OperationExpression* X86Architecture::ExtractFlag(Instruction& rInsn, u32 Flag)
       /**/new ConstantExpression(RegFlagsSize, 1));
 }
 
-bool X86Architecture::Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode)
+// The specialization is picked once, operand and address sizes are constants in the handlers
+bool X86Architecture::Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode)
 {
-  u8 Opcode;
-  rBinStrm.Read(Offset, Opcode);
-  bool Res = (this->*m_Table_1[Opcode])(rBinStrm, Offset + 1, rInsn, Mode);
+  FetchWindowType Wnd(rWnd);
+  bool Res;
+
+  switch (Mode)
+  {
+  case X86_Bit_16: Res = Disassemble<X86_Bit_16>(Wnd, Wnd.GetOffset(), rInsn); break;
+  case X86_Bit_32: Res = Disassemble<X86_Bit_32>(Wnd, Wnd.GetOffset(), rInsn); break;
+  case X86_Bit_64: Res = Disassemble<X86_Bit_64>(Wnd, Wnd.GetOffset(), rInsn); break;
+  default:         return false;
+  }
+
   rInsn.SetName(m_Mnemonic[rInsn.GetOpcode()]);
   return Res;
 }
+
+bool X86Architecture::BuildSemantic(Instruction& rInsn, u32 SemanticId)
+{
+  if (SemanticId >= sizeof(m_Semantic) / sizeof(*m_Semantic))
+    return false;
+  if (!(this->*m_Semantic[SemanticId])(rInsn))
+    return false;
+
+  // The simplified semantic is kept by the instruction, so it's only simplified once
+  if (UseSimplifiedSemantic())
+    rInsn.SimplifySemantic();
+  return true;
+}
+
+// Semantics only depend on the decoded instruction, so they can be built later
+void X86Architecture::ApplySemantic(Instruction& rInsn, u32 SemanticId)
+{
+  if (UseLazySemantic())
+    rInsn.SetSemanticBuilder(this, SemanticId);
+  else
+    BuildSemantic(rInsn, SemanticId);
+}
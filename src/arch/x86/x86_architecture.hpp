@@ -74,13 +74,20 @@ private:
   };
 
 public:
+  typedef EndianFetchWindow<LittleEndian> FetchWindowType;
+
   X86Architecture(void);
   ~X86Architecture(void) {}
 
+  using Architecture::Disassemble;
+
   virtual std::string           GetName(void) const { return "Intel x86"; }
   virtual bool                  Translate(Address const& rVirtAddr, TOffset& rPhysOff) { return false; }
   virtual EEndianness           GetEndianness(void) { return LittleEndian; }
-  virtual bool                  Disassemble(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  virtual bool                  Disassemble(FetchWindow const& rWnd, Instruction& rInsn, u8 Mode);
+  virtual bool                  DecodeLength(FetchWindow const& rWnd, u8 Mode, u16& rLength, u8& rSubType);
+  virtual u8                    GetMaximumInstructionLength(void) const { return 15; }
+  virtual bool                  BuildSemantic(Instruction& rInsn, u32 SemanticId);
   virtual NamedModeVector       GetModes(void) const
   {
     NamedModeVector X86Modes;
@@ -102,8 +109,7 @@ public:
     BinaryStream  const& rBinStrm,
     Address       const& rAddr,
     Instruction   const& rInsn,
-    std::string        & rStrCell,
-    Cell::Mark::List   & rMarks) const;
+    CellText           & rText) const;
 
   virtual CpuInformation const* GetCpuInformation(void) const { return &m_CpuInfo; }
   virtual CpuContext*           MakeCpuContext(void) const { return new X86CpuContext(0, m_CpuInfo); }
@@ -117,6 +123,27 @@ public:
   virtual OperationExpression*  ExtractFlag(Instruction& rInsn, u32 Flag);
 
 private:
+  //! The mode is a template parameter, the generated handlers are compiled once for 16-bit, 32-bit and 64-bit.
+  template<u8 Mode> bool Disassemble(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  void ApplySemantic(Instruction& rInsn, u32 SemanticId);
+
+  /*! The length decoder walks chains of rules generated from the same description as the decoder.
+   * The first rule of a chain which matches the mode, the prefixes and the tested byte applies.
+   */
+  struct LengthRule
+  {
+    u32 m_Prefix;  // Flag set by a prefix rule, or X86_Prefix_REX_w for a d64 instruction
+    u8  m_Kind;
+    u8  m_Modes;   // Bit 0 for 16-bit, bit 1 for 32-bit and bit 2 for 64-bit
+    u8  m_Test;
+    u8  m_Byte;
+    u8  m_Vendor;
+    u8  m_Arg[2];
+    u8  m_Length;
+    u8  m_SubType;
+    u8  m_Oprd[4];
+  };
+
 #include "x86_operand.ipp"
 #include "x86_opcode.ipp"
 
@@ -141,8 +168,7 @@ private:
   static const char * m_Mnemonic[];
 
   void                FormatOperand(
-    std::ostringstream & rInsnBuf,
-    Cell::Mark::List   & rMarks,
+    CellText           & rText,
     Document      const& rDoc,
     TOffset              Offset,
     Instruction   const& rInsn,
@@ -150,4 +176,10 @@ private:
   void                ApplySegmentOverridePrefix(Instruction& rInsn, Operand* pOprd);
 };
 
+//! Operand decoders are only used by the generated handlers, each translation unit instantiates its own for every mode.
+#define X86_INSTANTIATE_DECODER(Name)                                                                                        \
+  template bool X86Architecture::Name<X86_Bit_16>(X86Architecture::FetchWindowType const&, TOffset, Instruction&, Operand*); \
+  template bool X86Architecture::Name<X86_Bit_32>(X86Architecture::FetchWindowType const&, TOffset, Instruction&, Operand*); \
+  template bool X86Architecture::Name<X86_Bit_64>(X86Architecture::FetchWindowType const&, TOffset, Instruction&, Operand*)
+
 #endif // !_X86_ARCHITECTURE_
\ No newline at end of file
@@ -351,6 +351,46 @@ enum X86_Bit
   X86_Bit_64 = 64
 };
 
+// Kinds of rule used by the length decoder
+enum X86_LengthKind
+{
+  X86_Length_Fetch,       // Reads the prefix or suffix tested by the next rules
+  X86_Length_Invalid,
+  X86_Length_Prefix,
+  X86_Length_Table,
+  X86_Length_Group,
+  X86_Length_Fpu,
+  X86_Length_Instruction
+};
+
+enum X86_LengthTest
+{
+  X86_LengthTest_Prefix   = 0x01, // Byte before the opcode
+  X86_LengthTest_Suffix   = 0x02, // Byte after the opcode
+  X86_LengthTest_NoAdSize = 0x04,
+  X86_LengthTest_AdSize   = 0x08,
+  X86_LengthTest_RexB     = 0x10,
+  X86_LengthTest_RexW     = 0x20,
+  X86_LengthTest_Vendor   = 0x40
+};
+
+enum X86_LengthOperand
+{
+  X86_LengthOprd_None,    // Register or implicit operand
+  X86_LengthOprd_Invalid, // Operand the decoder doesn't handle
+  X86_LengthOprd_ModRm,   // Register or memory
+  X86_LengthOprd_ModRmReg,
+  X86_LengthOprd_Mem,
+  X86_LengthOprd_Mem32,   // Memory, not available in 16-bit
+  X86_LengthOprd_Ib,
+  X86_LengthOprd_Iw,
+  X86_LengthOprd_Iz,
+  X86_LengthOprd_Iv,
+  X86_LengthOprd_Jz,
+  X86_LengthOprd_Moffs,
+  X86_LengthOprd_Ap
+};
+
 enum X86_Condition
 {
   X86_Cond_None,
@@ -6,30 +6,30 @@ bool X86Architecture::FormatInstruction(
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
   Instruction   const& rInsn,
-  std::string        & rStrCell,
-  Cell::Mark::List   & rMarks) const
+  CellText           & rText) const
 {
   char Sep = '\0';
-  std::ostringstream oss;
+  size_t MnemBeg = rText.GetLength();
 
   if (rInsn.GetPrefix())
   {
     if (rInsn.GetPrefix() & X86_Prefix_Lock)
-      oss << "lock ";
+      rText.Write("lock ");
     else if (rInsn.GetPrefix() & X86_Prefix_RepNz)
-      oss << "repnz ";
+      rText.Write("repnz ");
     else if (rInsn.GetPrefix() & X86_Prefix_Rep)
     {
       // 0xF3 is only used as REPZ prefix for cmps and scas instructions.
       if (rInsn.GetOpcode() == X86_Opcode_Cmps || rInsn.GetOpcode() == X86_Opcode_Scas)
-        oss << "repz ";
+        rText.Write("repz ");
       else
-        oss << "rep ";
+        rText.Write("rep ");
     }
   }
 
-  oss << m_Mnemonic[rInsn.GetOpcode()] << " ";
-  rMarks.push_back(Cell::Mark(Cell::Mark::MnemonicType, oss.str().length()));
+  rText.Write(m_Mnemonic[rInsn.GetOpcode()]);
+  rText.Write(' ');
+  rText.Mark(Cell::Mark::MnemonicType, rText.GetLength() - MnemBeg);
 
   for (unsigned int i = 0; i < OPERAND_NO; ++i)
   {
@@ -41,11 +41,12 @@ bool X86Architecture::FormatInstruction(
 
     if (Sep != '\0')
     {
-      oss << Sep << " ";
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 2));
+      rText.Write(Sep);
+      rText.Write(' ');
+      rText.Mark(Cell::Mark::OperatorType, 2);
     }
 
-    FormatOperand(oss, rMarks, rDoc, rAddr.GetOffset(), rInsn, pOprd);
+    FormatOperand(rText, rDoc, rAddr.GetOffset(), rInsn, pOprd);
 
     Sep = ',';
   }
@@ -66,7 +67,6 @@ bool X86Architecture::FormatInstruction(
   //  rInsn.AddMark(Cell::Mark::KeywordType, oss.str().length() - BegMark);
   //}
 
-  rStrCell = oss.str();
   return true;
 }
 
@@ -2,18 +2,40 @@
 #include "x86_architecture.hpp"
 #include <medusa/extend.hpp>
 
-void X86Architecture::FormatOperand(
-  std::ostringstream& rInsnBuf,
-  Cell::Mark::List  & rMarks,
-  Document     const& rDoc,
-  TOffset             Offset,
-  Instruction  const& rInsn,
-  Operand      const* pOprd) const
+static char const* GetAccessType(u32 OprdType)
 {
-  std::ostringstream ValueName;
-  ValueName << std::setfill('0') << std::right << std::hex;
-  s64 RelValue = static_cast<s64>(pOprd->GetValue());
+  switch (OprdType & MS_MASK)
+  {
+  case MS_8BIT:   return "byte ";
+  case MS_16BIT:  return "word ";
+  case MS_32BIT:  return "dword ";
+  case MS_64BIT:  return "qword ";
+  case MS_80BIT:  return "tword ";
+  case MS_128BIT: return "oword ";
+  default:        return "";
+  }
+}
 
+// Signed values are printed as their two's complement, so the size only masks the value
+static void AppendSizedHex(CellText& rText, u32 Size, u64 Value)
+{
+  switch (Size)
+  {
+  case 8:  rText.AppendHex(Value & 0xff,        2); break;
+  case 16: rText.AppendHex(Value & 0xffff,      4); break;
+  case 32: rText.AppendHex(Value & 0xffffffff,  8); break;
+  case 64: rText.AppendHex(Value,              16); break;
+  default: rText.AppendHex(Value                 ); break;
+  }
+}
+
+void X86Architecture::FormatOperand(
+  CellText           & rText,
+  Document      const& rDoc,
+  TOffset              Offset,
+  Instruction   const& rInsn,
+  Operand       const* pOprd) const
+{
   if (pOprd->GetType() & O_REG_PC_REL)
   {
     Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), rInsn.GetLength() + pOprd->GetValue() + Offset));
@@ -21,32 +43,15 @@ void X86Architecture::FormatOperand(
     {
       if (pOprd->GetType() & O_MEM)
       {
-        std::string AccessType;
-        switch (pOprd->GetType() & MS_MASK)
-        {
-        case MS_8BIT:   AccessType = "byte ";  break;
-        case MS_16BIT:  AccessType = "word ";  break;
-        case MS_32BIT:  AccessType = "dword "; break;
-        case MS_64BIT:  AccessType = "qword "; break;
-        case MS_80BIT:  AccessType = "tword "; break;
-        case MS_128BIT: AccessType = "oword "; break;
-        default:        AccessType = "";       break;
-        }
-        rInsnBuf << AccessType;
-        rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, AccessType.length()));
-
-        ValueName << "[" << OprdLabel.GetLabel() << "]";
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
-        rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, OprdLabel.GetLabel().length()));
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
-        rInsnBuf << ValueName.str();
+        rText.Append(Cell::Mark::KeywordType, GetAccessType(pOprd->GetType()));
+        rText.Append(Cell::Mark::OperatorType, "[", 1);
+        rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(OprdLabel));
+        rText.Append(Cell::Mark::OperatorType, "]", 1);
         return;
       }
       else
       {
-        ValueName << OprdLabel.GetLabel();
-        rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, OprdLabel.GetLabel().length()));
-        rInsnBuf << ValueName.str();
+        rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(OprdLabel));
         return;
       }
     }
@@ -57,24 +62,18 @@ void X86Architecture::FormatOperand(
     Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), pOprd->GetValue()));
 
     if (OprdLabel.GetType() != Label::Unknown)
-    {
-      ValueName << OprdLabel.GetLabel();
-      rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, ValueName.str().length()));
-    }
+      rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(OprdLabel));
     else
     {
       switch (pOprd->GetType() & DS_MASK)
       {
-      case DS_8BIT:  ValueName << "0x" << std::setw(2)  << static_cast<u32>(static_cast<u8> (pOprd->GetValue())); break;
-      case DS_16BIT: ValueName << "0x" << std::setw(4)  << static_cast<s16>(pOprd->GetValue()); break;
-      case DS_32BIT: ValueName << "0x" << std::setw(8)  << static_cast<s32>(pOprd->GetValue()); break;
-      case DS_64BIT: ValueName << "0x" << std::setw(16) << static_cast<s64>(pOprd->GetValue()); break;
-      default:       ValueName << "0x" <<                                   pOprd->GetValue() ; break;
+      case DS_8BIT:  AppendSizedHex(rText,  8, pOprd->GetValue()); break;
+      case DS_16BIT: AppendSizedHex(rText, 16, pOprd->GetValue()); break;
+      case DS_32BIT: AppendSizedHex(rText, 32, pOprd->GetValue()); break;
+      case DS_64BIT: AppendSizedHex(rText, 64, pOprd->GetValue()); break;
+      default:       AppendSizedHex(rText,  0, pOprd->GetValue()); break;
       }
-      rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ValueName.str().length()));
     }
-
-    rInsnBuf << ValueName.str();
     return;
   }
 
@@ -91,79 +90,48 @@ void X86Architecture::FormatOperand(
     }
     Label OprdLabel = rDoc.GetLabelFromAddress(Address(Address::FlatType, pOprd->GetSegValue(), OprdOff));
     if (OprdLabel.GetType() != Label::Unknown)
-    {
-      ValueName << OprdLabel.GetLabel();
-      rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, ValueName.str().length()));
-    }
+      rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(OprdLabel));
     else
     {
       switch (pOprd->GetType() & DS_MASK)
       {
-      case DS_8BIT:  ValueName << "0x" << std::setw(2)  << static_cast<u32>(static_cast< u8>(OprdOff)); break;
-      case DS_16BIT: ValueName << "0x" << std::setw(4)  << static_cast<s16>(OprdOff); break;
-      case DS_32BIT: ValueName << "0x" << std::setw(8)  << static_cast<s32>(OprdOff); break;
-      case DS_64BIT: ValueName << "0x" << std::setw(16) << static_cast<s64>(OprdOff); break;
-      default:       ValueName << "0x" <<                                   OprdOff ; break;
+      case DS_8BIT:  AppendSizedHex(rText,  8, OprdOff); break;
+      case DS_16BIT: AppendSizedHex(rText, 16, OprdOff); break;
+      case DS_32BIT: AppendSizedHex(rText, 32, OprdOff); break;
+      case DS_64BIT: AppendSizedHex(rText, 64, OprdOff); break;
+      default:       AppendSizedHex(rText,  0, OprdOff); break;
       }
-      rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ValueName.str().length()));
     }
-
-    rInsnBuf << ValueName.str();
     return;
   }
 
   if (pOprd->GetType() & O_MEM)
   {
-    std::string AccessType;
-    switch (pOprd->GetType() & MS_MASK)
-    {
-    case MS_8BIT:   AccessType = "byte ";  break;
-    case MS_16BIT:  AccessType = "word ";  break;
-    case MS_32BIT:  AccessType = "dword "; break;
-    case MS_64BIT:  AccessType = "qword "; break;
-    case MS_80BIT:  AccessType = "tword "; break;
-    case MS_128BIT: AccessType = "oword "; break;
-    default:        AccessType = "";       break;
-    }
-    rInsnBuf << AccessType;
-    rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, AccessType.length()));
+    rText.Append(Cell::Mark::KeywordType, GetAccessType(pOprd->GetType()));
 
     if (pOprd->GetType() & O_SEG)
     {
-      auto pRegName = m_CpuInfo.ConvertIdentifierToName(pOprd->GetSeg());
-      rInsnBuf << pRegName << ":";
-      rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, strlen(pRegName)));
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetSeg()));
+      rText.Append(Cell::Mark::OperatorType, ":", 1);
     }
 
     if (pOprd->GetType() & O_SEG_VAL)
     {
-      rInsnBuf << std::setfill('0') << std::setw(4) << std::hex << pOprd->GetSeg() << ":";
-      rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, 4));
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Mark(Cell::Mark::ImmediateType, rText.WriteHex(pOprd->GetSeg(), 4));
+      rText.Append(Cell::Mark::OperatorType, ":", 1);
     }
 
-    rInsnBuf << "[";
-    rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+    rText.Append(Cell::Mark::OperatorType, "[", 1);
 
     if (pOprd->GetType() & O_REG && pOprd->GetReg() != X86_Reg_Unknown)
-    {
-      auto pRegName = m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg());
-      rInsnBuf << pRegName;
-      rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, strlen(pRegName)));
-    }
+      rText.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg()));
 
     if (pOprd->GetType() & O_SREG && pOprd->GetSecReg() != X86_Reg_Unknown)
     {
       if (pOprd->GetReg() != X86_Reg_Unknown)
-      {
-        rInsnBuf << " + ";
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 3));
-      }
+        rText.Append(Cell::Mark::OperatorType, " + ", 3);
 
-      auto pRegName = m_CpuInfo.ConvertIdentifierToName(pOprd->GetSecReg());
-      rInsnBuf << pRegName;
-      rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, strlen(pRegName)));
+      rText.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetSecReg()));
     }
 
     if (pOprd->GetType() & O_SCALE && pOprd->GetSecReg() != X86_Reg_Unknown)
@@ -175,9 +143,8 @@ void X86Architecture::FormatOperand(
       case SC_4: pScaleValue = "4"; break;
       case SC_8: pScaleValue = "8"; break;
       }
-      rInsnBuf << " * " << pScaleValue;
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 3));
-      rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, 1));
+      rText.Append(Cell::Mark::OperatorType, " * ", 3);
+      rText.Append(Cell::Mark::ImmediateType, pScaleValue, 1);
     }
 
     if (pOprd->GetType() & O_DISP)
@@ -191,49 +158,31 @@ void X86Architecture::FormatOperand(
       default:       Disp = pOprd->GetValue(); break;
       }
       Address AddrDst(pOprd->GetSegValue(), Disp);
-      Cell::Mark::Type MarkType = Cell::Mark::UnknownType;
+
+      if (pOprd->GetReg() != 0x0 || pOprd->GetSecReg() != 0x0)
+        rText.Append(Cell::Mark::OperatorType, " + ", 3);
 
       Label const& Lbl = rDoc.GetLabelFromAddress(AddrDst);
       if (Lbl.GetType() != Label::Unknown)
-      {
-        ValueName << Lbl.GetLabel();
-        MarkType = Cell::Mark::LabelType;
-      }
+        rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(Lbl));
       else
       {
-        MarkType = Cell::Mark::ImmediateType;
+        // A sign extended 8-bit displacement keeps its 32 bits
         switch (pOprd->GetType() & AS_MASK)
         {
-        case AS_8BIT:  ValueName << "0x" << std::setw(2)  << static_cast<u32>(Disp); break;
-        case AS_16BIT: ValueName << "0x" << std::setw(4)  << static_cast<s16>(Disp); break;
-        case AS_32BIT: ValueName << "0x" << std::setw(8)  << static_cast<s32>(Disp); break;
-        case AS_64BIT: ValueName << "0x" << std::setw(16) << static_cast<s64>(Disp); break;
-        default:       ValueName << "0x" <<                                   Disp ; break;
+        case AS_8BIT:  rText.AppendHex(Disp & 0xffffffff,  2); break;
+        case AS_16BIT: AppendSizedHex(rText, 16, Disp); break;
+        case AS_32BIT: AppendSizedHex(rText, 32, Disp); break;
+        case AS_64BIT: AppendSizedHex(rText, 64, Disp); break;
+        default:       AppendSizedHex(rText,  0, Disp); break;
         }
       }
-
-      if (pOprd->GetReg() == 0x0 && pOprd->GetSecReg() == 0x0)
-      {
-        rInsnBuf << ValueName.str();
-        rMarks.push_back(Cell::Mark(MarkType, ValueName.str().length()));
-      }
-      else
-      {
-        rInsnBuf << " + " << ValueName.str();
-        rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 3));
-        rMarks.push_back(Cell::Mark(MarkType, ValueName.str().length()));
-      }
     }
 
-    rInsnBuf << "]";
-    rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+    rText.Append(Cell::Mark::OperatorType, "]", 1);
     return;
   }
 
   if (pOprd->GetType() & O_REG)
-  {
-    auto pRegName = m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg());
-    rInsnBuf << pRegName;
-    rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, strlen(pRegName)));
-  }
-}
\ No newline at end of file
+    rText.Append(Cell::Mark::RegisterType, m_CpuInfo.ConvertIdentifierToName(pOprd->GetReg()));
+}
@@ -0,0 +1,243 @@
+#include "x86_architecture.hpp"
+
+// The length rules are generated from x86.yaml with the decoder (see x86_opcode.cpp), each
+// rule reads at the same offset than the decoder, so both accept the same instructions.
+
+static bool DecodeAddressLength(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, u32 Prefix, u8 Mode, u16& rLength)
+{
+  u8 ModRm;
+  if (!rWnd.Read(Offset, ModRm))
+    return false;
+
+  u8 Mod = ModRm >> 6;
+  u8 Rm  = ModRm & 0x7;
+  bool AdSize = (Prefix & X86_Prefix_AdSize) ? true : false;
+
+  if (Mod == 0x3)
+    return false;
+
+  // 16-bit addressing
+  if (Mode != X86_Bit_64 && (Mode == X86_Bit_16) != AdSize)
+  {
+    if (Mod == 0x0) rLength += (Rm == 0x6) ? 2 : 0;
+    else            rLength += (Mod == 0x1) ? 1 : 2;
+    return true;
+  }
+
+  if (Rm == 0x4)
+  {
+    u8 Sib;
+    if (!rWnd.Read(Offset + 1, Sib))
+      return false;
+    ++rLength;
+    if ((Sib & 0x7) == 0x5 && Mod == 0x0)
+    {
+      rLength += 4;
+      return true;
+    }
+  }
+  else if (Mod == 0x0 && Rm == 0x5)
+  {
+    rLength += 4;
+    return true;
+  }
+
+  if      (Mod == 0x1) rLength += 1;
+  else if (Mod == 0x2) rLength += 4;
+  return true;
+}
+
+static bool DecodeOperandLength(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, u8 Oprd, u32 Prefix, u8 Mode, u16& rLength)
+{
+  bool OpSize = (Prefix & X86_Prefix_OpSize) ? true : false;
+  u8 ModRm;
+
+  switch (Oprd)
+  {
+  case X86_LengthOprd_None:
+    return true;
+
+  case X86_LengthOprd_ModRm:
+    if (!rWnd.Read(Offset, ModRm))
+      return false;
+    ++rLength;
+    return (ModRm >> 6) == 0x3 ? true : DecodeAddressLength(rWnd, Offset, Prefix, Mode, rLength);
+
+  case X86_LengthOprd_ModRmReg:
+    ++rLength;
+    return true;
+
+  case X86_LengthOprd_Mem32:
+    if (Mode == X86_Bit_16)
+      return false;
+    // Fall through
+  case X86_LengthOprd_Mem:
+    if (!rWnd.Read(Offset, ModRm) || (ModRm >> 6) == 0x3)
+      return false;
+    ++rLength;
+    return DecodeAddressLength(rWnd, Offset, Prefix, Mode, rLength);
+
+  case X86_LengthOprd_Ib:
+    rLength += 1;
+    return true;
+
+  case X86_LengthOprd_Iw:
+    rLength += 2;
+    return true;
+
+  case X86_LengthOprd_Iz:
+  case X86_LengthOprd_Jz:
+    if (Mode == X86_Bit_16) rLength += OpSize ? 4 : 2;
+    else                    rLength += OpSize ? 2 : 4;
+    return true;
+
+  case X86_LengthOprd_Iv:
+    if (Mode == X86_Bit_16)
+      rLength += OpSize ? 4 : 2;
+    else if (Mode == X86_Bit_64 && (Prefix & X86_Prefix_REX_w) == X86_Prefix_REX_w)
+      rLength += 8;
+    else
+      rLength += OpSize ? 2 : 4;
+    return true;
+
+  case X86_LengthOprd_Moffs:
+    rLength += Mode / 8;
+    return true;
+
+  case X86_LengthOprd_Ap:
+    if      (Mode == X86_Bit_16) rLength += OpSize ? 6 : 4;
+    else if (Mode == X86_Bit_32) rLength += OpSize ? 4 : 6;
+    else                         return false;
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+bool X86Architecture::DecodeLength(FetchWindow const& rWnd, u8 Mode, u16& rLength, u8& rSubType)
+{
+  if (Mode != X86_Bit_16 && Mode != X86_Bit_32 && Mode != X86_Bit_64)
+    return Architecture::DecodeLength(rWnd, Mode, rLength, rSubType);
+
+  FetchWindowType Wnd(rWnd);
+  TOffset Offset   = Wnd.GetOffset();
+  u8      ModeMask = (Mode == X86_Bit_16) ? 0x1 : ((Mode == X86_Bit_32) ? 0x2 : 0x4);
+  u32     Prefix   = 0;
+  u16     Length   = 0;
+  u8      Byte;
+
+  // Chains of table_1 come first, they're indexed by the opcode
+  if (!Wnd.Read(Offset, Byte))
+    return false;
+  u16 Chain = Byte;
+  ++Offset;
+
+  for (;;)
+  {
+    LengthRule const* pRule    = m_LengthRule + m_LengthChain[Chain];
+    LengthRule const* pRuleEnd = m_LengthRule + m_LengthChain[Chain + 1];
+    u8 PrefixByte = 0;
+    u8 SuffixByte = 0;
+
+    for (; pRule != pRuleEnd; ++pRule)
+    {
+      u8 Test = pRule->m_Test;
+
+      if (pRule->m_Kind == X86_Length_Fetch)
+      {
+        if ((Test & X86_LengthTest_Prefix) && !Wnd.Read(Offset - 2, PrefixByte))
+          return false;
+        if ((Test & X86_LengthTest_Suffix) && !Wnd.Read(Offset, SuffixByte))
+          return false;
+        continue;
+      }
+
+      if (!(pRule->m_Modes & ModeMask))
+        continue;
+      if (Test == 0)
+        break;
+
+      if ((Test & X86_LengthTest_Prefix) && PrefixByte != pRule->m_Byte)
+        continue;
+      if ((Test & X86_LengthTest_Suffix) && SuffixByte != pRule->m_Byte)
+        continue;
+      if ((Test & X86_LengthTest_NoAdSize) && (Prefix & X86_Prefix_AdSize))
+        continue;
+      if ((Test & X86_LengthTest_AdSize) && !(Prefix & X86_Prefix_AdSize))
+        continue;
+      if ((Test & X86_LengthTest_RexB) && (Prefix & X86_Prefix_REX_b) != X86_Prefix_REX_b)
+        continue;
+      if ((Test & X86_LengthTest_RexW) && (Prefix & X86_Prefix_REX_w) != X86_Prefix_REX_w)
+        continue;
+      if ((Test & X86_LengthTest_Vendor) && m_CfgMdl.GetEnum("Vendor") != pRule->m_Vendor)
+        continue;
+      break;
+    }
+
+    if (pRule == pRuleEnd)
+      return false;
+
+    switch (pRule->m_Kind)
+    {
+    case X86_Length_Prefix:
+      ++Length;
+      Prefix |= pRule->m_Prefix;
+      Offset += pRule->m_Arg[0];
+      if (!Wnd.Read(Offset, Byte))
+        return false;
+      Chain = Byte;
+      ++Offset;
+      break;
+
+    case X86_Length_Table:
+      if (!Wnd.Read(Offset, Byte) || Byte < pRule->m_Arg[1])
+        return false;
+      ++Length;
+      Chain = m_LengthTable[pRule->m_Arg[0]] + (Byte - pRule->m_Arg[1]);
+      ++Offset;
+      break;
+
+    case X86_Length_Group:
+      if (!Wnd.Read(Offset, Byte))
+        return false;
+      Chain = m_LengthGroup[pRule->m_Arg[0]] + ((Byte >> 3) & 0x7);
+      break;
+
+    // Memory operands go through a group, registers through a table starting at 0xc0
+    case X86_Length_Fpu:
+      if (!Wnd.Read(Offset, Byte))
+        return false;
+      if (Byte < 0xc0)
+        Chain = m_LengthGroup[pRule->m_Arg[0]] + ((Byte >> 3) & 0x7);
+      else
+      {
+        ++Length;
+        Chain = m_LengthTable[pRule->m_Arg[1]] + (Byte - 0xc0);
+        ++Offset;
+      }
+      break;
+
+    case X86_Length_Instruction:
+      if (pRule->m_Prefix != 0 && !(Prefix & X86_Prefix_OpSize))
+        Prefix |= pRule->m_Prefix; /* d64/df64 constraint */
+      Length += pRule->m_Length;
+
+      // Operands which don't change the length are stored last
+      for (u8 OprdIdx = 0; OprdIdx < 4 && pRule->m_Oprd[OprdIdx] != X86_LengthOprd_None; ++OprdIdx)
+        if (!DecodeOperandLength(Wnd, Offset, pRule->m_Oprd[OprdIdx], Prefix, Mode, Length))
+          return false;
+
+      // Immediates and displacements are not read, make sure the last byte is available
+      if (!Wnd.Read(Wnd.GetOffset() + Length - 1, Byte))
+        return false;
+
+      rLength  = Length;
+      rSubType = pRule->m_SubType;
+      return true;
+
+    default:
+      return false;
+    }
+  }
+}
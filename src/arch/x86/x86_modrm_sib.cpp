@@ -1,19 +1,19 @@
 #include "x86.hpp"
 #include "x86_architecture.hpp"
 
-static x86::ModRM GetModRm(BinaryStream const& rBinStrm, TOffset Offset)
+static x86::ModRM GetModRm(X86Architecture::FetchWindowType const& rWnd, TOffset Offset)
 {
   u8 ModRmByte;
-  rBinStrm.Read(Offset, ModRmByte);
+  rWnd.Read(Offset, ModRmByte);
   return ModRmByte;
 }
 
 /* Addressing (R/M) */
 
-static bool DecodeModRmAddress16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+static bool DecodeModRmAddress16(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
 
   // Mem
   switch (ModRm & 0x7)
@@ -30,7 +30,7 @@ static bool DecodeModRmAddress16(BinaryStream const& rBinStrm, TOffset Offset, I
       if ((ModRm >> 6) == 0x0)
       {
         u16 Disp16;
-        rBinStrm.Read(Offset + 1, Disp16);
+        rWnd.Read(Offset + 1, Disp16);
         pOprd->Value() = Disp16;
                                                                      pOprd->Type() |= (O_DISP16 | O_ADDR16);
         pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -51,7 +51,7 @@ static bool DecodeModRmAddress16(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + 1, Disp8);
+      rWnd.Read(Offset + 1, Disp8);
       pOprd->Value() = Disp8;
       pOprd->Type() |= (O_DISP8 | O_ADDR16);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -61,7 +61,7 @@ static bool DecodeModRmAddress16(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x2:
     {
       u16 Disp16;
-      rBinStrm.Read(Offset + 1, Disp16);
+      rWnd.Read(Offset + 1, Disp16);
       pOprd->Value() = Disp16;
       pOprd->Type() |= (O_DISP16 | O_ADDR16);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -74,7 +74,7 @@ static bool DecodeModRmAddress16(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+static bool DecodeSib32(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[]          = { X86_Reg_Eax, X86_Reg_Ecx, X86_Reg_Edx,  X86_Reg_Ebx,  X86_Reg_Esp,     X86_Reg_Unknown, X86_Reg_Esi,  X86_Reg_Edi  };
   static u16 aRegIndex[]     = { X86_Reg_Eax, X86_Reg_Ecx, X86_Reg_Edx,  X86_Reg_Ebx,  X86_Reg_Unknown, X86_Reg_Ebp,     X86_Reg_Esi,  X86_Reg_Edi  };
@@ -89,8 +89,8 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
   u8   Mod;
   u8   Sib;
 
-  rBinStrm.Read(Offset - 1, Mod);
-  rBinStrm.Read(Offset, Sib);
+  rWnd.Read(Offset - 1, Mod);
+  rWnd.Read(Offset, Sib);
 
   Mod >>= 6;
 
@@ -103,7 +103,7 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x0:
         {
           u32 Disp32;
-          rBinStrm.Read(Offset + 1, Disp32);
+          rWnd.Read(Offset + 1, Disp32);
           pOprd->Value() = Disp32;
           pOprd->Type() |= O_DISP32;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -116,7 +116,7 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
           pOprd->Reg() = Reg101;
 
           u8 Disp8;
-          rBinStrm.Read(Offset + 1, Disp8);
+          rWnd.Read(Offset + 1, Disp8);
           pOprd->Value() = Disp8;
           pOprd->Type() |= O_DISP8;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -136,7 +136,7 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x2:
         {
           u32 Disp32;
-          rBinStrm.Read(Offset + 1, Disp32);
+          rWnd.Read(Offset + 1, Disp32);
           pOprd->Value() = Disp32;
           pOprd->Type() |= O_DISP32;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -149,7 +149,7 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x1:
         {
           u8 Disp8;
-          rBinStrm.Read(Offset + 1, Disp8);
+          rWnd.Read(Offset + 1, Disp8);
           pOprd->Value() = Disp8;
           pOprd->Type() |= O_DISP8;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -170,24 +170,24 @@ static bool DecodeSib32(BinaryStream const& rBinStrm, TOffset Offset, Instructio
   return true;
 }
 
-static bool DecodeModRmAddress32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+static bool DecodeModRmAddress32(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
   static u16 aReg32[]     = { X86_Reg_Eax, X86_Reg_Ecx, X86_Reg_Edx,  X86_Reg_Ebx,  X86_Reg_Unknown, X86_Reg_Ebp, X86_Reg_Esi,  X86_Reg_Edi  };
   static u16 aReg32RexB[] = { X86_Reg_R8d, X86_Reg_R9d, X86_Reg_R10d, X86_Reg_R11d, X86_Reg_Unknown, X86_Reg_Eip, X86_Reg_R14d, X86_Reg_R15d };
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
 
   // SIB
   if ((ModRm & 0x7) == 0x4 && (ModRm >> 6) != 0x3)
-    return DecodeSib32(rBinStrm, Offset + sizeof(ModRm), rInsn, pOprd);
+    return DecodeSib32(rWnd, Offset + sizeof(ModRm), rInsn, pOprd);
 
   // Mod == 0x0 and R/M == 0x5
   else if ((ModRm & 0xC7) == 0x5)
   {
     u32 Disp32;
 
-    rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+    rWnd.Read(Offset + sizeof(ModRm), Disp32);
     pOprd->Type() |= (O_DISP32 | O_ADDR32);
     pOprd->Value() = Disp32;
     pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -211,7 +211,7 @@ static bool DecodeModRmAddress32(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + 1, Disp8);
+      rWnd.Read(Offset + 1, Disp8);
       pOprd->Value() = Disp8;
       pOprd->Type() |= (O_DISP8 | O_ADDR32);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -221,7 +221,7 @@ static bool DecodeModRmAddress32(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x2:
     {
       u32 Disp32;
-      rBinStrm.Read(Offset + 1, Disp32);
+      rWnd.Read(Offset + 1, Disp32);
       pOprd->Value() = Disp32;
       pOprd->Type() |= (O_DISP32 | O_ADDR32);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -234,7 +234,7 @@ static bool DecodeModRmAddress32(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+static bool DecodeSib64(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[]          = { X86_Reg_Rax, X86_Reg_Rcx, X86_Reg_Rdx,  X86_Reg_Rbx,  X86_Reg_Rsp,     X86_Reg_Unknown, X86_Reg_Rsi, X86_Reg_Rdi  };
   static u16 aRegRexB[]      = { X86_Reg_R8,  X86_Reg_R9,  X86_Reg_R10,  X86_Reg_R11,  X86_Reg_R12,     X86_Reg_Unknown, X86_Reg_R14, X86_Reg_R15d };
@@ -249,8 +249,8 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
   u8   Mod;
   u8   Sib;
 
-  rBinStrm.Read(Offset - 1, Mod);
-  rBinStrm.Read(Offset, Sib);
+  rWnd.Read(Offset - 1, Mod);
+  rWnd.Read(Offset, Sib);
 
   Mod >>= 6;
 
@@ -263,7 +263,7 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x0:
         {
           u32 Disp32;
-          rBinStrm.Read(Offset + 1, Disp32);
+          rWnd.Read(Offset + 1, Disp32);
           pOprd->Value() = Disp32;
           pOprd->Type() |= O_DISP32;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -276,7 +276,7 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
           pOprd->Reg() = Reg101;
 
           u8 Disp8;
-          rBinStrm.Read(Offset + 1, Disp8);
+          rWnd.Read(Offset + 1, Disp8);
           pOprd->Value() = Disp8;
           pOprd->Type() |= O_DISP8;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -296,7 +296,7 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x2:
         {
           u32 Disp32;
-          rBinStrm.Read(Offset + 1, Disp32);
+          rWnd.Read(Offset + 1, Disp32);
           pOprd->Value() = Disp32;
           pOprd->Type() |= O_DISP32;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -309,7 +309,7 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
       case 0x1:
         {
           u8 Disp8;
-          rBinStrm.Read(Offset + 1, Disp8);
+          rWnd.Read(Offset + 1, Disp8);
           pOprd->Value() = Disp8;
           pOprd->Type() |= O_DISP8;
           pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -330,24 +330,24 @@ static bool DecodeSib64(BinaryStream const& rBinStrm, TOffset Offset, Instructio
   return true;
 }
 
-static bool DecodeModRmAddress64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+static bool DecodeModRmAddress64(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
   static u16 aReg[]     = { X86_Reg_Rax, X86_Reg_Rcx, X86_Reg_Rdx, X86_Reg_Rbx, X86_Reg_Unknown, X86_Reg_Rbp, X86_Reg_Rsi, X86_Reg_Rdi };
   static u16 aRegRexB[] = { X86_Reg_R8,  X86_Reg_R9,  X86_Reg_R10, X86_Reg_R11, X86_Reg_Unknown, X86_Reg_Eip, X86_Reg_R14, X86_Reg_R15 };
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
 
   // SIB
   if ((ModRm & 0x7) == 0x4 && (ModRm >> 6) != 0x3)
-    return DecodeSib64(rBinStrm, Offset + 1, rInsn, pOprd);
+    return DecodeSib64(rWnd, Offset + 1, rInsn, pOprd);
 
   // Mod == 0x0 and R/M == 0x5
   else if ((ModRm & 0xC7) == 0x5)
   {
     u32 Disp32;
 
-    rBinStrm.Read(Offset, Disp32);
+    rWnd.Read(Offset, Disp32);
     pOprd->Type() |= O_ADDR64;
     pOprd->Value() = Disp32;
     pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -368,7 +368,7 @@ static bool DecodeModRmAddress64(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x1:
     {
       u8 Disp8;
-      rBinStrm.Read(Offset + 1, Disp8);
+      rWnd.Read(Offset + 1, Disp8);
       pOprd->Value() = Disp8;
       pOprd->Type() |= (O_DISP8 | O_ADDR64);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -378,7 +378,7 @@ static bool DecodeModRmAddress64(BinaryStream const& rBinStrm, TOffset Offset, I
   case 0x2:
     {
       u32 Disp32;
-      rBinStrm.Read(Offset + 1, Disp32);
+      rWnd.Read(Offset + 1, Disp32);
       pOprd->Value() = Disp32;
       pOprd->Type() |= (O_DISP32 | O_ADDR64);
       pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -391,28 +391,28 @@ static bool DecodeModRmAddress64(BinaryStream const& rBinStrm, TOffset Offset, I
   return true;
 }
 
-static bool DecodeModRmAddress(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, X86_Bit Bit)
+static bool DecodeModRmAddress(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd, X86_Bit Bit)
 {
   switch (Bit)
   {
   case X86_Bit_16:
-    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress32(rBinStrm, Offset, rInsn, pOprd);
-    else                                    return DecodeModRmAddress16(rBinStrm, Offset, rInsn, pOprd);
+    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress32(rWnd, Offset, rInsn, pOprd);
+    else                                    return DecodeModRmAddress16(rWnd, Offset, rInsn, pOprd);
 
   case X86_Bit_32:
-    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress16(rBinStrm, Offset, rInsn, pOprd);
-    else                                    return DecodeModRmAddress32(rBinStrm, Offset, rInsn, pOprd);
+    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress16(rWnd, Offset, rInsn, pOprd);
+    else                                    return DecodeModRmAddress32(rWnd, Offset, rInsn, pOprd);
 
   case X86_Bit_64:
     {
       u8 ModRm;
       u32 Disp32;
 
-      rBinStrm.Read(Offset, ModRm);
+      rWnd.Read(Offset, ModRm);
       if ((ModRm & 0xC7) == 0x5)
       {
         u16 RegIp = (Bit == X86_Bit_64) ? X86_Reg_Rip : X86_Reg_Eip;
-        rBinStrm.Read(Offset + sizeof(ModRm), Disp32);
+        rWnd.Read(Offset + sizeof(ModRm), Disp32);
         pOprd->Reg() = RegIp;
         if (Bit == X86_Bit_64) // LATER: prefix ?
           pOprd->Value() = Disp32;
@@ -426,8 +426,8 @@ static bool DecodeModRmAddress(BinaryStream const& rBinStrm, TOffset Offset, Ins
       }
     }
 
-    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress32(rBinStrm, Offset, rInsn, pOprd);
-    else                                    return DecodeModRmAddress64(rBinStrm, Offset, rInsn, pOprd);
+    if (rInsn.Prefix() & X86_Prefix_AdSize) return DecodeModRmAddress32(rWnd, Offset, rInsn, pOprd);
+    else                                    return DecodeModRmAddress64(rWnd, Offset, rInsn, pOprd);
 
   default: return false;
   };
@@ -514,27 +514,29 @@ static bool DecodeQMod11(Instruction& rInsn, Operand* pOprd, u8 Reg)
   return true;
 }
 
-bool X86Architecture::Decode_Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
   {
   case 0x0:
   case 0x1:
-  case 0x2: pOprd->Type() |= O_MEM8; return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: pOprd->Type() |= O_MEM8; return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3:                          return DecodeEbMod11(rInsn, pOprd, ModRm & 0x7);
   default:                           return false;
   }
 }
 
-bool X86Architecture::Decode_Ew(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ew(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -542,16 +544,17 @@ bool X86Architecture::Decode_Ew(BinaryStream const& rBinStrm, TOffset Offset, In
   {
   case 0x0:
   case 0x1:
-  case 0x2: pOprd->Type() |= O_MEM16; return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: pOprd->Type() |= O_MEM16; return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3:                           return DecodeEwMod11(rInsn, pOprd, Reg);
   default:                            return false;
   }
 }
 
-bool X86Architecture::Decode_Ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -559,16 +562,17 @@ bool X86Architecture::Decode_Ed(BinaryStream const& rBinStrm, TOffset Offset, In
   {
   case 0x0:
   case 0x1:
-  case 0x2: pOprd->Type() |= O_MEM32; return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: pOprd->Type() |= O_MEM32; return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3:                           return DecodeEdMod11(rInsn, pOprd, Reg);
   default:                            return false;
   }
 }
 
-bool X86Architecture::Decode_Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -599,7 +603,7 @@ bool X86Architecture::Decode_Ev(BinaryStream const& rBinStrm, TOffset Offset, In
   {
   case 0x0:
   case 0x1:
-  case 0x2: pOprd->Type() |= Mem; return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: pOprd->Type() |= Mem; return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3:
     switch (static_cast<X86_Bit>(Mode))
     {
@@ -612,10 +616,11 @@ bool X86Architecture::Decode_Ev(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -646,7 +651,7 @@ bool X86Architecture::Decode_Ey(BinaryStream const& rBinStrm, TOffset Offset, In
   {
   case 0x0:
   case 0x1:
-  case 0x2: pOprd->Type() |= Mem; return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: pOprd->Type() |= Mem; return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3:
     switch (static_cast<X86_Bit>(Mode))
     {
@@ -659,10 +664,11 @@ bool X86Architecture::Decode_Ey(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Rv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Rv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -683,10 +689,11 @@ bool X86Architecture::Decode_Rv(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Ry(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ry(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   u8 Reg = ModRm & 0x7;
   rInsn.Length() += sizeof(ModRm);
 
@@ -707,13 +714,14 @@ bool X86Architecture::Decode_Ry(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_M(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_M(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
-  x86::ModRM ModRm = GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm = GetModRm(rWnd, Offset);
   if (ModRm.Mod() == 0x3)
     return false;
   rInsn.Length()++;
-  bool Res = DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  bool Res = DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   switch (Mode)
   {
   case X86_Bit_16:
@@ -742,13 +750,14 @@ bool X86Architecture::Decode_M(BinaryStream const& rBinStrm, TOffset Offset, Ins
 
 /* Reg */
 
-bool X86Architecture::Decode_Gb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Gb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[]         = { X86_Reg_Al,  X86_Reg_Cl,  X86_Reg_Dl,   X86_Reg_Bl,   X86_Reg_Ah,   X86_Reg_Ch,   X86_Reg_Dh,   X86_Reg_Bh   };
   static u16 aRegRex[]      = { X86_Reg_Al,  X86_Reg_Cl,  X86_Reg_Dl,   X86_Reg_Bl,   X86_Reg_Spl,  X86_Reg_Bpl,  X86_Reg_Sil,  X86_Reg_Dil  };
   static u16 aRegRexRexR[]  = { X86_Reg_R8b, X86_Reg_R9b, X86_Reg_R10b, X86_Reg_R11b, X86_Reg_R12b, X86_Reg_R13b, X86_Reg_R14b, X86_Reg_R15b };
 
-  u8 Reg = GetModRm(rBinStrm, Offset).Reg();
+  u8 Reg = GetModRm(rWnd, Offset).Reg();
 
   u16* pReg = nullptr;
   if (rInsn.Prefix() & (X86_Prefix_REX_r & ~X86_Prefix_REX))
@@ -811,15 +820,17 @@ bool DecodeGq(Instruction& rInsn, Operand* pOprd, u8 Reg)
   return true;
 }
 
-bool X86Architecture::Decode_Gw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Gw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
-  return DecodeGw(rInsn, pOprd, GetModRm(rBinStrm, Offset).Reg());
+  return DecodeGw(rInsn, pOprd, GetModRm(rWnd, Offset).Reg());
 }
 
-bool X86Architecture::Decode_Gv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Gv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 Reg;
-  rBinStrm.Read(Offset, Reg);
+  rWnd.Read(Offset, Reg);
   Reg = (Reg >> 3) & 0x7;
   switch (static_cast<X86_Bit>(Mode))
   {
@@ -830,10 +841,11 @@ bool X86Architecture::Decode_Gv(BinaryStream const& rBinStrm, TOffset Offset, In
   };
 }
 
-bool X86Architecture::Decode_Gy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Gy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 Reg;
-  rBinStrm.Read(Offset, Reg);
+  rWnd.Read(Offset, Reg);
   Reg = (Reg >> 3) & 0x7;
   switch (static_cast<X86_Bit>(Mode))
   {
@@ -856,11 +868,12 @@ static bool DecodeNMod11(Instruction& rInsn, Operand* pOprd, u8 Reg)
   return true;
 }
 
-bool X86Architecture::Decode_Nq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Nq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
@@ -873,35 +886,37 @@ bool X86Architecture::Decode_Nq(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Qd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Qd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
   {
   case 0x0:
   case 0x1:
-  case 0x2: return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3: return DecodeNMod11(rInsn, pOprd, ModRm & 0x7);
   default:  return false;
   }
 }
 
-bool X86Architecture::Decode_Qq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Qq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
   {
   case 0x0:
   case 0x1:
-  case 0x2: return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3: return DecodeNMod11(rInsn, pOprd, ModRm & 0x7);
   default:  return false;
   }
@@ -909,10 +924,11 @@ bool X86Architecture::Decode_Qq(BinaryStream const& rBinStrm, TOffset Offset, In
 
 /* Reg */
 
-bool X86Architecture::Decode_Pq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Pq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[] = { X86_Reg_Mm0, X86_Reg_Mm1, X86_Reg_Mm2, X86_Reg_Mm3, X86_Reg_Mm4, X86_Reg_Mm5, X86_Reg_Mm6, X86_Reg_Mm7 };
-  u8 Reg = GetModRm(rBinStrm, Offset).Reg();
+  u8 Reg = GetModRm(rWnd, Offset).Reg();
   pOprd->Type() |= O_REG80;
   pOprd->Reg() = aReg[Reg];
   return true;
@@ -932,11 +948,12 @@ static bool DecodeUMod11(Instruction& rInsn, Operand* pOprd, u8 Reg)
   return true;
 }
 
-bool X86Architecture::Decode_Uo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Uo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
@@ -949,11 +966,12 @@ bool X86Architecture::Decode_Uo(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Uq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Uq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
@@ -966,11 +984,12 @@ bool X86Architecture::Decode_Uq(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Ux(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ux(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
@@ -983,35 +1002,37 @@ bool X86Architecture::Decode_Ux(BinaryStream const& rBinStrm, TOffset Offset, In
   }
 }
 
-bool X86Architecture::Decode_Wo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Wo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
   {
   case 0x0:
   case 0x1:
-  case 0x2: return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3: return DecodeUMod11(rInsn, pOprd, (ModRm >> 3) & 0x7);
   default:  return false;
   }
 }
 
-bool X86Architecture::Decode_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
   switch (ModRm >> 6)
   {
   case 0x0:
   case 0x1:
-  case 0x2: return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  case 0x2: return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
   case 0x3: return DecodeUMod11(rInsn, pOprd, (ModRm >> 3) & 0x7);
   default:  return false;
   }
@@ -1019,21 +1040,23 @@ bool X86Architecture::Decode_Wx(BinaryStream const& rBinStrm, TOffset Offset, In
 
 /* Reg */
 
-bool X86Architecture::Decode_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[]     = { X86_Reg_Xmm0, X86_Reg_Xmm1, X86_Reg_Xmm2,  X86_Reg_Xmm3,  X86_Reg_Xmm4,  X86_Reg_Xmm5,  X86_Reg_Xmm6,  X86_Reg_Xmm7  };
   static u16 aRegRexR[] = { X86_Reg_Xmm8, X86_Reg_Xmm9, X86_Reg_Xmm10, X86_Reg_Xmm11, X86_Reg_Xmm12, X86_Reg_Xmm13, X86_Reg_Xmm14, X86_Reg_Xmm15 };
-  u8 Reg = GetModRm(rBinStrm, Offset).Reg();
+  u8 Reg = GetModRm(rWnd, Offset).Reg();
   pOprd->Type() |= O_REG128;
   pOprd->Reg()   = (rInsn.Prefix() & (X86_Prefix_REX_r & ~X86_Prefix_REX)) ? aRegRexR[Reg] : aReg[Reg];
   return true;
 }
 
-bool X86Architecture::Decode_Vx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Vx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[]     = { X86_Reg_Xmm0, X86_Reg_Xmm1, X86_Reg_Xmm2,  X86_Reg_Xmm3,  X86_Reg_Xmm4,  X86_Reg_Xmm5,  X86_Reg_Xmm6,  X86_Reg_Xmm7  };
   static u16 aRegRexR[] = { X86_Reg_Xmm8, X86_Reg_Xmm9, X86_Reg_Xmm10, X86_Reg_Xmm11, X86_Reg_Xmm12, X86_Reg_Xmm13, X86_Reg_Xmm14, X86_Reg_Xmm15 };
-  u8 Reg = GetModRm(rBinStrm, Offset).Reg();
+  u8 Reg = GetModRm(rWnd, Offset).Reg();
   pOprd->Type() |= O_REG128;
   pOprd->Reg()   = (rInsn.Prefix() & (X86_Prefix_REX_r & ~X86_Prefix_REX)) ? aRegRexR[Reg] : aReg[Reg];
   return true;
@@ -1041,138 +1064,194 @@ bool X86Architecture::Decode_Vx(BinaryStream const& rBinStrm, TOffset Offset, In
 
 /* FPU memory operands */
 
-bool X86Architecture::Decode_m16int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m16int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM16;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m32fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m32fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM32;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m32int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m32int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM32;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m64fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m64fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM64;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m64int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m64int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM64;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m80fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m80fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM80;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m80dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m80dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM80;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_m80bcd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_m80bcd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM80;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
 /* M : memory operands only */
 
-bool X86Architecture::Decode_Ma(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ma(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Md(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Md(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Mo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Mo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Mp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Mp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Mq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Mq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Mw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Mw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
   pOprd->Type() |= O_MEM16;
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
 
-bool X86Architecture::Decode_Mx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Mx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
 /* LATER: Forbid != MEM */
-bool X86Architecture::Decode_My(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_My(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   if (Mode == X86_Bit_16)
     return false;
 
   u8 ModRm;
 
-  rBinStrm.Read(Offset, ModRm);
+  rWnd.Read(Offset, ModRm);
   rInsn.Length() += sizeof(ModRm);
 
-  return DecodeModRmAddress(rBinStrm, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
+  return DecodeModRmAddress(rWnd, Offset, rInsn, pOprd, static_cast<X86_Bit>(Mode));
 }
+
+X86_INSTANTIATE_DECODER(Decode_Eb);
+X86_INSTANTIATE_DECODER(Decode_Ew);
+X86_INSTANTIATE_DECODER(Decode_Ed);
+X86_INSTANTIATE_DECODER(Decode_Ev);
+X86_INSTANTIATE_DECODER(Decode_Ey);
+X86_INSTANTIATE_DECODER(Decode_Rv);
+X86_INSTANTIATE_DECODER(Decode_Ry);
+X86_INSTANTIATE_DECODER(Decode_M);
+X86_INSTANTIATE_DECODER(Decode_Gb);
+X86_INSTANTIATE_DECODER(Decode_Gw);
+X86_INSTANTIATE_DECODER(Decode_Gv);
+X86_INSTANTIATE_DECODER(Decode_Gy);
+X86_INSTANTIATE_DECODER(Decode_Nq);
+X86_INSTANTIATE_DECODER(Decode_Qd);
+X86_INSTANTIATE_DECODER(Decode_Qq);
+X86_INSTANTIATE_DECODER(Decode_Pq);
+X86_INSTANTIATE_DECODER(Decode_Uo);
+X86_INSTANTIATE_DECODER(Decode_Uq);
+X86_INSTANTIATE_DECODER(Decode_Ux);
+X86_INSTANTIATE_DECODER(Decode_Wo);
+X86_INSTANTIATE_DECODER(Decode_Wx);
+X86_INSTANTIATE_DECODER(Decode_Vo);
+X86_INSTANTIATE_DECODER(Decode_Vx);
+X86_INSTANTIATE_DECODER(Decode_m16int);
+X86_INSTANTIATE_DECODER(Decode_m32fp);
+X86_INSTANTIATE_DECODER(Decode_m32int);
+X86_INSTANTIATE_DECODER(Decode_m64fp);
+X86_INSTANTIATE_DECODER(Decode_m64int);
+X86_INSTANTIATE_DECODER(Decode_m80fp);
+X86_INSTANTIATE_DECODER(Decode_m80dec);
+X86_INSTANTIATE_DECODER(Decode_m80bcd);
+X86_INSTANTIATE_DECODER(Decode_Ma);
+X86_INSTANTIATE_DECODER(Decode_Md);
+X86_INSTANTIATE_DECODER(Decode_Mo);
+X86_INSTANTIATE_DECODER(Decode_Mp);
+X86_INSTANTIATE_DECODER(Decode_Mq);
+X86_INSTANTIATE_DECODER(Decode_Mw);
+X86_INSTANTIATE_DECODER(Decode_Mx);
+X86_INSTANTIATE_DECODER(Decode_My);
@@ -884,2366 +884,2482 @@ enum X86Opcode
   X86_Opcode_Xstore
 };
 private:
-  typedef bool (X86Architecture:: *TDisassembler)(BinaryStream const&, TOffset, Instruction&, u8);
-  static const TDisassembler m_Table_1[0x100];
-  bool Table_1_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_1_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  typedef bool (X86Architecture:: *TDisassembler)(FetchWindowType const&, TOffset, Instruction&);
 
-  static const TDisassembler m_Table_2[0x100];
-  bool Table_2_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_2_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> struct ModeTable
+  {
+    static const TDisassembler m_Table_1[0x100];
+    static const TDisassembler m_Table_2[0x100];
+    static const TDisassembler m_Table_3dnow1[0x100];
+    static const TDisassembler m_Table_3_38[0x100];
+    static const TDisassembler m_Table_3_3a[0x100];
+    static const TDisassembler m_Table_fp1[0x40];
+    static const TDisassembler m_Table_fp2[0x40];
+    static const TDisassembler m_Table_fp3[0x40];
+    static const TDisassembler m_Table_fp4[0x40];
+    static const TDisassembler m_Table_fp5[0x40];
+    static const TDisassembler m_Table_fp6[0x40];
+    static const TDisassembler m_Table_fp7[0x40];
+    static const TDisassembler m_Table_fp8[0x40];
+    static const TDisassembler m_Table_sse5a[0x100];
+  };
 
-  static const TDisassembler m_Table_3dnow1[0x100];
-  bool Table_3dnow1_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3dnow1_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_1_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_1_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_3_38[0x100];
-  bool Table_3_38_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_38_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_2_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_2_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_3_3a[0x100];
-  bool Table_3_3a_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_3_3a_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_3dnow1_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3dnow1_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp1[0x40];
-  bool Table_fp1_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp1_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_3_38_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_38_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp2[0x40];
-  bool Table_fp2_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp2_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_3_3a_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_3_3a_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp3[0x40];
-  bool Table_fp3_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp3_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp1_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp1_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp4[0x40];
-  bool Table_fp4_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp4_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp2_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp2_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp5[0x40];
-  bool Table_fp5_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp5_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp3_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp3_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp6[0x40];
-  bool Table_fp6_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp6_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp4_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp4_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp7[0x40];
-  bool Table_fp7_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp7_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp5_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp5_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_fp8[0x40];
-  bool Table_fp8_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_fp8_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp6_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp6_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  static const TDisassembler m_Table_sse5a[0x100];
-  bool Table_sse5a_00(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_01(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_02(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_03(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_04(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_05(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_06(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_07(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_08(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_09(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_0f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_16(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_17(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_18(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_19(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_1f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_20(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_21(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_22(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_23(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_24(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_25(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_26(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_27(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_28(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_29(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_2f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_30(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_31(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_32(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_33(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_34(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_35(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_36(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_37(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_38(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_39(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_3f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_40(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_41(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_42(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_43(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_44(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_45(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_46(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_47(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_48(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_49(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_4f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_50(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_51(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_52(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_53(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_54(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_55(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_56(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_57(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_58(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_59(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_5f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_60(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_61(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_62(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_63(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_64(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_65(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_66(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_67(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_68(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_69(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_6f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_70(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_71(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_72(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_73(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_74(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_75(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_76(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_77(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_78(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_79(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_7f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_80(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_81(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_82(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_83(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_84(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_85(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_86(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_87(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_88(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_89(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_8f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_90(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_91(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_92(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_93(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_94(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_95(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_96(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_97(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_98(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_99(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9a(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9c(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9e(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_9f(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_a9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_aa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ab(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ac(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ad(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ae(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_af(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_b9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ba(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_bb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_bc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_bd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_be(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_bf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_c9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ca(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_cb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_cc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_cd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ce(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_cf(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_d9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_da(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_db(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_dc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_dd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_de(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_df(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_e9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ea(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ee(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ef(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_f9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_fa(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_fb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_fc(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_fd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_fe(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Table_sse5a_ff(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp7_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp7_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
 
-  bool Operand__Ev_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBX_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Rv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yv_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Wo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ew(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSP_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r15_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mx_Vx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_Gv_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r8b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yv_Xv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Woqo_Vx_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Md_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Wq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r10_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSP_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ib_eAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Jz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBP_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mq_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Moq_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eAX_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__CH_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DX_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Hx_Wx_Lx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mo_b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mo_Voq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r15_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Sw_Ew(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Uo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Jb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Wob_Vo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ov_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Wy_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r13b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Wo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ry(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Mw_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Uod_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Wow_Vo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ry_Ty(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yb_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Edb_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_Gv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eAX_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eb_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r13_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AL_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AL_Ob(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rCX_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Mw_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST5_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m80fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Uo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ew_Gw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Mq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Hx_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST7_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Md(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mo_Vod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Qq_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Uod_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Hy_Wy_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ib_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Nq_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Qq_Pq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gb_Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDI_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Woq_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DX_Xz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m32fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DX_Xb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mqo_Hx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Uq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ey_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__BL_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AH_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r11_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r15b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ey_Pq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ry_Cy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r14_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Uo_Ib_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r10_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eyw_Vo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Ux(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ew_Sw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mx_Hx_Vx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Wd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Hy_Wo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ES(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Woq_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Hy_Wy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m80bcd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r10b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eb_CL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ma(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_M(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Mo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Mp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDI_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Mv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__By_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__GS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__FS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Wo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r11b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Dy_Ry(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Nq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__CL_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Woq_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBX_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST2_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Wo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Fv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r14_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Uo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDX_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rAX_Xv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DX_eAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Wo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ev_Ibs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rAX_Ov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DH_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Nq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yb_Xb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eb_1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Ey_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m16int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Mod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Hx_Hx_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ob_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AL_Xb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r12_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r8_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r14b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_CL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rCX_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__CS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ty_Ry(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DL_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m64int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mv_Gv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Hx_Wx_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__By_Ey_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__SS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Wx_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Wow(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ey_Gy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Uo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_By_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r13_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yz_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Ho_Edb_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Wo_Vy_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Woo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ry_Dy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m64fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ey_Vo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r9_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST6_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gv_Ev_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r9b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Iw_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__DS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Md_x_Hx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m80dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSI_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__m32int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Nq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST1_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r8_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Qd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_Gv_CL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vo_Md_x_Ho(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ey_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST3_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rSI_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Pq_Qq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gy_Ey_By(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Mo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rAX_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Mq_Pq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Gb_Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eb_Gb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__M(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Yb_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rAX_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__eAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rDX_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__My_Gy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mq_x_Hx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST0_ST1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r11_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r12b_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ev_Ibs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__BH_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vy_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Eyb_Vo_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Iw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Mo_w(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__ST4_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Vx_Hx_Mx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r12_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Wx_Vx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__rBP_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__r9_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__AL_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
-  bool Operand__Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, u8 Mode);
+  template<u8 Mode> bool Table_fp8_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_fp8_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  template<u8 Mode> bool Table_sse5a_00(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_01(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_02(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_03(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_04(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_05(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_06(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_07(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_08(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_09(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_0f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_16(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_17(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_18(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_19(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_1f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_20(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_21(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_22(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_23(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_24(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_25(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_26(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_27(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_28(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_29(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_2f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_30(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_31(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_32(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_33(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_34(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_35(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_36(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_37(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_38(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_39(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_3f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_40(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_41(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_42(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_43(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_44(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_45(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_46(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_47(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_48(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_49(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_4f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_50(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_51(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_52(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_53(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_54(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_55(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_56(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_57(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_58(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_59(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_5f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_60(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_61(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_62(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_63(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_64(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_65(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_66(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_67(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_68(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_69(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_6f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_70(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_71(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_72(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_73(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_74(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_75(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_76(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_77(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_78(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_79(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_7f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_80(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_81(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_82(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_83(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_84(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_85(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_86(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_87(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_88(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_89(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_8f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_90(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_91(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_92(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_93(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_94(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_95(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_96(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_97(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_98(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_99(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9a(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9c(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9e(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_9f(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_a9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_aa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ab(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ac(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ad(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ae(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_af(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_b9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ba(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_bb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_bc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_bd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_be(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_bf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_c9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ca(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_cb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_cc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_cd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ce(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_cf(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_d9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_da(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_db(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_dc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_dd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_de(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_df(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_e9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ea(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ee(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ef(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_f9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_fa(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_fb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_fc(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_fd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_fe(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Table_sse5a_ff(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+
+  template<u8 Mode> bool Operand__Ev_Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBX_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Rv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yv_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Wo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ew(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSP_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r15_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mx_Vx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_Gv_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r8b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yv_Xv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Woqo_Vx_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Md_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Wq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r10_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSP_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ib_eAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Jz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBP_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mq_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Moq_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eAX_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__CH_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DX_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Hx_Wx_Lx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mo_b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mo_Voq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r15_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Sw_Ew(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Uo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Jb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Wob_Vo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ov_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Wy_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r13b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Wo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ry(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Mw_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Uod_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Wow_Vo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ry_Ty(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yb_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Edb_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_Gv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eAX_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eb_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r13_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AL_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AL_Ob(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rCX_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Mw_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST5_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m80fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Uo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ew_Gw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Mq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Hx_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST7_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Md(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mo_Vod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Qq_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Uod_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Hy_Wy_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ib_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Nq_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Qq_Pq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gb_Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDI_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Woq_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DX_Xz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m32fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DX_Xb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mqo_Hx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Uq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ey_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__BL_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AH_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r11_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r15b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ey_Pq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ry_Cy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r14_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Uo_Ib_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r10_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eyw_Vo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Ux(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ew_Sw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mx_Hx_Vx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Wd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Hy_Wo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ES(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Woq_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Hy_Wy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m80bcd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r10b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eb_CL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ma(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_M(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Mo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Mp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDI_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Mv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__By_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__GS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__FS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Wo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r11b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Dy_Ry(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Nq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__CL_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Woq_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBX_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST2_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Wo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Fv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r14_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Uo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDX_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rAX_Xv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DX_eAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Wo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ev_Ibs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rAX_Ov(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DH_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Nq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yb_Xb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eb_1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Ey_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m16int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Mod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Hx_Hx_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ob_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AL_Xb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r12_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r8_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r14b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_CL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rCX_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__CS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ty_Ry(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DL_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m64int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mv_Gv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Hx_Wx_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__By_Ey_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__SS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Wx_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Wow(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ey_Gy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Uo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_By_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r13_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yz_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Ho_Edb_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Wo_Vy_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Woo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ry_Dy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m64fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ey_Vo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r9_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST6_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gv_Ev_Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r9b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Iw_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__DS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Md_x_Hx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m80dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSI_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__m32int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Nq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST1_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r8_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Qd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_Gv_CL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vo_Md_x_Ho(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ey_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST3_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rSI_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Pq_Qq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gy_Ey_By(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Mo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rAX_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Mq_Pq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Gb_Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eb_Gb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__M(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Yb_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rAX_Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__eAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rDX_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__My_Gy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mq_x_Hx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST0_ST1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r11_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r12b_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ev_Ibs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__BH_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vy_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Eyb_Vo_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Iw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Mo_w(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__ST4_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Vx_Hx_Mx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r12_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Wx_Vx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__rBP_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__r9_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__AL_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  template<u8 Mode> bool Operand__Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn);
+  typedef bool (X86Architecture:: *TSemantic)(Instruction&);
+  static const TSemantic m_Semantic[0x69];
+  bool Semantic_00(Instruction& rInsn);
+  bool Semantic_01(Instruction& rInsn);
+  bool Semantic_02(Instruction& rInsn);
+  bool Semantic_03(Instruction& rInsn);
+  bool Semantic_04(Instruction& rInsn);
+  bool Semantic_05(Instruction& rInsn);
+  bool Semantic_06(Instruction& rInsn);
+  bool Semantic_07(Instruction& rInsn);
+  bool Semantic_08(Instruction& rInsn);
+  bool Semantic_09(Instruction& rInsn);
+  bool Semantic_0a(Instruction& rInsn);
+  bool Semantic_0b(Instruction& rInsn);
+  bool Semantic_0c(Instruction& rInsn);
+  bool Semantic_0d(Instruction& rInsn);
+  bool Semantic_0e(Instruction& rInsn);
+  bool Semantic_0f(Instruction& rInsn);
+  bool Semantic_10(Instruction& rInsn);
+  bool Semantic_11(Instruction& rInsn);
+  bool Semantic_12(Instruction& rInsn);
+  bool Semantic_13(Instruction& rInsn);
+  bool Semantic_14(Instruction& rInsn);
+  bool Semantic_15(Instruction& rInsn);
+  bool Semantic_16(Instruction& rInsn);
+  bool Semantic_17(Instruction& rInsn);
+  bool Semantic_18(Instruction& rInsn);
+  bool Semantic_19(Instruction& rInsn);
+  bool Semantic_1a(Instruction& rInsn);
+  bool Semantic_1b(Instruction& rInsn);
+  bool Semantic_1c(Instruction& rInsn);
+  bool Semantic_1d(Instruction& rInsn);
+  bool Semantic_1e(Instruction& rInsn);
+  bool Semantic_1f(Instruction& rInsn);
+  bool Semantic_20(Instruction& rInsn);
+  bool Semantic_21(Instruction& rInsn);
+  bool Semantic_22(Instruction& rInsn);
+  bool Semantic_23(Instruction& rInsn);
+  bool Semantic_24(Instruction& rInsn);
+  bool Semantic_25(Instruction& rInsn);
+  bool Semantic_26(Instruction& rInsn);
+  bool Semantic_27(Instruction& rInsn);
+  bool Semantic_28(Instruction& rInsn);
+  bool Semantic_29(Instruction& rInsn);
+  bool Semantic_2a(Instruction& rInsn);
+  bool Semantic_2b(Instruction& rInsn);
+  bool Semantic_2c(Instruction& rInsn);
+  bool Semantic_2d(Instruction& rInsn);
+  bool Semantic_2e(Instruction& rInsn);
+  bool Semantic_2f(Instruction& rInsn);
+  bool Semantic_30(Instruction& rInsn);
+  bool Semantic_31(Instruction& rInsn);
+  bool Semantic_32(Instruction& rInsn);
+  bool Semantic_33(Instruction& rInsn);
+  bool Semantic_34(Instruction& rInsn);
+  bool Semantic_35(Instruction& rInsn);
+  bool Semantic_36(Instruction& rInsn);
+  bool Semantic_37(Instruction& rInsn);
+  bool Semantic_38(Instruction& rInsn);
+  bool Semantic_39(Instruction& rInsn);
+  bool Semantic_3a(Instruction& rInsn);
+  bool Semantic_3b(Instruction& rInsn);
+  bool Semantic_3c(Instruction& rInsn);
+  bool Semantic_3d(Instruction& rInsn);
+  bool Semantic_3e(Instruction& rInsn);
+  bool Semantic_3f(Instruction& rInsn);
+  bool Semantic_40(Instruction& rInsn);
+  bool Semantic_41(Instruction& rInsn);
+  bool Semantic_42(Instruction& rInsn);
+  bool Semantic_43(Instruction& rInsn);
+  bool Semantic_44(Instruction& rInsn);
+  bool Semantic_45(Instruction& rInsn);
+  bool Semantic_46(Instruction& rInsn);
+  bool Semantic_47(Instruction& rInsn);
+  bool Semantic_48(Instruction& rInsn);
+  bool Semantic_49(Instruction& rInsn);
+  bool Semantic_4a(Instruction& rInsn);
+  bool Semantic_4b(Instruction& rInsn);
+  bool Semantic_4c(Instruction& rInsn);
+  bool Semantic_4d(Instruction& rInsn);
+  bool Semantic_4e(Instruction& rInsn);
+  bool Semantic_4f(Instruction& rInsn);
+  bool Semantic_50(Instruction& rInsn);
+  bool Semantic_51(Instruction& rInsn);
+  bool Semantic_52(Instruction& rInsn);
+  bool Semantic_53(Instruction& rInsn);
+  bool Semantic_54(Instruction& rInsn);
+  bool Semantic_55(Instruction& rInsn);
+  bool Semantic_56(Instruction& rInsn);
+  bool Semantic_57(Instruction& rInsn);
+  bool Semantic_58(Instruction& rInsn);
+  bool Semantic_59(Instruction& rInsn);
+  bool Semantic_5a(Instruction& rInsn);
+  bool Semantic_5b(Instruction& rInsn);
+  bool Semantic_5c(Instruction& rInsn);
+  bool Semantic_5d(Instruction& rInsn);
+  bool Semantic_5e(Instruction& rInsn);
+  bool Semantic_5f(Instruction& rInsn);
+  bool Semantic_60(Instruction& rInsn);
+  bool Semantic_61(Instruction& rInsn);
+  bool Semantic_62(Instruction& rInsn);
+  bool Semantic_63(Instruction& rInsn);
+  bool Semantic_64(Instruction& rInsn);
+  bool Semantic_65(Instruction& rInsn);
+  bool Semantic_66(Instruction& rInsn);
+  bool Semantic_67(Instruction& rInsn);
+  bool Semantic_68(Instruction& rInsn);
+  static const LengthRule m_LengthRule[0xbb7];
+  static const u16 m_LengthChain[0x8b1];
+  static const u16 m_LengthTable[0xe];
+  static const u16 m_LengthGroup[0x16];
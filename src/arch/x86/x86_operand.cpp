@@ -150,11 +150,11 @@ template<X86_Reg Reg16, X86_Reg Reg32, X86_Reg Reg64> struct OperandReg16_32_64_
 
 template<typename ConstType, u32 OpType> struct OperandRead
 {
-  bool operator()(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     ConstType ct;
 
-    rBinStrm.Read(Offset, ct);
+    rWnd.Read(Offset, ct);
     pOprd->SetValue(ct);
     pOprd->SetType(OpType);
     pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -165,11 +165,11 @@ template<typename ConstType, u32 OpType> struct OperandRead
 
 template<typename ConstType, unsigned Pos> struct OperandReadSignExtendSetRelType
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     ConstType ct;
 
-    rBinStrm.Read(Offset, ct);
+    rWnd.Read(Offset, ct);
     pOprd->SetValue(SignExtend<ConstType, Pos>(ct));
     switch (Bit)
     {
@@ -186,11 +186,11 @@ template<typename ConstType, unsigned Pos> struct OperandReadSignExtendSetRelTyp
 
 template<typename ConstType, u32 OpType, unsigned Pos> struct OperandReadSignExtend
 {
-  bool operator()(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     ConstType ct;
 
-    rBinStrm.Read(Offset, ct);
+    rWnd.Read(Offset, ct);
     pOprd->SetValue(SignExtend<ConstType, Pos>(ct));
     pOprd->SetType(OpType);
     pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -201,11 +201,11 @@ template<typename ConstType, u32 OpType, unsigned Pos> struct OperandReadSignExt
 
 template<u32 OpType> struct OperandReadSign32Extend64
 {
-  bool operator()(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     u32 ct;
 
-    rBinStrm.Read(Offset, ct);
+    rWnd.Read(Offset, ct);
     pOprd->SetValue(SignExtend<s64, 32>(ct));
     pOprd->SetType(OpType);
     pOprd->SetOffset(static_cast<u8>(rInsn.GetLength()));
@@ -221,7 +221,7 @@ struct OperandJqs : public OperandReadSign32Extend64      <     O_REL64    >{};
 
 struct OperandJv
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     static OperandJw  OpJw;
     static OperandJd  OpJd;
@@ -230,16 +230,16 @@ struct OperandJv
     switch (Bit)
     {
     case X86_Bit_16:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJd(rBinStrm, Offset, rInsn, pOprd);
-      else                                       return OpJw(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJd(rWnd, Offset, rInsn, pOprd);
+      else                                       return OpJw(rWnd, Offset, rInsn, pOprd);
 
     case X86_Bit_32:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJw(rBinStrm, Offset, rInsn, pOprd);
-      else                                       return OpJd(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJw(rWnd, Offset, rInsn, pOprd);
+      else                                       return OpJd(rWnd, Offset, rInsn, pOprd);
 
     case X86_Bit_64:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJw(rBinStrm, Offset, rInsn, pOprd);
-      else                                       return OpJqs(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpJw(rWnd, Offset, rInsn, pOprd);
+      else                                       return OpJqs(rWnd, Offset, rInsn, pOprd);
 
     default:                                     return false;
     }
@@ -251,7 +251,7 @@ struct OperandOd : public OperandRead<u32, O_DISP32>{};
 struct OperandOq : public OperandRead<u64, O_DISP64>{};
 struct OperandOb // Not sure for this one...
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     static OperandOw OpOw;
     static OperandOd OpOd;
@@ -259,9 +259,9 @@ struct OperandOb // Not sure for this one...
 
     switch (Bit)
     {
-    case X86_Bit_16: if (!OpOw(rBinStrm, Offset, rInsn, pOprd)) return false; break;
-    case X86_Bit_32: if (!OpOd(rBinStrm, Offset, rInsn, pOprd)) return false; break;
-    case X86_Bit_64: if (!OpOq(rBinStrm, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_16: if (!OpOw(rWnd, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_32: if (!OpOd(rWnd, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_64: if (!OpOq(rWnd, Offset, rInsn, pOprd)) return false; break;
     default:         return false;
     }
 
@@ -271,7 +271,7 @@ struct OperandOb // Not sure for this one...
 };
 struct OperandOv
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     static OperandOw OpOw;
     static OperandOd OpOd;
@@ -279,9 +279,9 @@ struct OperandOv
 
     switch (Bit)
     {
-    case X86_Bit_16: if (!OpOw(rBinStrm, Offset, rInsn, pOprd)) return false; break;
-    case X86_Bit_32: if (!OpOd(rBinStrm, Offset, rInsn, pOprd)) return false; break;
-    case X86_Bit_64: if (!OpOq(rBinStrm, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_16: if (!OpOw(rWnd, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_32: if (!OpOd(rWnd, Offset, rInsn, pOprd)) return false; break;
+    case X86_Bit_64: if (!OpOq(rWnd, Offset, rInsn, pOprd)) return false; break;
     default:         return false;
     }
 
@@ -320,7 +320,7 @@ struct OperandIq  : public OperandRead<u64, O_IMM64>{};
 struct OperandIds : public OperandReadSign32Extend64<O_IMM64>{};
 struct OperandIv
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     static OperandIw OpIw;
     static OperandId OpId;
@@ -329,15 +329,15 @@ struct OperandIv
     switch (Bit)
     {
     case X86_Bit_16:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                      return OpId(rBinStrm, Offset, rInsn, pOprd);
-      else                                                            return OpIw(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                      return OpId(rWnd, Offset, rInsn, pOprd);
+      else                                                            return OpIw(rWnd, Offset, rInsn, pOprd);
 
     case X86_Bit_64:
-      if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w) return OpIq(rBinStrm, Offset, rInsn, pOprd);
+      if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w) return OpIq(rWnd, Offset, rInsn, pOprd);
 
     case X86_Bit_32:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                      return OpIw(rBinStrm, Offset, rInsn, pOprd);
-      else                                                            return OpId(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                      return OpIw(rWnd, Offset, rInsn, pOprd);
+      else                                                            return OpId(rWnd, Offset, rInsn, pOprd);
 
     default:                                                          return false;
     }
@@ -345,7 +345,7 @@ struct OperandIv
 };
 struct OperandIz
 {
-  bool operator()(BinaryStream const& rBinStrm, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, X86_Bit Bit, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     static OperandIw OpIw;
     static OperandId OpId;
@@ -354,13 +354,13 @@ struct OperandIz
     switch (Bit)
     {
     case X86_Bit_16:
-      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                           return OpId(rBinStrm, Offset, rInsn, pOprd);
-      else                                                                 return OpIw(rBinStrm, Offset, rInsn, pOprd);
+      if (rInsn.GetPrefix() & X86_Prefix_OpSize)                           return OpId(rWnd, Offset, rInsn, pOprd);
+      else                                                                 return OpIw(rWnd, Offset, rInsn, pOprd);
     case X86_Bit_32:
     case X86_Bit_64:
-      if       (rInsn.GetPrefix() & X86_Prefix_OpSize)                     return OpIw(rBinStrm, Offset, rInsn, pOprd);
-      else if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w) return OpIds(rBinStrm, Offset, rInsn, pOprd);
-      else                                                                 return OpId(rBinStrm, Offset, rInsn, pOprd);
+      if       (rInsn.GetPrefix() & X86_Prefix_OpSize)                     return OpIw(rWnd, Offset, rInsn, pOprd);
+      else if ((rInsn.GetPrefix() & X86_Prefix_REX_w) == X86_Prefix_REX_w) return OpIds(rWnd, Offset, rInsn, pOprd);
+      else                                                                 return OpId(rWnd, Offset, rInsn, pOprd);
     default:                                                               return false;
     }
   }
@@ -368,13 +368,13 @@ struct OperandIz
 
 template<typename OffType, u32 OpType> struct OperandLogicAddr
 {
-  bool operator()(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd)
+  bool operator()(X86Architecture::FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
   {
     u16 Seg;
     OffType Off;
 
-    rBinStrm.Read(Offset + sizeof(OffType), Seg);
-    rBinStrm.Read(Offset, Off);
+    rWnd.Read(Offset + sizeof(OffType), Seg);
+    rWnd.Read(Offset, Off);
     rInsn.Length() += (sizeof(Seg) + sizeof(Off));
     pOprd->SetValue(Off);
     pOprd->SetSegValue(Seg);
@@ -388,44 +388,50 @@ struct OperandLogicAddr32 : public OperandLogicAddr<u32, O_MEM32 | O_DISP32>{};
 
 template<u32 OpType> struct OperandIbs : public OperandReadSignExtend<s8, OpType, 8>{};
 
-static x86::ModRM GetModRm(BinaryStream const& rBinStrm, TOffset Offset)
+static x86::ModRM GetModRm(X86Architecture::FetchWindowType const& rWnd, TOffset Offset)
 {
   u8 ModRmByte;
-  rBinStrm.Read(Offset, ModRmByte);
+  rWnd.Read(Offset, ModRmByte);
   return ModRmByte;
 }
 
-bool X86Architecture::Decode_1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandImm8<1> OpImm1;
   return OpImm1(pOprd);
 }
 
-bool X86Architecture::Decode_3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandImm8<3> OpImm3;
   return OpImm3(pOprd);
 }
 
-bool X86Architecture::Decode_AH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_AH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Ah> OpRegAh;
   return OpRegAh(pOprd);
 }
 
-bool X86Architecture::Decode_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Al> OpRegAl;
   return OpRegAl(pOprd);
 }
 
-bool X86Architecture::Decode_AX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_AX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Ax> OpRegAx;
   return OpRegAx(pOprd);
 }
 
-bool X86Architecture::Decode_Ap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandLogicAddr16 OpLogicAddr16;
   static OperandLogicAddr32 OpLogicAddr32;
@@ -433,53 +439,59 @@ bool X86Architecture::Decode_Ap(BinaryStream const& rBinStrm, TOffset Offset, In
   switch (static_cast<X86_Bit>(Mode))
   {
   case X86_Bit_16:
-    if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpLogicAddr32(rBinStrm, Offset, rInsn, pOprd);
-    else                                       return OpLogicAddr16(rBinStrm, Offset, rInsn, pOprd);
+    if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpLogicAddr32(rWnd, Offset, rInsn, pOprd);
+    else                                       return OpLogicAddr16(rWnd, Offset, rInsn, pOprd);
 
   case X86_Bit_32:
-    if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpLogicAddr16(rBinStrm, Offset, rInsn, pOprd);
-    else                                       return OpLogicAddr32(rBinStrm, Offset, rInsn, pOprd);
+    if (rInsn.GetPrefix() & X86_Prefix_OpSize) return OpLogicAddr16(rWnd, Offset, rInsn, pOprd);
+    else                                       return OpLogicAddr32(rWnd, Offset, rInsn, pOprd);
 
   default:                                     return false;
   }
 }
 
-bool X86Architecture::Decode_BH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_BH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Bh> OpRegBh;
   return OpRegBh(pOprd);
 }
 
-bool X86Architecture::Decode_BL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_BL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Bl> OpRegBl;
   return OpRegBl(pOprd);
 }
 
-bool X86Architecture::Decode_CH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_CH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Ch> OpRegCh;
   return OpRegCh(pOprd);
 }
 
-bool X86Architecture::Decode_CL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_CL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Cl> OpRegCl;
   return OpRegCl(pOprd);
 }
 
-bool X86Architecture::Decode_CS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_CS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Cs> OpRegCs;
   return OpRegCs(pOprd);
 }
 
-bool X86Architecture::Decode_Cy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Cy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg [] = { X86_Reg_Cr0, X86_Reg_Cr1, X86_Reg_Cr2,  X86_Reg_Cr3,  X86_Reg_Cr4,  X86_Reg_Cr5,  X86_Reg_Cr6,  X86_Reg_Cr7  };
   static u16 aRegR[] = { X86_Reg_Cr8, X86_Reg_Cr9, X86_Reg_Cr10, X86_Reg_Cr11, X86_Reg_Cr12, X86_Reg_Cr13, X86_Reg_Cr14, X86_Reg_Cr15 };
 
-  x86::ModRM ModRm = GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm = GetModRm(rWnd, Offset);
 
   pOprd->Type() |= static_cast<X86_Bit>(Mode) == X86_Bit_64 ? O_REG64 : O_REG32;
 
@@ -491,36 +503,41 @@ bool X86Architecture::Decode_Cy(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_DH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_DH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Dh> OpRegDh;
   return OpRegDh(pOprd);
 }
 
-bool X86Architecture::Decode_DL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_DL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_Dl> OpRegDl;
   return OpRegDl(pOprd);
 }
 
-bool X86Architecture::Decode_DS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_DS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Ds> OpRegDs;
   return OpRegDs(pOprd);
 }
 
-bool X86Architecture::Decode_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Dx> OpRegDx;
   return OpRegDx(pOprd);
 }
 
-bool X86Architecture::Decode_Dy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Dy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg [] = { X86_Reg_Dr0, X86_Reg_Dr1, X86_Reg_Dr2,  X86_Reg_Dr3,  X86_Reg_Dr4,  X86_Reg_Dr5,  X86_Reg_Dr6,  X86_Reg_Dr7  };
   static u16 aRegR[] = { X86_Reg_Dr8, X86_Reg_Dr9, X86_Reg_Dr10, X86_Reg_Dr11, X86_Reg_Dr12, X86_Reg_Dr13, X86_Reg_Dr14, X86_Reg_Dr15 };
 
-  x86::ModRM ModRm = GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm = GetModRm(rWnd, Offset);
 
   pOprd->Type() |= static_cast<X86_Bit>(Mode) == X86_Bit_64 ? O_REG64 : O_REG32;
 
@@ -532,35 +549,41 @@ bool X86Architecture::Decode_Dy(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_ES(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ES(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Es> OpRegEs;
   return OpRegEs(pOprd);
 }
 
-bool X86Architecture::Decode_Fv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Fv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   /* XXX: By convention we can safetly ignore this operand */
   return true;
 }
 
-bool X86Architecture::Decode_Ho(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ho(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Hx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Hx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   OperandIb OpIb;
-  return OpIb(rBinStrm, Offset, rInsn, pOprd);
+  return OpIb(rWnd, Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Ibs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ibs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandIbs<O_IMM16> OpIbsw;
   static OperandIbs<O_IMM32> OpIbsd;
@@ -569,116 +592,133 @@ bool X86Architecture::Decode_Ibs(BinaryStream const& rBinStrm, TOffset Offset, I
   auto const& rFirstOprd = rInsn.FirstOperand();
   switch (rFirstOprd.GetLength())
   {
-  case 2: return OpIbsw(rBinStrm, Offset, rInsn, pOprd);
-  case 4: return OpIbsd(rBinStrm, Offset, rInsn, pOprd);
-  case 8: return OpIbsq(rBinStrm, Offset, rInsn, pOprd);
-  default:return Decode_Ib(rBinStrm, Offset, rInsn, pOprd, Mode);
+  case 2: return OpIbsw(rWnd, Offset, rInsn, pOprd);
+  case 4: return OpIbsd(rWnd, Offset, rInsn, pOprd);
+  case 8: return OpIbsq(rWnd, Offset, rInsn, pOprd);
+  default:return Decode_Ib<Mode>(rWnd, Offset, rInsn, pOprd);
   }
 }
 
-bool X86Architecture::Decode_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandIv OpIv;
-  return OpIv(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpIv(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Iw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Iw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandIw OpIw;
-  return OpIw(rBinStrm, Offset, rInsn, pOprd);
+  return OpIw(rWnd, Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandIz OpIz;
-  return OpIz(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpIz(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Jb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Jb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandJb OpJb;
-  return OpJb(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpJb(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Jz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Jz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandJv OpJv;
-  return OpJv(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpJv(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Ob(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ob(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandOb OpOb;
-  return OpOb(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpOb(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_Ov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ov(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandOv OpOv;
-  return OpOv(rBinStrm, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
+  return OpOv(rWnd, static_cast<X86_Bit>(Mode), Offset, rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St0> OpRegSt0;
   return OpRegSt0(pOprd);
 }
 
-bool X86Architecture::Decode_ST1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St1> OpRegSt1;
   return OpRegSt1(pOprd);
 }
 
-bool X86Architecture::Decode_ST2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St2> OpRegSt2;
   return OpRegSt2(pOprd);
 }
 
-bool X86Architecture::Decode_ST3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St3> OpRegSt3;
   return OpRegSt3(pOprd);
 }
 
-bool X86Architecture::Decode_ST4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St4> OpRegSt4;
   return OpRegSt4(pOprd);
 }
 
-bool X86Architecture::Decode_ST5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St5> OpRegSt5;
   return OpRegSt5(pOprd);
 }
 
-bool X86Architecture::Decode_ST6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St6> OpRegSt6;
   return OpRegSt6(pOprd);
 }
 
-bool X86Architecture::Decode_ST7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_ST7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg80<X86_Reg_St7> OpRegSt7;
   return OpRegSt7(pOprd);
 }
 
-bool X86Architecture::Decode_Sw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Sw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg[] = { X86_Reg_Es, X86_Reg_Cs, X86_Reg_Ss, X86_Reg_Ds, X86_Reg_Fs, X86_Reg_Gs, X86_Reg_Seg6, X86_Reg_Seg7 };
   pOprd->Type() |= O_REG16;
-  pOprd->Reg() = aReg[GetModRm(rBinStrm, Offset).Reg()];
+  pOprd->Reg() = aReg[GetModRm(rWnd, Offset).Reg()];
   return true;
 }
 
-bool X86Architecture::Decode_Ty(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Ty(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static u16 aReg [] = { X86_Reg_Tr0, X86_Reg_Tr1, X86_Reg_Tr2,  X86_Reg_Tr3,  X86_Reg_Tr4,  X86_Reg_Tr5,  X86_Reg_Tr6,  X86_Reg_Tr7  };
 
-  x86::ModRM ModRm = GetModRm(rBinStrm, Offset);
+  x86::ModRM ModRm = GetModRm(rWnd, Offset);
 
   pOprd->Type() |= static_cast<X86_Bit>(Mode) == X86_Bit_64 ? O_REG64 : O_REG32;
   pOprd->Reg() = aReg[ModRm.Reg()];
@@ -686,7 +726,8 @@ bool X86Architecture::Decode_Ty(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Xb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Xb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Si, X86_Reg_Esi, X86_Reg_Rsi> OpSi;
   if (OpSi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -697,7 +738,8 @@ bool X86Architecture::Decode_Xb(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Xv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Xv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64_Mem<X86_Reg_Si, X86_Reg_Esi, X86_Reg_Rsi> OpSi;
   if (OpSi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -707,7 +749,8 @@ bool X86Architecture::Decode_Xv(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Xz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Xz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64_Mem<X86_Reg_Si, X86_Reg_Esi, X86_Reg_Rsi> OpSi;
   if (OpSi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -717,7 +760,8 @@ bool X86Architecture::Decode_Xz(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Yb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Yb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Di, X86_Reg_Edi, X86_Reg_Rdi> OpDi;
   if (OpDi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -728,7 +772,8 @@ bool X86Architecture::Decode_Yb(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Yv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Yv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64_Mem<X86_Reg_Di, X86_Reg_Edi, X86_Reg_Rdi> OpDi;
   if (OpDi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -738,7 +783,8 @@ bool X86Architecture::Decode_Yv(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_Yz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_Yz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64_Mem<X86_Reg_Di, X86_Reg_Edi, X86_Reg_Rdi> OpDi;
   if (OpDi(static_cast<X86_Bit>(Mode), rInsn, pOprd) == false)
@@ -748,249 +794,396 @@ bool X86Architecture::Decode_Yz(BinaryStream const& rBinStrm, TOffset Offset, In
   return true;
 }
 
-bool X86Architecture::Decode_d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_eAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Ax, X86_Reg_Eax> OpRegA;
   return OpRegA(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Bp, X86_Reg_Ebp> OpRegBp;
   return OpRegBp(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Bx, X86_Reg_Ebx> OpRegB;
   return OpRegB(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Cx, X86_Reg_Ecx> OpRegC;
   return OpRegC(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Di, X86_Reg_Edi> OpRegDi;
   return OpRegDi(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Dx, X86_Reg_Edx> OpRegD;
   return OpRegD(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Si, X86_Reg_Esi> OpRegSi;
   return OpRegSi(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_eSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_eSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32<X86_Reg_Sp, X86_Reg_Esp> OpRegSp;
   return OpRegSp(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_FS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_FS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Fs> OpRegFs;
   return OpRegFs(pOprd);
 }
 
-bool X86Architecture::Decode_GS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_GS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Gs> OpRegGs;
   return OpRegGs(pOprd);
 }
 
-bool X86Architecture::Decode_q(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_q(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   return false; /* UNHANDLED OPERAND */
 }
 
-bool X86Architecture::Decode_r10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R10w, X86_Reg_R10d, X86_Reg_R10> OpRegR10;
   return OpRegR10(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r10b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r10b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   OperandReg8<X86_Reg_R10b> OpRegR10b;
   return OpRegR10b(pOprd);
 }
 
-bool X86Architecture::Decode_r11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R11w, X86_Reg_R11d, X86_Reg_R11> OpRegR11;
   return OpRegR11(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r11b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r11b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R11b> OpRegR11b;
   return OpRegR11b(pOprd);
 }
 
-bool X86Architecture::Decode_r12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R12w, X86_Reg_R12d, X86_Reg_R12> OpRegR12;
   return OpRegR12(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r12b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r12b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R12b> OpRegR12b;
   return OpRegR12b(pOprd);
 }
 
-bool X86Architecture::Decode_r13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R13w, X86_Reg_R13d, X86_Reg_R13> OpRegR13;
   return OpRegR13(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r13b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r13b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R13b> OpRegR13b;
   return OpRegR13b(pOprd);
 }
 
-bool X86Architecture::Decode_r14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R14w, X86_Reg_R14d, X86_Reg_R14> OpRegR14;
   return OpRegR14(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r14b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r14b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R14b> OpRegR14b;
   return OpRegR14b(pOprd);
 }
 
-bool X86Architecture::Decode_r15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R15w, X86_Reg_R15d, X86_Reg_R15> OpRegR15;
   return OpRegR15(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r15b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r15b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R15b> OpRegR15b;
   return OpRegR15b(pOprd);
 }
 
-bool X86Architecture::Decode_r8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R8w, X86_Reg_R8d, X86_Reg_R8> OpRegR8;
   return OpRegR8(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R8b> OpRegR8b;
   return OpRegR8b(pOprd);
 }
 
-bool X86Architecture::Decode_r9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_R9w, X86_Reg_R9d, X86_Reg_R9> OpRegR9;
   return OpRegR9(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_r9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_r9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg8<X86_Reg_R9b> OpRegR9b;
   return OpRegR9b(pOprd);
 }
 
-bool X86Architecture::Decode_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Ax, X86_Reg_Eax, X86_Reg_Rax> OpRegA;
   return OpRegA(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Bp, X86_Reg_Ebp, X86_Reg_Rbp> OpRegBp;
   return OpRegBp(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Bx, X86_Reg_Ebx, X86_Reg_Rbx> OpRegB;
   return OpRegB(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Cx, X86_Reg_Ecx, X86_Reg_Rcx> OpRegC;
   return OpRegC(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Di, X86_Reg_Edi, X86_Reg_Rdi> OpRegDi;
   return OpRegDi(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Dx, X86_Reg_Edx, X86_Reg_Rdx> OpRegD;
   return OpRegD(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Si, X86_Reg_Esi, X86_Reg_Rsi> OpRegSi;
   return OpRegSi(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_rSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_rSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16_32_64<X86_Reg_Sp, X86_Reg_Esp, X86_Reg_Rsp> OpRegSp;
   return OpRegSp(static_cast<X86_Bit>(Mode), rInsn, pOprd);
 }
 
-bool X86Architecture::Decode_SS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode)
+template<u8 Mode>
+bool X86Architecture::Decode_SS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd)
 {
   static OperandReg16<X86_Reg_Ss> OpRegSs;
   return OpRegSs(pOprd);
 }
 
-bool X86Architecture::Decode_Woqo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Uod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wow(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Vy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Hy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_By(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_x(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_w(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Woo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Edb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Eyb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Eyw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Lx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Mod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Mqo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Mv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Vod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Voq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Wob(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
-bool X86Architecture::Decode_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Woqo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Uod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wow(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Vy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Hy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_By(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_x(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_w(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Woo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Edb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Eyb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Eyw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Lx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Mod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Mqo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Mv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Vod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Voq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Wob(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+template<u8 Mode> bool X86Architecture::Decode_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd){ return false; } // TODO
+
+X86_INSTANTIATE_DECODER(Decode_1);
+X86_INSTANTIATE_DECODER(Decode_3);
+X86_INSTANTIATE_DECODER(Decode_AH);
+X86_INSTANTIATE_DECODER(Decode_AL);
+X86_INSTANTIATE_DECODER(Decode_AX);
+X86_INSTANTIATE_DECODER(Decode_Ap);
+X86_INSTANTIATE_DECODER(Decode_BH);
+X86_INSTANTIATE_DECODER(Decode_BL);
+X86_INSTANTIATE_DECODER(Decode_CH);
+X86_INSTANTIATE_DECODER(Decode_CL);
+X86_INSTANTIATE_DECODER(Decode_CS);
+X86_INSTANTIATE_DECODER(Decode_Cy);
+X86_INSTANTIATE_DECODER(Decode_DH);
+X86_INSTANTIATE_DECODER(Decode_DL);
+X86_INSTANTIATE_DECODER(Decode_DS);
+X86_INSTANTIATE_DECODER(Decode_DX);
+X86_INSTANTIATE_DECODER(Decode_Dy);
+X86_INSTANTIATE_DECODER(Decode_ES);
+X86_INSTANTIATE_DECODER(Decode_Fv);
+X86_INSTANTIATE_DECODER(Decode_Ho);
+X86_INSTANTIATE_DECODER(Decode_Hx);
+X86_INSTANTIATE_DECODER(Decode_Ib);
+X86_INSTANTIATE_DECODER(Decode_Ibs);
+X86_INSTANTIATE_DECODER(Decode_Iv);
+X86_INSTANTIATE_DECODER(Decode_Iw);
+X86_INSTANTIATE_DECODER(Decode_Iz);
+X86_INSTANTIATE_DECODER(Decode_Jb);
+X86_INSTANTIATE_DECODER(Decode_Jz);
+X86_INSTANTIATE_DECODER(Decode_Ob);
+X86_INSTANTIATE_DECODER(Decode_Ov);
+X86_INSTANTIATE_DECODER(Decode_ST0);
+X86_INSTANTIATE_DECODER(Decode_ST1);
+X86_INSTANTIATE_DECODER(Decode_ST2);
+X86_INSTANTIATE_DECODER(Decode_ST3);
+X86_INSTANTIATE_DECODER(Decode_ST4);
+X86_INSTANTIATE_DECODER(Decode_ST5);
+X86_INSTANTIATE_DECODER(Decode_ST6);
+X86_INSTANTIATE_DECODER(Decode_ST7);
+X86_INSTANTIATE_DECODER(Decode_Sw);
+X86_INSTANTIATE_DECODER(Decode_Ty);
+X86_INSTANTIATE_DECODER(Decode_Xb);
+X86_INSTANTIATE_DECODER(Decode_Xv);
+X86_INSTANTIATE_DECODER(Decode_Xz);
+X86_INSTANTIATE_DECODER(Decode_Yb);
+X86_INSTANTIATE_DECODER(Decode_Yv);
+X86_INSTANTIATE_DECODER(Decode_Yz);
+X86_INSTANTIATE_DECODER(Decode_d);
+X86_INSTANTIATE_DECODER(Decode_eAX);
+X86_INSTANTIATE_DECODER(Decode_eBP);
+X86_INSTANTIATE_DECODER(Decode_eBX);
+X86_INSTANTIATE_DECODER(Decode_eCX);
+X86_INSTANTIATE_DECODER(Decode_eDI);
+X86_INSTANTIATE_DECODER(Decode_eDX);
+X86_INSTANTIATE_DECODER(Decode_eSI);
+X86_INSTANTIATE_DECODER(Decode_eSP);
+X86_INSTANTIATE_DECODER(Decode_FS);
+X86_INSTANTIATE_DECODER(Decode_GS);
+X86_INSTANTIATE_DECODER(Decode_q);
+X86_INSTANTIATE_DECODER(Decode_r10);
+X86_INSTANTIATE_DECODER(Decode_r10b);
+X86_INSTANTIATE_DECODER(Decode_r11);
+X86_INSTANTIATE_DECODER(Decode_r11b);
+X86_INSTANTIATE_DECODER(Decode_r12);
+X86_INSTANTIATE_DECODER(Decode_r12b);
+X86_INSTANTIATE_DECODER(Decode_r13);
+X86_INSTANTIATE_DECODER(Decode_r13b);
+X86_INSTANTIATE_DECODER(Decode_r14);
+X86_INSTANTIATE_DECODER(Decode_r14b);
+X86_INSTANTIATE_DECODER(Decode_r15);
+X86_INSTANTIATE_DECODER(Decode_r15b);
+X86_INSTANTIATE_DECODER(Decode_r8);
+X86_INSTANTIATE_DECODER(Decode_r8b);
+X86_INSTANTIATE_DECODER(Decode_r9);
+X86_INSTANTIATE_DECODER(Decode_r9b);
+X86_INSTANTIATE_DECODER(Decode_rAX);
+X86_INSTANTIATE_DECODER(Decode_rBP);
+X86_INSTANTIATE_DECODER(Decode_rBX);
+X86_INSTANTIATE_DECODER(Decode_rCX);
+X86_INSTANTIATE_DECODER(Decode_rDI);
+X86_INSTANTIATE_DECODER(Decode_rDX);
+X86_INSTANTIATE_DECODER(Decode_rSI);
+X86_INSTANTIATE_DECODER(Decode_rSP);
+X86_INSTANTIATE_DECODER(Decode_SS);
+X86_INSTANTIATE_DECODER(Decode_Woqo);
+X86_INSTANTIATE_DECODER(Decode_Wq);
+X86_INSTANTIATE_DECODER(Decode_Moq);
+X86_INSTANTIATE_DECODER(Decode_Wod);
+X86_INSTANTIATE_DECODER(Decode_Uod);
+X86_INSTANTIATE_DECODER(Decode_Wow);
+X86_INSTANTIATE_DECODER(Decode_Vy);
+X86_INSTANTIATE_DECODER(Decode_Hy);
+X86_INSTANTIATE_DECODER(Decode_By);
+X86_INSTANTIATE_DECODER(Decode_b);
+X86_INSTANTIATE_DECODER(Decode_x);
+X86_INSTANTIATE_DECODER(Decode_w);
+X86_INSTANTIATE_DECODER(Decode_Woo);
+X86_INSTANTIATE_DECODER(Decode_Wy);
+X86_INSTANTIATE_DECODER(Decode_Edb);
+X86_INSTANTIATE_DECODER(Decode_Eyb);
+X86_INSTANTIATE_DECODER(Decode_Eyw);
+X86_INSTANTIATE_DECODER(Decode_Lx);
+X86_INSTANTIATE_DECODER(Decode_Mod);
+X86_INSTANTIATE_DECODER(Decode_Mqo);
+X86_INSTANTIATE_DECODER(Decode_Mv);
+X86_INSTANTIATE_DECODER(Decode_Vod);
+X86_INSTANTIATE_DECODER(Decode_Voq);
+X86_INSTANTIATE_DECODER(Decode_Wd);
+X86_INSTANTIATE_DECODER(Decode_Wob);
+X86_INSTANTIATE_DECODER(Decode_Woq);
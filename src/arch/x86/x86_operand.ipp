@@ -1,149 +1,149 @@
-bool Decode_1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_AH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_AL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_AX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ap(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_BH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_BL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_CH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_CL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_CS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Cy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_DH(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_DL(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_DS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_DX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Dy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ES(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Eb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ed(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ev(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ew(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ey(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Fv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Gb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Gv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Gw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Gy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ho(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Hx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ib(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ibs(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Iv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Iw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Iz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Jb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Jz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_M(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ma(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Md(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_My(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Nq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ob(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ov(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Pq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Qd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Qq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Rd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Rv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ry(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST0(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST1(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST2(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST3(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST4(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST5(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST6(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_ST7(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Sw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ty(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Uo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Uq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Ux(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Vo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Vx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Xb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Xv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Xz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Yb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Yv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Yz(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_d(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_eSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_FS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_GS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m16int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m32fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m32int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m64fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m64int(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m80fp(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m80dec(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_m80bcd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_q(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r10(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r10b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r11(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r11b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r12(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r12b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r13(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r13b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r14(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r14b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r15(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r15b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r8(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r8b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r9(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_r9b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rAX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rBP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rBX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rCX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rDI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rDX(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rSI(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_rSP(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_SS(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Woqo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Moq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Uod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wow(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Vy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Hy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_By(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_b(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_x(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_w(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Woo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wy(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Edb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Eyb(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Eyw(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Lx(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mqo(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Mv(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Vod(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Voq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wd(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Wob(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
-bool Decode_Woq(BinaryStream const& rBinStrm, TOffset Offset, Instruction& rInsn, Operand* pOprd, u8 Mode);
+template<u8 Mode> bool Decode_1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_AH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_AL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_AX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ap(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_BH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_BL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_CH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_CL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_CS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Cy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_DH(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_DL(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_DS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_DX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Dy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ES(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Eb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ed(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ev(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ew(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ey(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Fv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Gb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Gv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Gw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Gy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ho(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Hx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ib(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ibs(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Iv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Iw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Iz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Jb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Jz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_M(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ma(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Md(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_My(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Nq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ob(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ov(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Pq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Qd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Qq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Rd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Rv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ry(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST0(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST1(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST2(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST3(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST4(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST5(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST6(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_ST7(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Sw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ty(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Uo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Uq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Ux(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Vo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Vx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Xb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Xv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Xz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Yb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Yv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Yz(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_d(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_eSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_FS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_GS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m16int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m32fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m32int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m64fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m64int(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m80fp(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m80dec(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_m80bcd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_q(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r10(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r10b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r11(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r11b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r12(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r12b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r13(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r13b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r14(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r14b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r15(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r15b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r8(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r8b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r9(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_r9b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rAX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rBP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rBX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rCX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rDI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rDX(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rSI(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_rSP(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_SS(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Woqo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Moq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Uod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wow(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Vy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Hy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_By(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_b(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_x(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_w(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Woo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wy(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Edb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Eyb(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Eyw(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Lx(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mqo(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Mv(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Vod(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Voq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wd(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Wob(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
+template<u8 Mode> bool Decode_Woq(FetchWindowType const& rWnd, TOffset Offset, Instruction& rInsn, Operand* pOprd);
@@ -0,0 +1,147 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <boost/filesystem.hpp>
+
+#include <medusa/medusa.hpp>
+#include <medusa/module.hpp>
+#include <medusa/log.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark analyzes each file given on the command line and reports how
+// many heap allocations were made for each instruction found by the analysis.
+// Allocations are counted by replacing the global operator new, the analysis
+// workers are counted too.
+//
+// -n selects the number of analyses of each file, -w the number of workers.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static std::atomic<u64> s_AllocNo(0);
+
+void* operator new(std::size_t Size)
+{
+  s_AllocNo.fetch_add(1, std::memory_order_relaxed);
+  void* pMem = std::malloc(Size != 0 ? Size : 1);
+  if (pMem == nullptr)
+    throw std::bad_alloc();
+  return pMem;
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+static double ElapsedMs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count()) / 1000.0;
+}
+
+static bool AnalyzeFile(boost::filesystem::path const& rFilePath, u32 WorkerNo, u64& rInsnNo, u64& rAllocNo, double& rElapsedMs)
+{
+  auto& rModMgr = ModuleManager::Instance();
+
+  BinaryStream::SharedPtr spBinStrm = std::make_shared<FileBinaryStream>(rFilePath.wstring());
+
+  auto Ldrs = rModMgr.GetLoaders(*spBinStrm);
+  if (Ldrs.empty())
+    return false;
+  auto spLdr = Ldrs.front();
+
+  auto Archs = rModMgr.GetArchitectures();
+  spLdr->FilterAndConfigureArchitectures(Archs);
+  if (Archs.empty())
+    return false;
+
+  auto spOs = rModMgr.GetOperatingSystem(spLdr, Archs.front());
+
+  auto spDb = rModMgr.GetDatabase("Text");
+  if (spDb == nullptr)
+    return false;
+
+  auto DbPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("medusa-bench-%%%%-%%%%-%%%%.mdt");
+  if (!spDb->Create(DbPath, true))
+    return false;
+
+  bool Res;
+  {
+    Medusa Core;
+    Core.GetAnalyzer().SetNumberOfWorkers(WorkerNo);
+
+    u64 AllocNo = s_AllocNo.load();
+    auto Start = Clock::now();
+    Res = Core.Start(spBinStrm, spDb, spLdr, Archs, spOs);
+    Core.WaitForTasks();
+    rElapsedMs = ElapsedMs(Start);
+    rAllocNo = s_AllocNo.load() - AllocNo;
+
+    rInsnNo = 0;
+    Core.GetDocument().ForEachMemoryArea([&rInsnNo](MemoryArea const& rMemArea)
+    {
+      rMemArea.ForEachCellData([&rInsnNo](TOffset, CellData::SPtr spCellData)
+      {
+        if (spCellData != nullptr && spCellData->GetType() == Cell::InstructionType)
+          ++rInsnNo;
+      });
+    });
+  }
+
+  boost::system::error_code Err;
+  boost::filesystem::remove(DbPath, Err);
+  return Res;
+}
+
+int main(int argc, char** argv)
+{
+  u32 PassNo   = 3;
+  u32 WorkerNo = 1;
+  std::vector<boost::filesystem::path> Files;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if      (Arg == "-n" && i + 1 < argc) PassNo   = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-w" && i + 1 < argc) WorkerNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else Files.push_back(Arg);
+  }
+
+  if (Files.empty())
+  {
+    std::cerr << "usage: " << argv[0] << " [-n pass_number] [-w worker_number] file..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Log::SetLog([](std::string const&) {});
+  ModuleManager::Instance().LoadModules(".");
+
+  for (auto itFile = std::begin(Files); itFile != std::end(Files); ++itFile)
+  {
+    for (u32 Pass = 0; Pass < PassNo; ++Pass)
+    {
+      u64 InsnNo = 0, AllocNo = 0;
+      double ElapsedMs = 0.0;
+      std::cout << std::left << std::setw(24) << itFile->filename().string().substr(0, 23) << std::right;
+      if (!AnalyzeFile(*itFile, WorkerNo, InsnNo, AllocNo, ElapsedMs))
+      {
+        std::cout << "failed" << std::endl;
+        break;
+      }
+      std::cout << std::fixed
+        << std::setw(10) << std::setprecision(1) << ElapsedMs << " ms"
+        << std::setw(10) << InsnNo << " insns"
+        << std::setw(12) << AllocNo << " allocs"
+        << std::setw(8)  << std::setprecision(2) << (InsnNo != 0 ? static_cast<double>(AllocNo) / InsnNo : 0.0) << " allocs/insn"
+        << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+
+#include <boost/filesystem.hpp>
+
+#include <medusa/medusa.hpp>
+#include <medusa/module.hpp>
+#include <medusa/log.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark analyzes a batch of binaries in the same process. Each
+// binary gets its own Medusa instance, modules are only loaded once and
+// several documents are analyzed concurrently.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Result
+{
+  bool   m_Success;
+  size_t m_MultiCellNo;
+  double m_ElapsedMs;
+};
+
+static double ElapsedMs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count()) / 1000.0;
+}
+
+static bool AnalyzeFile(boost::filesystem::path const& rFilePath, u32 AnalyzerWorkerNo, size_t& rMultiCellNo)
+{
+  auto& rModMgr = ModuleManager::Instance();
+
+  BinaryStream::SharedPtr spBinStrm = std::make_shared<FileBinaryStream>(rFilePath.wstring());
+
+  auto Ldrs = rModMgr.GetLoaders(*spBinStrm);
+  if (Ldrs.empty())
+    return false;
+  auto spLdr = Ldrs.front();
+
+  auto Archs = rModMgr.GetArchitectures();
+  spLdr->FilterAndConfigureArchitectures(Archs);
+  if (Archs.empty())
+    return false;
+
+  auto spOs = rModMgr.GetOperatingSystem(spLdr, Archs.front());
+
+  auto spDb = rModMgr.GetDatabase("Text");
+  if (spDb == nullptr)
+    return false;
+
+  auto DbPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("medusa-bench-%%%%-%%%%-%%%%.mdt");
+  if (!spDb->Create(DbPath, true))
+    return false;
+
+  bool Res;
+  {
+    Medusa Core;
+    Core.GetAnalyzer().SetNumberOfWorkers(AnalyzerWorkerNo);
+    Res = Core.Start(spBinStrm, spDb, spLdr, Archs, spOs);
+    Core.WaitForTasks();
+    rMultiCellNo = Core.GetDocument().GetMultiCells().size();
+  }
+
+  boost::system::error_code Err;
+  boost::filesystem::remove(DbPath, Err);
+  return Res;
+}
+
+static double RunBatch(std::vector<boost::filesystem::path> const& rFiles, u32 ThreadNo, std::vector<Result>& rResults)
+{
+  u32 AnalyzerWorkerNo = std::max(std::thread::hardware_concurrency() / ThreadNo, 1U);
+  std::atomic<size_t> NextFile(0);
+
+  rResults.assign(rFiles.size(), Result());
+
+  auto Worker = [&]()
+  {
+    size_t FileIdx;
+    while ((FileIdx = NextFile++) < rFiles.size())
+    {
+      auto& rResult = rResults[FileIdx];
+      auto Start = Clock::now();
+      rResult.m_MultiCellNo = 0;
+      rResult.m_Success = AnalyzeFile(rFiles[FileIdx], AnalyzerWorkerNo, rResult.m_MultiCellNo);
+      rResult.m_ElapsedMs = ElapsedMs(Start);
+    }
+  };
+
+  auto Start = Clock::now();
+  std::vector<std::thread> Threads;
+  for (u32 i = 0; i < ThreadNo; ++i)
+    Threads.push_back(std::thread(Worker));
+  for (auto& rThread : Threads)
+    rThread.join();
+  return ElapsedMs(Start);
+}
+
+int main(int argc, char** argv)
+{
+  u32 ThreadNo = std::max(std::thread::hardware_concurrency(), 1U);
+  boost::filesystem::path ModPath = ".";
+  std::vector<boost::filesystem::path> Files;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if (Arg == "-j" && i + 1 < argc)
+      ThreadNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-m" && i + 1 < argc)
+      ModPath = argv[++i];
+    else
+      Files.push_back(Arg);
+  }
+
+  if (Files.empty())
+  {
+    std::cerr << "usage: " << argv[0] << " [-j thread_number] [-m module_path] file..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto Start = Clock::now();
+  ModuleManager::Instance().LoadModules(ModPath);
+  std::cout << std::left << std::setw(40) << "load modules (once)" << std::right
+    << std::setw(12) << std::fixed << std::setprecision(1) << ElapsedMs(Start) << " ms" << std::endl;
+
+  std::vector<Result> Sequential, Concurrent;
+  double SequentialMs = RunBatch(Files, 1, Sequential);
+  double ConcurrentMs = RunBatch(Files, ThreadNo, Concurrent);
+
+  for (size_t i = 0; i < Files.size(); ++i)
+  {
+    std::cout << std::left << std::setw(40) << Files[i].filename().string() << std::right;
+    if (!Sequential[i].m_Success || !Concurrent[i].m_Success)
+    {
+      std::cout << std::setw(12) << "failed" << std::endl;
+      continue;
+    }
+    std::cout
+      << std::setw(12) << Sequential[i].m_ElapsedMs << " ms, "
+      << std::setw(8) << Concurrent[i].m_ElapsedMs << " ms concurrently, "
+      << Sequential[i].m_MultiCellNo << " multicells"
+      << (Sequential[i].m_MultiCellNo != Concurrent[i].m_MultiCellNo ? " (mismatch)" : "")
+      << std::endl;
+  }
+
+  std::cout << std::left << std::setw(40) << "batch, 1 thread" << std::right
+    << std::setw(12) << SequentialMs << " ms" << std::endl;
+  std::cout << std::left << std::setw(40) << (std::string("batch, ") + std::to_string(ThreadNo) + " threads") << std::right
+    << std::setw(12) << ConcurrentMs << " ms, speedup " << std::setprecision(2) << SequentialMs / ConcurrentMs << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,529 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+#include <new>
+
+#include <boost/filesystem.hpp>
+
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/binary_stream.hpp>
+#include <medusa/instruction.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark decodes a set of deterministic corpora with every
+// architecture and mode. Each architecture is run with every option of
+// s_Options disabled then enabled; linear sweeps are run once more with
+// Architecture::DisassembleRange and Architecture::DecodeLength. Heap
+// allocations are counted by replacing the global operator new.
+//
+// Sweep corpora are decoded linearly, a failed decoding skips one byte so the
+// same bytes are sampled by each decoder:
+//  - random: 1 MiB of random bytes,
+//  - system: the .text section of a few system binaries, if they are found,
+//    only decoded by the architecture and mode of the binary,
+//  - file: the file given on the command line, instead of every other corpus.
+// Slot corpora decode one little endian instruction per slot instead:
+//  - x86map: every one-byte and two-byte (0F xx) opcode with a few ModR/M,
+//  - word16: every 16-bit word (the whole Thumb and AVR opcode space),
+//  - word32: random 32-bit words.
+//
+// -c selects one corpus, -a one architecture, -n the number of passes and -f
+// csv prints one machine-readable line per run instead of a table. -x compares
+// the result of DecodeLength with Disassemble on every sampled instruction.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+// Architecture options compared by this benchmark, unknown ones are skipped
+static char const* s_Options[] = { "Lazy semantic", "Opcode table" };
+
+static u64  s_AllocNo = 0;
+static bool s_Csv     = false;
+static bool s_Check   = false;
+
+void* operator new(std::size_t Size)
+{
+  ++s_AllocNo;
+  void* pMem = std::malloc(Size != 0 ? Size : 1);
+  if (pMem == nullptr)
+    throw std::bad_alloc();
+  return pMem;
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+struct Corpus
+{
+  std::string     m_Name;
+  std::vector<u8> m_Bytes;
+  u32             m_Stride;   // 0 for a linear sweep
+  std::string     m_ArchName; // empty for every architecture
+  std::string     m_ModeName; // empty for every mode
+};
+
+static double ElapsedNs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count());
+}
+
+static void Report(Corpus const& rCorpus, Architecture const& rArch, std::string const& rMode, std::string const& rVariant,
+  double TotalNs, u64 InsnNo, u64 ByteNo, u64 AllocNo, u32 PassNo)
+{
+  double NsPerInsn     = InsnNo != 0 ? TotalNs / InsnNo : 0.0;
+  double InsnsPerSec   = TotalNs != 0.0 ? InsnNo / (TotalNs / 1e9) : 0.0;
+  double MibPerSec     = TotalNs != 0.0 ? (ByteNo / (1024.0 * 1024.0)) / (TotalNs / 1e9) : 0.0;
+  double AllocsPerInsn = InsnNo != 0 ? static_cast<double>(AllocNo) / InsnNo : 0.0;
+
+  if (s_Csv)
+  {
+    std::cout << rCorpus.m_Name << "," << rArch.GetName() << "," << rMode << "," << rVariant << "," << InsnNo / PassNo
+      << std::fixed << std::setprecision(2)
+      << "," << NsPerInsn << "," << std::setprecision(0) << InsnsPerSec << "," << std::setprecision(2) << MibPerSec
+      << "," << std::setprecision(3) << AllocsPerInsn
+      << std::endl;
+    return;
+  }
+
+  std::cout << std::left << std::setw(48) << (rArch.GetName() + " (" + rMode + ", " + rVariant + ")") << std::right
+    << std::setw(10) << std::fixed << std::setprecision(1) << NsPerInsn << " ns/insn"
+    << std::setw(8) << std::setprecision(2) << InsnsPerSec / 1e6 << " Minsn/s"
+    << std::setw(10) << MibPerSec << " MiB/s"
+    << std::setw(8) << std::setprecision(1) << AllocsPerInsn << " allocs/insn"
+    << std::setw(12) << InsnNo / PassNo << " insns"
+    << std::endl;
+}
+
+static void Sweep(Architecture& rArch, Corpus const& rCorpus, std::string const& rMode, std::string const& rVariant,
+  u8 Mode, BinaryStream const& rBinStrm, u32 PassNo)
+{
+  u64 InsnNo = 0, ByteNo = 0;
+  u64 AllocNo = s_AllocNo;
+  auto Start = Clock::now();
+
+  for (u32 Pass = 0; Pass < PassNo; ++Pass)
+  {
+    TOffset Offset = 0;
+    while (Offset < rBinStrm.GetSize())
+    {
+      Instruction Insn;
+      bool Res = rArch.Disassemble(rBinStrm, Offset, Insn, Mode) && Insn.GetLength() != 0;
+      if (Res)
+        ++InsnNo;
+
+      if (rCorpus.m_Stride != 0)
+        Offset += rCorpus.m_Stride;
+      else if (Res)
+        Offset += Insn.GetLength();
+      else
+        ++Offset;
+    }
+    ByteNo += rBinStrm.GetSize();
+  }
+
+  double TotalNs = ElapsedNs(Start);
+  Report(rCorpus, rArch, rMode, rVariant, TotalNs, InsnNo, ByteNo, s_AllocNo - AllocNo, PassNo);
+}
+
+static void SweepRange(Architecture& rArch, Corpus const& rCorpus, std::string const& rMode,
+  u8 Mode, BinaryStream const& rBinStrm, u32 PassNo)
+{
+  InstructionRecord::Vector Records;
+  u64 InsnNo = 0, ByteNo = 0;
+  u64 AllocNo = s_AllocNo;
+  auto Start = Clock::now();
+
+  for (u32 Pass = 0; Pass < PassNo; ++Pass)
+  {
+    Records.clear();
+    InsnNo += rArch.DisassembleRange(rBinStrm, 0, rBinStrm.GetSize(), Mode, Records);
+    ByteNo += rBinStrm.GetSize();
+  }
+
+  double TotalNs = ElapsedNs(Start);
+  Report(rCorpus, rArch, rMode, "range", TotalNs, InsnNo, ByteNo, s_AllocNo - AllocNo, PassNo);
+}
+
+static void SweepLength(Architecture& rArch, Corpus const& rCorpus, std::string const& rMode,
+  u8 Mode, BinaryStream const& rBinStrm, u32 PassNo)
+{
+  u64 InsnNo = 0, ByteNo = 0;
+  u64 AllocNo = s_AllocNo;
+  auto Start = Clock::now();
+
+  for (u32 Pass = 0; Pass < PassNo; ++Pass)
+  {
+    TOffset Offset = 0;
+    while (Offset < rBinStrm.GetSize())
+    {
+      u16 Length;
+      u8 SubType;
+      bool Res = rArch.DecodeLength(rBinStrm, Offset, Mode, Length, SubType);
+      if (Res)
+        ++InsnNo;
+
+      if (rCorpus.m_Stride != 0)
+        Offset += rCorpus.m_Stride;
+      else if (Res)
+        Offset += Length;
+      else
+        ++Offset;
+    }
+    ByteNo += rBinStrm.GetSize();
+  }
+
+  double TotalNs = ElapsedNs(Start);
+  Report(rCorpus, rArch, rMode, "length", TotalNs, InsnNo, ByteNo, s_AllocNo - AllocNo, PassNo);
+}
+
+// Follows the full decoder, instructions which may cross the end of the corpus are skipped
+static void CheckLength(Architecture& rArch, Corpus const& rCorpus, std::string const& rMode,
+  u8 Mode, BinaryStream const& rBinStrm)
+{
+  static u32 const MaxReportNo = 8;
+  u64 SameNo = 0, LengthNo = 0, SubTypeNo = 0, DecodeOnlyNo = 0, LengthOnlyNo = 0;
+  TOffset EndOffset = rBinStrm.GetSize() > rArch.GetMaximumInstructionLength() ? rBinStrm.GetSize() - rArch.GetMaximumInstructionLength() : 0;
+  TOffset Offset = 0;
+
+  while (Offset < EndOffset)
+  {
+    Instruction Insn;
+    bool InsnRes = rArch.Disassemble(rBinStrm, Offset, Insn, Mode) && Insn.GetLength() != 0;
+    u16 Length = 0;
+    u8 SubType = 0;
+    bool LenRes = rArch.DecodeLength(rBinStrm, Offset, Mode, Length, SubType);
+
+    bool Same = InsnRes == LenRes;
+    if (InsnRes && LenRes)
+    {
+      if (Insn.GetLength() != Length)         { ++LengthNo;  Same = false; }
+      else if (Insn.GetSubType() != SubType)  { ++SubTypeNo; Same = false; }
+    }
+    else if (InsnRes)
+      ++DecodeOnlyNo;
+    else if (LenRes)
+      ++LengthOnlyNo;
+
+    if (Same)
+      ++SameNo;
+    else if (LengthNo + SubTypeNo + DecodeOnlyNo + LengthOnlyNo <= MaxReportNo)
+    {
+      std::cout << "  mismatch at " << std::hex << Offset << ":";
+      for (TOffset Cur = Offset; Cur < Offset + rArch.GetMaximumInstructionLength(); ++Cur)
+        std::cout << " " << std::setw(2) << std::setfill('0') << static_cast<u32>(rCorpus.m_Bytes[Cur]);
+      std::cout << std::setfill(' ') << std::dec
+        << " decode " << (InsnRes ? Insn.GetLength() : 0) << "/" << (InsnRes ? static_cast<u32>(Insn.GetSubType()) : 0)
+        << " (" << (Insn.GetName() != nullptr ? Insn.GetName() : "") << ")"
+        << " length " << (LenRes ? Length : 0) << "/" << static_cast<u32>(SubType)
+        << std::endl;
+    }
+
+    if (rCorpus.m_Stride != 0)
+      Offset += rCorpus.m_Stride;
+    else if (InsnRes)
+      Offset += Insn.GetLength();
+    else
+      ++Offset;
+  }
+
+  std::cout << std::left << std::setw(48) << (rArch.GetName() + " (" + rMode + ", length check)") << std::right
+    << std::setw(12) << SameNo << " same"
+    << std::setw(8) << LengthNo << " length"
+    << std::setw(8) << SubTypeNo << " sub type"
+    << std::setw(8) << DecodeOnlyNo << " decode only"
+    << std::setw(8) << LengthOnlyNo << " length only"
+    << std::endl;
+}
+
+static Corpus MakeRandom(std::mt19937& rRng, std::string const& rName, u32 Size, u32 Stride)
+{
+  Corpus Res = { rName, std::vector<u8>(Size), Stride, "", "" };
+  for (auto& rByte : Res.m_Bytes)
+    rByte = static_cast<u8>(rRng());
+  return Res;
+}
+
+static Corpus MakeWord16(void)
+{
+  // Each word is repeated, so 32-bit encodings are tried with it too
+  Corpus Res = { "word16", std::vector<u8>(), 4, "", "" };
+  for (u32 Word = 0; Word < 0x10000; ++Word)
+    for (u32 i = 0; i < 2; ++i)
+    {
+      Res.m_Bytes.push_back(static_cast<u8>(Word));
+      Res.m_Bytes.push_back(static_cast<u8>(Word >> 8));
+    }
+  return Res;
+}
+
+static Corpus MakeX86OpcodeMap(void)
+{
+  // The ModR/M select a memory operand with a SIB, a disp32 and a register,
+  // the remaining bytes of the slot provide the displacement and immediates
+  static u8 const s_ModRm[] = { 0x04, 0x05, 0x44, 0x80, 0xc0, 0xd8 };
+  static u32 const SlotSize = 16;
+
+  Corpus Res = { "x86map", std::vector<u8>(), SlotSize, "Intel x86", "" };
+  for (u32 Map = 0; Map < 2; ++Map)
+    for (u32 Opcode = 0; Opcode < 0x100; ++Opcode)
+      for (u8 ModRm : s_ModRm)
+      {
+        size_t Slot = Res.m_Bytes.size();
+        if (Map != 0)
+          Res.m_Bytes.push_back(0x0f);
+        Res.m_Bytes.push_back(static_cast<u8>(Opcode));
+        Res.m_Bytes.push_back(ModRm);
+        for (u8 Filler = 0x24; Res.m_Bytes.size() < Slot + SlotSize; Filler += 0x11)
+          Res.m_Bytes.push_back(Filler);
+      }
+  return Res;
+}
+
+// Extracts the .text section of a little endian ELF file and the architecture which decodes it
+static bool MakeElfText(boost::filesystem::path const& rPath, Corpus& rCorpus)
+{
+  boost::system::error_code Err;
+  if (!boost::filesystem::is_regular_file(rPath, Err))
+    return false;
+
+  try
+  {
+    FileBinaryStream BinStrm(rPath);
+    BinStrm.SetEndianness(LittleEndian);
+
+    u8 Ident[6];
+    if (!BinStrm.Read(0, Ident, sizeof(Ident)) || memcmp(Ident, "\x7f" "ELF", 4) != 0 || Ident[5] != 1 /* ELFDATA2LSB */)
+      return false;
+    bool Is64 = Ident[4] == 2 /* ELFCLASS64 */;
+
+    u16 Machine, ShEntSize, ShNum, ShStrNdx;
+    u64 ShOff = 0;
+    if (!BinStrm.Read(0x12, Machine))
+      return false;
+    switch (Machine)
+    {
+    case 3:  rCorpus.m_ArchName = "Intel x86";       rCorpus.m_ModeName = "32-bit"; break;
+    case 62: rCorpus.m_ArchName = "Intel x86";       rCorpus.m_ModeName = "64-bit"; break;
+    case 40: rCorpus.m_ArchName = "ARM";             rCorpus.m_ModeName = "arm";    break;
+    case 83: rCorpus.m_ArchName = "Atmel AVR 8-bit"; rCorpus.m_ModeName = "";       break;
+    default: return false;
+    }
+
+    if (Is64)
+    {
+      if (!BinStrm.Read(0x28, ShOff))
+        return false;
+    }
+    else
+    {
+      u32 ShOff32;
+      if (!BinStrm.Read(0x20, ShOff32))
+        return false;
+      ShOff = ShOff32;
+    }
+    TOffset HdrOff = Is64 ? 0x3a : 0x2e;
+    if (!BinStrm.Read(HdrOff, ShEntSize) || !BinStrm.Read(HdrOff + 2, ShNum) || !BinStrm.Read(HdrOff + 4, ShStrNdx))
+      return false;
+
+    // Returns the name offset, file offset and size of a section header
+    auto ReadSection = [&](u16 Index, u32& rName, u64& rOffset, u64& rSize) -> bool
+    {
+      TOffset SecOff = ShOff + static_cast<u64>(Index) * ShEntSize;
+      if (!BinStrm.Read(SecOff, rName))
+        return false;
+      if (Is64)
+        return BinStrm.Read(SecOff + 0x18, rOffset) && BinStrm.Read(SecOff + 0x20, rSize);
+      u32 Offset32, Size32;
+      if (!BinStrm.Read(SecOff + 0x10, Offset32) || !BinStrm.Read(SecOff + 0x14, Size32))
+        return false;
+      rOffset = Offset32;
+      rSize   = Size32;
+      return true;
+    };
+
+    u32 Name;
+    u64 StrTabOff, StrTabSize;
+    if (ShStrNdx >= ShNum || !ReadSection(ShStrNdx, Name, StrTabOff, StrTabSize))
+      return false;
+
+    for (u16 Index = 0; Index < ShNum; ++Index)
+    {
+      u64 Offset, Size;
+      char SecName[6];
+      if (!ReadSection(Index, Name, Offset, Size) || Name + sizeof(SecName) > StrTabSize)
+        continue;
+      if (!BinStrm.Read(StrTabOff + Name, SecName, sizeof(SecName)) || memcmp(SecName, ".text", sizeof(SecName)) != 0)
+        continue;
+
+      rCorpus.m_Bytes.resize(static_cast<size_t>(Size));
+      if (!BinStrm.Read(Offset, rCorpus.m_Bytes.data(), rCorpus.m_Bytes.size()))
+        return false;
+      rCorpus.m_Name   = "system:" + rPath.filename().string();
+      rCorpus.m_Stride = 0;
+      return !rCorpus.m_Bytes.empty();
+    }
+  }
+  catch (Exception const&)
+  {
+  }
+
+  return false;
+}
+
+static void MakeSystem(std::vector<Corpus>& rCorpora)
+{
+  static char const* s_Paths[] =
+  {
+    "/bin/ls",
+    "/bin/bash",
+    "/lib/x86_64-linux-gnu/libc.so.6",
+    "/usr/lib/libc.so.6",
+    "/lib/i386-linux-gnu/libc.so.6",
+    "/lib/arm-linux-gnueabihf/libc.so.6",
+  };
+
+  for (auto pPath : s_Paths)
+  {
+    Corpus Res;
+    if (MakeElfText(pPath, Res))
+      rCorpora.push_back(std::move(Res));
+  }
+}
+
+static void Run(Architecture& rArch, Corpus const& rCorpus, u32 PassNo)
+{
+  MemoryBinaryStream BinStrm(rCorpus.m_Bytes.data(), static_cast<u32>(rCorpus.m_Bytes.size()));
+  BinStrm.SetEndianness(rCorpus.m_Stride != 0 ? LittleEndian : rArch.GetEndianness());
+
+  auto& rCfgMdl = rArch.GetConfigurationModel();
+  for (auto const& rMode : rArch.GetModes())
+  {
+    std::string ModeName = std::get<0>(rMode);
+    if (!rCorpus.m_ModeName.empty() && ModeName != rCorpus.m_ModeName)
+      continue;
+
+    for (auto pOption : s_Options)
+    {
+      if (!rCfgMdl.IsSet(pOption))
+        continue;
+
+      bool Default = rCfgMdl.GetBoolean(pOption);
+      for (bool Enabled : { false, true })
+      {
+        std::string Option = pOption;
+        std::transform(std::begin(Option), std::end(Option), std::begin(Option), ::tolower);
+        rCfgMdl.SetBoolean(pOption, Enabled);
+        Sweep(rArch, rCorpus, ModeName, (Enabled ? "" : "no ") + Option, std::get<1>(rMode), BinStrm, PassNo);
+      }
+      rCfgMdl.SetBoolean(pOption, Default);
+    }
+
+    SweepLength(rArch, rCorpus, ModeName, std::get<1>(rMode), BinStrm, PassNo);
+    if (s_Check && !s_Csv)
+      CheckLength(rArch, rCorpus, ModeName, std::get<1>(rMode), BinStrm);
+  }
+
+  if (rCorpus.m_Stride == 0)
+    for (auto const& rMode : rArch.GetModes())
+      if (rCorpus.m_ModeName.empty() || std::get<0>(rMode) == rCorpus.m_ModeName)
+        SweepRange(rArch, rCorpus, std::get<0>(rMode), std::get<1>(rMode), BinStrm, PassNo);
+}
+
+int main(int argc, char** argv)
+{
+  boost::filesystem::path ModPath = ".";
+  boost::filesystem::path FilePath;
+  std::string CorpusName = "all", ArchName;
+  u32 PassNo = 4;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if (Arg == "-m" && i + 1 < argc)
+      ModPath = argv[++i];
+    else if (Arg == "-c" && i + 1 < argc)
+      CorpusName = argv[++i];
+    else if (Arg == "-a" && i + 1 < argc)
+      ArchName = argv[++i];
+    else if (Arg == "-n" && i + 1 < argc)
+      PassNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-f" && i + 1 < argc)
+      s_Csv = std::string(argv[++i]) == "csv";
+    else if (Arg == "-x")
+      s_Check = true;
+    else
+      FilePath = Arg;
+  }
+
+  std::vector<Corpus> Corpora;
+  std::mt19937 Rng(0x6d656475);
+  if (!FilePath.empty())
+  {
+    FileBinaryStream BinStrm(FilePath);
+    auto pBytes = static_cast<u8 const*>(BinStrm.GetBuffer());
+    Corpus Res = { "file", std::vector<u8>(pBytes, pBytes + BinStrm.GetSize()), 0, "", "" };
+    Corpora.push_back(std::move(Res));
+  }
+  else
+  {
+    // The random corpora are generated in the same order whatever the selection
+    Corpus Random = MakeRandom(Rng, "random", 0x100000, 0);
+    Corpus Word32 = MakeRandom(Rng, "word32", 0x400000, 4);
+    bool All = CorpusName == "all";
+
+    if (All || CorpusName == "random")
+      Corpora.push_back(std::move(Random));
+    if (All || CorpusName == "x86map")
+      Corpora.push_back(MakeX86OpcodeMap());
+    if (All || CorpusName == "word16")
+      Corpora.push_back(MakeWord16());
+    if (All || CorpusName == "word32")
+      Corpora.push_back(std::move(Word32));
+    if (All || CorpusName == "system")
+      MakeSystem(Corpora);
+
+    if (Corpora.empty() && CorpusName != "system")
+    {
+      std::cerr << "unknown corpus: " << CorpusName << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto& rModMgr = ModuleManager::Instance();
+  rModMgr.LoadModules(ModPath);
+  auto Archs = rModMgr.GetArchitectures();
+  if (Archs.empty())
+  {
+    std::cerr << "no architecture found in " << ModPath.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (s_Csv)
+    std::cout << "corpus,architecture,mode,variant,insns,ns_per_insn,insns_per_sec,mib_per_sec,allocs_per_insn" << std::endl;
+
+  for (auto const& rCorpus : Corpora)
+  {
+    if (!s_Csv)
+      std::cout << "== " << rCorpus.m_Name << " (" << rCorpus.m_Bytes.size() << " bytes) ==" << std::endl;
+
+    for (auto const& rspArch : Archs)
+    {
+      if (!ArchName.empty() && rspArch->GetName() != ArchName)
+        continue;
+      if (!rCorpus.m_ArchName.empty() && rspArch->GetName() != rCorpus.m_ArchName)
+        continue;
+      Run(*rspArch, rCorpus, PassNo);
+    }
+  }
+
+  return 0;
+}
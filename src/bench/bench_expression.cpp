@@ -0,0 +1,228 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/binary_stream.hpp>
+#include <medusa/instruction.hpp>
+#include <medusa/expression.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark measures the life of semantic trees the way Execution uses
+// them. Random bytes are decoded by every architecture and mode, instructions
+// with a semantic are grouped by blocks of 8, then for each block:
+//  - build: the program pointer increment of each instruction is built,
+//  - clone: the semantic of each instruction is cloned,
+//  - destroy: every tree of the block is deleted.
+// The "heap" variant uses new and delete, the "arena" variant builds each block
+// in its own ExpressionArena which is reset after the trees are deleted. Heap
+// allocations are counted by replacing the global operator new.
+//
+// -a selects one architecture, -n the number of passes and -s the corpus size.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+enum { BlockSize = 8 };
+
+static u64 s_AllocNo = 0;
+
+void* operator new(std::size_t Size)
+{
+  ++s_AllocNo;
+  void* pMem = std::malloc(Size != 0 ? Size : 1);
+  if (pMem == nullptr)
+    throw std::bad_alloc();
+  return pMem;
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+struct Phase
+{
+  Phase(void) : m_TotalNs(0.0), m_AllocNo(0) {}
+
+  double m_TotalNs;
+  u64    m_AllocNo;
+};
+
+typedef std::vector<Instruction::SPtr> Block;
+
+static double ElapsedNs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count());
+}
+
+static void Report(Architecture const& rArch, std::string const& rMode, char const* pVariant, char const* pPhase,
+  Phase const& rPhase, u64 InsnNo)
+{
+  std::cout << std::left << std::setw(40) << (rArch.GetName() + " (" + rMode + ", " + pVariant + ")")
+    << std::setw(8) << pPhase << std::right << std::fixed
+    << std::setw(10) << std::setprecision(1) << (InsnNo != 0 ? rPhase.m_TotalNs / InsnNo : 0.0) << " ns/insn"
+    << std::setw(8)  << std::setprecision(2) << (InsnNo != 0 ? static_cast<double>(rPhase.m_AllocNo) / InsnNo : 0.0) << " allocs/insn"
+    << std::endl;
+}
+
+static void BuildBlock(Block const& rBlock, CpuInformation const* pCpuInfo, u32 ProgPtrReg, u32 ProgPtrRegSize, Expression::List& rSems)
+{
+  for (auto const& rspInsn : rBlock)
+    rSems.push_back(new OperationExpression(OperationExpression::OpAff,
+      new IdentifierExpression(ProgPtrReg, pCpuInfo),
+      new OperationExpression(OperationExpression::OpAdd,
+      /**/new IdentifierExpression(ProgPtrReg, pCpuInfo),
+      /**/new ConstantExpression(ProgPtrRegSize, rspInsn->GetLength())
+      )));
+}
+
+static void CloneBlock(Block const& rBlock, Expression::List& rSems)
+{
+  for (auto const& rspInsn : rBlock)
+    for (Expression const* pExpr : rspInsn->GetSemantic())
+      rSems.push_back(pExpr->Clone());
+}
+
+static void DestroyBlock(Expression::List& rSems)
+{
+  for (Expression* pExpr : rSems)
+    delete pExpr;
+  rSems.clear();
+}
+
+static void RunMode(Architecture& rArch, std::string const& rModeName, u8 Mode, BinaryStream const& rBinStrm, u32 PassNo)
+{
+  auto pCpuInfo = rArch.GetCpuInformation();
+  if (pCpuInfo == nullptr)
+    return;
+  u32 ProgPtrReg = pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister, Mode);
+  if (ProgPtrReg == CpuInformation::InvalidRegister)
+    return;
+  u32 ProgPtrRegSize = pCpuInfo->GetSizeOfRegisterInBit(ProgPtrReg);
+
+  std::vector<Block> Blocks(1);
+  u64 InsnNo = 0;
+  TOffset Offset = 0;
+  while (Offset < rBinStrm.GetSize())
+  {
+    auto spInsn = std::make_shared<Instruction>();
+    if (!rArch.Disassemble(rBinStrm, Offset, *spInsn, Mode) || spInsn->GetLength() == 0)
+    {
+      ++Offset;
+      continue;
+    }
+    Offset += spInsn->GetLength();
+
+    // Semantics are built here, so the phases only measure their copies
+    if (spInsn->GetSemantic().empty())
+      continue;
+
+    if (Blocks.back().size() == BlockSize)
+      Blocks.push_back(Block());
+    Blocks.back().push_back(spInsn);
+    ++InsnNo;
+  }
+  if (InsnNo == 0)
+    return;
+
+  std::vector<Expression::List> Sems(Blocks.size());
+  std::vector<std::unique_ptr<ExpressionArena>> Arenas;
+  for (size_t BlockIdx = 0; BlockIdx < Blocks.size(); ++BlockIdx)
+    Arenas.push_back(std::unique_ptr<ExpressionArena>(new ExpressionArena));
+
+  for (int UseArena = 0; UseArena < 2; ++UseArena)
+  {
+    Phase Build, Clone, Destroy;
+    for (u32 Pass = 0; Pass < PassNo; ++Pass)
+    {
+      u64 AllocNo = s_AllocNo;
+      auto Start = Clock::now();
+      for (size_t BlockIdx = 0; BlockIdx < Blocks.size(); ++BlockIdx)
+      {
+        ExpressionArena::Scope BlockScope(UseArena ? Arenas[BlockIdx].get() : nullptr);
+        BuildBlock(Blocks[BlockIdx], pCpuInfo, ProgPtrReg, ProgPtrRegSize, Sems[BlockIdx]);
+      }
+      Build.m_TotalNs += ElapsedNs(Start);
+      Build.m_AllocNo += s_AllocNo - AllocNo;
+
+      AllocNo = s_AllocNo;
+      Start = Clock::now();
+      for (size_t BlockIdx = 0; BlockIdx < Blocks.size(); ++BlockIdx)
+      {
+        ExpressionArena::Scope BlockScope(UseArena ? Arenas[BlockIdx].get() : nullptr);
+        CloneBlock(Blocks[BlockIdx], Sems[BlockIdx]);
+      }
+      Clone.m_TotalNs += ElapsedNs(Start);
+      Clone.m_AllocNo += s_AllocNo - AllocNo;
+
+      AllocNo = s_AllocNo;
+      Start = Clock::now();
+      for (size_t BlockIdx = 0; BlockIdx < Blocks.size(); ++BlockIdx)
+      {
+        DestroyBlock(Sems[BlockIdx]);
+        if (UseArena)
+          Arenas[BlockIdx]->Reset();
+      }
+      Destroy.m_TotalNs += ElapsedNs(Start);
+      Destroy.m_AllocNo += s_AllocNo - AllocNo;
+    }
+
+    char const* pVariant = UseArena ? "arena" : "heap";
+    Report(rArch, rModeName, pVariant, "build",   Build,   InsnNo * PassNo);
+    Report(rArch, rModeName, pVariant, "clone",   Clone,   InsnNo * PassNo);
+    Report(rArch, rModeName, pVariant, "destroy", Destroy, InsnNo * PassNo);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  std::string ArchName;
+  u32 PassNo = 4;
+  u32 Size   = 0x10000;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if      (Arg == "-a" && i + 1 < argc) ArchName = argv[++i];
+    else if (Arg == "-n" && i + 1 < argc) PassNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-s" && i + 1 < argc) Size   = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else
+    {
+      std::cerr << "usage: " << argv[0] << " [-a architecture] [-n pass_number] [-s corpus_size]" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto& rModMgr = ModuleManager::Instance();
+  rModMgr.LoadModules(".");
+
+  std::vector<u8> Bytes(Size);
+  std::mt19937 Rng(0x6d656475);
+  for (auto itByte = std::begin(Bytes); itByte != std::end(Bytes); ++itByte)
+    *itByte = static_cast<u8>(Rng());
+  MemoryBinaryStream BinStrm(Bytes.data(), static_cast<u32>(Bytes.size()));
+
+  auto Archs = rModMgr.GetArchitectures();
+  for (auto const& rspArch : Archs)
+  {
+    if (!ArchName.empty() && rspArch->GetName() != ArchName)
+      continue;
+
+    BinStrm.SetEndianness(rspArch->GetEndianness());
+    auto Modes = rspArch->GetModes();
+    if (Modes.empty())
+      Modes.push_back(Architecture::NamedMode("default", 0));
+    for (auto const& rMode : Modes)
+      RunMode(*rspArch, std::get<0>(rMode), std::get<1>(rMode), BinStrm, PassNo);
+  }
+
+  return 0;
+}
@@ -0,0 +1,215 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <boost/filesystem.hpp>
+
+#include <medusa/medusa.hpp>
+#include <medusa/module.hpp>
+#include <medusa/cell_text.hpp>
+#include <medusa/log.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark formats a linear sweep of random bytes with every
+// architecture and mode. The bytes are mapped by the raw loader and a label
+// is added every 16 instructions, so some operands are printed as label.
+// Each line is formatted with the std::string and Cell::Mark::List API, then
+// with a CellText reused from one line to another. Heap allocations are
+// counted by replacing the global operator new.
+//
+// -a selects one architecture, -n the number of passes and -s the corpus size.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static u64 s_AllocNo = 0;
+
+void* operator new(std::size_t Size)
+{
+  ++s_AllocNo;
+  void* pMem = std::malloc(Size != 0 ? Size : 1);
+  if (pMem == nullptr)
+    throw std::bad_alloc();
+  return pMem;
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+struct Line
+{
+  Address           m_Address;
+  Instruction::SPtr m_spInsn;
+};
+
+static double ElapsedNs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count());
+}
+
+static void Report(Architecture const& rArch, char const* pMode, char const* pVariant,
+  double TotalNs, u64 LineNo, u64 CharNo, u64 AllocNo)
+{
+  std::cout
+    << std::left  << std::setw(12) << rArch.GetName().substr(0, 11)
+    << std::setw(8)  << pMode
+    << std::setw(8)  << pVariant
+    << std::right << std::fixed
+    << std::setw(10) << std::setprecision(1) << (LineNo != 0 ? TotalNs / LineNo : 0.0) << " ns/line"
+    << std::setw(8)  << std::setprecision(1) << (LineNo != 0 ? static_cast<double>(CharNo) / LineNo : 0.0) << " chars/line"
+    << std::setw(8)  << std::setprecision(2) << (LineNo != 0 ? static_cast<double>(AllocNo) / LineNo : 0.0) << " allocs/line"
+    << std::endl;
+}
+
+static void FormatLines(Document const& rDoc, Architecture const& rArch, char const* pMode, std::vector<Line> const& rLines, u32 PassNo)
+{
+  auto const& rBinStrm = rDoc.GetBinaryStream();
+  u64 LineNo = 0, CharNo = 0;
+
+  u64 AllocNo = s_AllocNo;
+  auto Start = Clock::now();
+  for (u32 Pass = 0; Pass < PassNo; ++Pass)
+    for (auto itLine = std::begin(rLines); itLine != std::end(rLines); ++itLine)
+    {
+      std::string      StrCell;
+      Cell::Mark::List Marks;
+      if (!rArch.FormatCell(rDoc, rBinStrm, itLine->m_Address, *itLine->m_spInsn, StrCell, Marks))
+        continue;
+      CharNo += StrCell.length();
+      ++LineNo;
+    }
+  Report(rArch, pMode, "string", ElapsedNs(Start), LineNo, CharNo, s_AllocNo - AllocNo);
+
+  CellText Text;
+  LineNo = CharNo = 0;
+  AllocNo = s_AllocNo;
+  Start = Clock::now();
+  for (u32 Pass = 0; Pass < PassNo; ++Pass)
+    for (auto itLine = std::begin(rLines); itLine != std::end(rLines); ++itLine)
+    {
+      Text.Clear();
+      if (!rArch.FormatCell(rDoc, rBinStrm, itLine->m_Address, *itLine->m_spInsn, Text))
+        continue;
+      CharNo += Text.GetLength();
+      ++LineNo;
+    }
+  Report(rArch, pMode, "buffer", ElapsedNs(Start), LineNo, CharNo, s_AllocNo - AllocNo);
+}
+
+static bool RunArchitecture(Architecture::SharedPtr spArch, Loader::SharedPtr spLdr, std::vector<u8> const& rBytes, u32 PassNo)
+{
+  auto& rModMgr = ModuleManager::Instance();
+  auto spDb = rModMgr.GetDatabase("Text");
+  if (spDb == nullptr)
+    return false;
+
+  auto DbPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("medusa-bench-%%%%-%%%%-%%%%.mdt");
+  if (!spDb->Create(DbPath, true))
+    return false;
+
+  bool Res;
+  {
+    BinaryStream::SharedPtr spBinStrm = std::make_shared<MemoryBinaryStream>(rBytes.data(), static_cast<u32>(rBytes.size()));
+    Architecture::VectorSharedPtr Archs(1, spArch);
+    Medusa Core;
+
+    // The document is only mapped, random bytes are not worth being analyzed
+    auto& rDoc = Core.GetDocument();
+    Res = rDoc.RegisterArchitecture(spArch) && spDb->RegisterArchitectureTag(spArch->GetTag());
+    spDb->SetBinaryStream(spBinStrm);
+    spBinStrm->SetEndianness(spArch->GetEndianness());
+    rDoc.Use(spDb);
+    spLdr->Map(rDoc, Archs);
+
+    auto Modes = spArch->GetModes();
+    if (Modes.empty())
+      Modes.push_back(Architecture::NamedMode("default", 0));
+
+    for (auto itMode = std::begin(Modes); Res && itMode != std::end(Modes); ++itMode)
+    {
+      std::vector<Line> Lines;
+      TOffset Offset = 0;
+      while (Offset < rBytes.size())
+      {
+        auto spInsn = std::make_shared<Instruction>();
+        if (!spArch->Disassemble(rDoc.GetBinaryStream(), Offset, *spInsn, std::get<1>(*itMode)) || spInsn->GetLength() == 0)
+        {
+          ++Offset;
+          continue;
+        }
+
+        Line CurLine = { rDoc.MakeAddress(0x0, Offset), spInsn };
+        if (Lines.size() % 16 == 0)
+          rDoc.AddLabel(CurLine.m_Address, Label(CurLine.m_Address, Label::Code));
+        Lines.push_back(CurLine);
+        Offset += spInsn->GetLength();
+      }
+
+      FormatLines(rDoc, *spArch, std::get<0>(*itMode), Lines, PassNo);
+    }
+  }
+
+  boost::system::error_code Err;
+  boost::filesystem::remove(DbPath, Err);
+  return Res;
+}
+
+int main(int argc, char** argv)
+{
+  std::string ArchName;
+  u32 PassNo = 4;
+  u32 Size   = 0x10000;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if      (Arg == "-a" && i + 1 < argc) ArchName = argv[++i];
+    else if (Arg == "-n" && i + 1 < argc) PassNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-s" && i + 1 < argc) Size   = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else
+    {
+      std::cerr << "usage: " << argv[0] << " [-a architecture] [-n pass_number] [-s corpus_size]" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  Log::SetLog([](std::string const&) {});
+
+  auto& rModMgr = ModuleManager::Instance();
+  rModMgr.LoadModules(".");
+
+  std::vector<u8> Bytes(Size);
+  std::mt19937 Rng(0x6d656475);
+  for (auto itByte = std::begin(Bytes); itByte != std::end(Bytes); ++itByte)
+    *itByte = static_cast<u8>(Rng());
+
+  Loader::SharedPtr spRawLdr;
+  MemoryBinaryStream BinStrm(Bytes.data(), static_cast<u32>(Bytes.size()));
+  auto Ldrs = rModMgr.GetLoaders(BinStrm);
+  for (auto itLdr = std::begin(Ldrs); itLdr != std::end(Ldrs); ++itLdr)
+    if ((*itLdr)->GetName() == "Raw file")
+      spRawLdr = *itLdr;
+  if (spRawLdr == nullptr)
+  {
+    std::cerr << "raw loader not found" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto Archs = rModMgr.GetArchitectures();
+  for (auto itArch = std::begin(Archs); itArch != std::end(Archs); ++itArch)
+  {
+    if (!ArchName.empty() && (*itArch)->GetName() != ArchName)
+      continue;
+    if (!RunArchitecture(*itArch, spRawLdr, Bytes, PassNo))
+      std::cerr << "unable to format with " << (*itArch)->GetName() << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
+
+#include <medusa/module.hpp>
+#include <medusa/architecture.hpp>
+#include <medusa/binary_stream.hpp>
+#include <medusa/instruction.hpp>
+#include <medusa/emulation.hpp>
+#include <medusa/log.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark measures how many x86 instructions each emulator executes
+// each second. The code only uses registers and updates flags, most of its
+// semantics go through the temporary variables of the x86 semantic:
+//   add eax, ecx / sub edx, eax / xor ebx, edx / and ecx, ebx / or eax, edx
+//   cmp eax, ebx / adc ecx, eax / sbb edx, ecx / add eax, 0x12345 / test eax, edx
+//   inc eax / dec ebx / shl ecx, 1 / sub ebx, 7
+// Each instruction is decoded once, then its semantic is executed -n times by
+// the interpreter, bytecode and llvm emulators, or only by those given with -e.
+// All emulators start from the same context and must end with the same one.
+// With -s, the semantics are simplified when they are built (see the
+// "Simplify semantic" option of the architecture).
+
+typedef std::chrono::high_resolution_clock Clock;
+
+// This visitor counts the nodes of an expression tree
+class NodeCounter : public ExpressionVisitor
+{
+public:
+  NodeCounter(void) : m_NodeNo(0) {}
+  u32 GetNumberOfNodes(void) const { return m_NodeNo; }
+
+  void Count(Expression const* pExpr) { if (pExpr != nullptr) pExpr->Visit(this); }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  { ++m_NodeNo; for (auto pExpr : rExprList) Count(pExpr); return nullptr; }
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  { ++m_NodeNo; Count(pRefExpr); Count(pTestExpr); return nullptr; }
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  { ++m_NodeNo; Count(pRefExpr); Count(pTestExpr); Count(pThenExpr); return nullptr; }
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  { ++m_NodeNo; Count(pRefExpr); Count(pTestExpr); Count(pThenExpr); Count(pElseExpr); return nullptr; }
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  { ++m_NodeNo; Count(pRefExpr); Count(pTestExpr); Count(pBodyExpr); return nullptr; }
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  { ++m_NodeNo; Count(pLeftExpr); Count(pRightExpr); return nullptr; }
+  virtual Expression* VisitConstant(u32 Type, u64 Value)                 { ++m_NodeNo; return nullptr; }
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo) { ++m_NodeNo; return nullptr; }
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  { ++m_NodeNo; Count(pBaseExpr); Count(pOffsetExpr); return nullptr; }
+  virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot)             { ++m_NodeNo; return nullptr; }
+
+private:
+  u32 m_NodeNo;
+};
+
+static u8 const s_FlagCode[] =
+{
+  0x01, 0xc8, 0x29, 0xc2, 0x31, 0xd3, 0x21, 0xd9, 0x09, 0xd0,
+  0x39, 0xd8, 0x11, 0xc1, 0x19, 0xca, 0x05, 0x45, 0x23, 0x01, 0x00,
+  0x85, 0xd0, 0x40, 0x4b, 0xd1, 0xe1, 0x83, 0xeb, 0x07
+};
+
+int main(int argc, char** argv)
+{
+  u32 PassNo = 200000;
+  bool Simplify = false;
+  std::vector<std::string> EmulNames;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if (Arg == "-n" && i + 1 < argc) PassNo = std::max(static_cast<u32>(std::strtoul(argv[++i], nullptr, 0)), 1U);
+    else if (Arg == "-s") Simplify = true;
+    else if (Arg == "-e" && i + 1 < argc) EmulNames.push_back(argv[++i]);
+    else
+    {
+      std::cerr << "usage: " << argv[0] << " [-n pass_number] [-s] [-e emulator]..." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  Log::SetLog([](std::string const&) {});
+  auto& rModMgr = ModuleManager::Instance();
+  rModMgr.LoadModules(".");
+
+  Architecture::SharedPtr spArch;
+  for (auto const& rspArch : rModMgr.GetArchitectures())
+    if (rspArch->GetName() == "Intel x86")
+      spArch = rspArch;
+  if (spArch == nullptr)
+  {
+    std::cerr << "x86 architecture not found" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (EmulNames.empty())
+    EmulNames = { "interpreter", "bytecode", "llvm" };
+
+  spArch->GetConfigurationModel().SetBoolean("Simplify semantic", Simplify);
+
+  u8 Mode = 0;
+  for (auto const& rMode : spArch->GetModes())
+    if (std::string(std::get<0>(rMode)) == "32-bit")
+      Mode = std::get<1>(rMode);
+
+  MemoryBinaryStream BinStrm(s_FlagCode, sizeof(s_FlagCode));
+  BinStrm.SetEndianness(spArch->GetEndianness());
+
+  std::vector<Instruction::SPtr> Insns;
+  NodeCounter Counter;
+  TOffset Offset = 0;
+  while (Offset < sizeof(s_FlagCode))
+  {
+    auto spInsn = std::make_shared<Instruction>();
+    if (!spArch->Disassemble(BinStrm, Offset, *spInsn, Mode) || spInsn->GetLength() == 0)
+    {
+      std::cerr << "unable to disassemble instruction at " << Offset << std::endl;
+      return EXIT_FAILURE;
+    }
+    Offset += spInsn->GetLength();
+    if (spInsn->GetSemantic().empty())
+      std::cerr << "instruction at " << (Offset - spInsn->GetLength()) << " has no semantic" << std::endl;
+    else
+    {
+      for (auto pExpr : spInsn->GetSemantic())
+        Counter.Count(pExpr);
+      Insns.push_back(spInsn);
+    }
+  }
+
+  std::cout << Insns.size() << " insns, " << Counter.GetNumberOfNodes() << " semantic nodes" << (Simplify ? " (simplified)" : "") << std::endl;
+
+  std::string RefCtxt, RefEmulName;
+  for (auto const& rEmulName : EmulNames)
+  {
+    auto pGetEmulator = rModMgr.GetEmulator(rEmulName);
+    if (pGetEmulator == nullptr)
+    {
+      std::cout << rEmulName << ": not available" << std::endl;
+      continue;
+    }
+
+    std::unique_ptr<CpuContext>    upCpuCtxt(spArch->MakeCpuContext());
+    std::unique_ptr<MemoryContext> upMemCtxt(spArch->MakeMemoryContext());
+    upCpuCtxt->SetMode(Mode);
+    std::unique_ptr<Emulator> upEmul(pGetEmulator(spArch->GetCpuInformation(), upCpuCtxt.get(), upMemCtxt.get()));
+    if (upEmul == nullptr)
+      return EXIT_FAILURE;
+
+    // Emulators may cache what they execute per address, so each instruction keeps its own
+    u64 InsnNo = 0;
+    auto Start = Clock::now();
+    for (u32 Pass = 0; Pass < PassNo; ++Pass)
+    {
+      TOffset InsnOff = 0x1000;
+      for (auto const& rspInsn : Insns)
+      {
+        if (!upEmul->Execute(Address(InsnOff), rspInsn->GetSemantic()))
+        {
+          std::cerr << rEmulName << ": unable to execute " << rspInsn->GetSemantic().front()->ToString() << std::endl;
+          return EXIT_FAILURE;
+        }
+        InsnOff += rspInsn->GetLength();
+        ++InsnNo;
+      }
+    }
+    double ElapsedS = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count()) / 1000000.0;
+
+    std::cout << std::fixed << std::setprecision(2)
+      << rEmulName << ": " << InsnNo << " insns in " << ElapsedS << " s, "
+      << std::setprecision(3) << (ElapsedS != 0.0 ? InsnNo / ElapsedS / 1000000.0 : 0.0) << " MIPS" << std::endl;
+
+    auto CurCtxt = upCpuCtxt->ToString();
+    if (RefEmulName.empty())
+    {
+      RefCtxt     = CurCtxt;
+      RefEmulName = rEmulName;
+    }
+    else if (CurCtxt != RefCtxt)
+    {
+      std::cerr << rEmulName << ": context differs from " << RefEmulName << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return 0;
+}
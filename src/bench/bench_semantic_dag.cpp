@@ -0,0 +1,173 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <boost/filesystem.hpp>
+
+#include <medusa/medusa.hpp>
+#include <medusa/module.hpp>
+#include <medusa/log.hpp>
+#include <medusa/expression_dag.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark analyzes each file given on the command line, then it keeps
+// the semantic of every instruction found twice:
+//  - tree: each semantic is cloned, the way Execution copies them,
+//  - dag: each semantic is interned in one ExpressionDag.
+// It reports the memory and the time needed by both forms. Tree memory is the
+// sum of the sizes given to operator new, DAG memory is estimated by the DAG.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static std::atomic<u64> s_AllocNo(0);
+static std::atomic<u64> s_AllocSize(0);
+
+void* operator new(std::size_t Size)
+{
+  s_AllocNo.fetch_add(1, std::memory_order_relaxed);
+  s_AllocSize.fetch_add(Size, std::memory_order_relaxed);
+  void* pMem = std::malloc(Size != 0 ? Size : 1);
+  if (pMem == nullptr)
+    throw std::bad_alloc();
+  return pMem;
+}
+
+void operator delete(void* pMem) noexcept
+{
+  std::free(pMem);
+}
+
+static double ElapsedMs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count()) / 1000.0;
+}
+
+static bool AnalyzeFile(boost::filesystem::path const& rFilePath)
+{
+  auto& rModMgr = ModuleManager::Instance();
+
+  BinaryStream::SharedPtr spBinStrm = std::make_shared<FileBinaryStream>(rFilePath.wstring());
+
+  auto Ldrs = rModMgr.GetLoaders(*spBinStrm);
+  if (Ldrs.empty())
+    return false;
+  auto spLdr = Ldrs.front();
+
+  auto Archs = rModMgr.GetArchitectures();
+  spLdr->FilterAndConfigureArchitectures(Archs);
+  if (Archs.empty())
+    return false;
+
+  auto spOs = rModMgr.GetOperatingSystem(spLdr, Archs.front());
+
+  auto spDb = rModMgr.GetDatabase("Text");
+  if (spDb == nullptr)
+    return false;
+
+  auto DbPath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("medusa-bench-%%%%-%%%%-%%%%.mdt");
+  if (!spDb->Create(DbPath, true))
+    return false;
+
+  bool Res;
+  {
+    Medusa Core;
+
+    auto Start = Clock::now();
+    Res = Core.Start(spBinStrm, spDb, spLdr, Archs, spOs);
+    Core.WaitForTasks();
+    double AnalysisMs = ElapsedMs(Start);
+
+    std::vector<Address> InsnAddrs;
+    Core.GetDocument().ForEachMemoryArea([&InsnAddrs](MemoryArea const& rMemArea)
+    {
+      TOffset BaseOff = rMemArea.GetBaseAddress().GetOffset();
+      rMemArea.ForEachCellData([&](TOffset Off, CellData::SPtr const& rspCellData)
+      {
+        if (rspCellData != nullptr && rspCellData->GetType() == Cell::InstructionType)
+          InsnAddrs.push_back(rMemArea.MakeAddress(BaseOff + Off));
+      });
+    });
+
+    // Instructions are kept alive, so both forms are built from the same semantics
+    std::vector<Cell::SPtr> Insns;
+    u64 SemNo = 0;
+    for (auto const& rAddr : InsnAddrs)
+    {
+      auto spInsn = std::dynamic_pointer_cast<Instruction>(Core.GetCell(rAddr));
+      if (spInsn == nullptr || spInsn->GetSemantic().empty())
+        continue;
+      SemNo += spInsn->GetSemantic().size();
+      Insns.push_back(spInsn);
+    }
+
+    std::vector<Expression::List> Trees(Insns.size());
+    u64 AllocNo   = s_AllocNo.load();
+    u64 AllocSize = s_AllocSize.load();
+    Start = Clock::now();
+    for (size_t InsnIdx = 0; InsnIdx < Insns.size(); ++InsnIdx)
+      for (Expression const* pExpr : std::static_pointer_cast<Instruction>(Insns[InsnIdx])->GetSemantic())
+        Trees[InsnIdx].push_back(pExpr->Clone());
+    double TreeMs = ElapsedMs(Start);
+    u64 TreeNodeNo = s_AllocNo.load() - AllocNo;
+    u64 TreeSize   = s_AllocSize.load() - AllocSize;
+
+    ExpressionDag Dag;
+    ExpressionDag::IdVector Roots;
+    Roots.reserve(static_cast<size_t>(SemNo));
+    Start = Clock::now();
+    for (auto const& rspInsn : Insns)
+      Dag.Intern(std::static_pointer_cast<Instruction>(rspInsn)->GetSemantic(), Roots);
+    double DagMs = ElapsedMs(Start);
+
+    // Roots are compared by id, a marker per node counts the distinct semantics
+    std::vector<bool> SeenRoots(Dag.GetNumberOfNodes(), false);
+    u64 DistinctRootNo = 0;
+    for (auto RootId : Roots)
+      if (!SeenRoots[RootId])
+      {
+        SeenRoots[RootId] = true;
+        ++DistinctRootNo;
+      }
+
+    std::cout << std::fixed << std::setprecision(1)
+      << rFilePath.filename().string() << ": " << boost::filesystem::file_size(rFilePath) << " bytes, "
+      << InsnAddrs.size() << " insns, " << Insns.size() << " with semantic, "
+      << SemNo << " expressions (" << DistinctRootNo << " distinct), analysis " << AnalysisMs << " ms" << std::endl
+      << "  tree: " << std::setw(10) << TreeNodeNo << " allocs " << std::setw(12) << TreeSize << " bytes "
+      << std::setw(10) << TreeMs << " ms" << std::endl
+      << "  dag:  " << std::setw(10) << Dag.GetNumberOfNodes() << " nodes  " << std::setw(12) << Dag.GetMemoryUsage() << " bytes "
+      << std::setw(10) << DagMs << " ms" << std::endl;
+
+    for (auto& rTrees : Trees)
+      for (Expression* pExpr : rTrees)
+        delete pExpr;
+  }
+
+  boost::system::error_code Err;
+  boost::filesystem::remove(DbPath, Err);
+  return Res;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "usage: " << argv[0] << " file..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Log::SetLog([](std::string const&) {});
+  ModuleManager::Instance().LoadModules(".");
+
+  for (int i = 1; i < argc; ++i)
+    if (!AnalyzeFile(argv[i]))
+      std::cout << argv[i] << ": failed" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,211 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+
+#include <boost/bimap.hpp>
+#include <boost/bimap/multiset_of.hpp>
+
+#include <medusa/address.hpp>
+#include <medusa/xref.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+// This benchmark builds a synthetic cross-reference set which looks like a
+// large binary: calls to a limited number of functions, local jumps, data
+// accesses and indirect jumps through tables with several targets.
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct XRef
+{
+  Address m_To;
+  Address m_From;
+};
+
+static double ElapsedNs(Clock::time_point Start)
+{
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Start).count());
+}
+
+static void GenerateXRefs(size_t XRefNo, std::vector<XRef>& rXRefs)
+{
+  std::mt19937_64 Rng(0x6d656475);
+  TOffset const CodeBase = 0x00400000;
+  TOffset const CodeSize = XRefNo * 8;
+  TOffset const DataBase = CodeBase + CodeSize;
+  TOffset const DataSize = XRefNo;
+  size_t  const FuncNo   = XRefNo / 32 + 1;
+
+  rXRefs.reserve(XRefNo);
+  TOffset CurFrom = CodeBase;
+  while (rXRefs.size() < XRefNo)
+  {
+    CurFrom += 2 + Rng() % 6;
+    u64 Kind = Rng() % 100;
+
+    // call
+    if (Kind < 40)
+    {
+      TOffset To = CodeBase + (Rng() % FuncNo) * (CodeSize / FuncNo);
+      rXRefs.push_back(XRef{ Address(To), Address(CurFrom) });
+    }
+
+    // local jump
+    else if (Kind < 70)
+    {
+      TOffset To = CurFrom + (Rng() % 0x200) - 0x100;
+      rXRefs.push_back(XRef{ Address(To), Address(CurFrom) });
+    }
+
+    // data access
+    else if (Kind < 97)
+    {
+      TOffset To = (DataBase + Rng() % DataSize) & ~0x3ULL;
+      rXRefs.push_back(XRef{ Address(To), Address(CurFrom) });
+    }
+
+    // indirect jump through a table
+    else
+    {
+      size_t TgtNo = 4 + Rng() % 13;
+      for (size_t i = 0; i < TgtNo && rXRefs.size() < XRefNo; ++i)
+        rXRefs.push_back(XRef{ Address(CurFrom + 0x10 + i * 0x20), Address(CurFrom) });
+    }
+  }
+}
+
+static void Report(char const* pName, double TotalNs, size_t OpNo)
+{
+  std::cout << std::left << std::setw(40) << pName << std::right
+    << std::setw(12) << std::fixed << std::setprecision(1) << TotalNs / OpNo << " ns/op"
+    << std::endl;
+}
+
+static void BenchLookup(XRefs const& rXRefs, std::vector<XRef> const& rSample)
+{
+  size_t Hit = 0;
+
+  auto Start = Clock::now();
+  for (auto const& rXRef : rSample)
+  {
+    // The printer asks this question for every displayed line
+    if (rXRefs.HasXRefFrom(rXRef.m_From))
+      ++Hit;
+    if (rXRefs.HasXRefFrom(rXRef.m_To))
+      ++Hit;
+  }
+  Report("HasXRefFrom", ElapsedNs(Start), rSample.size() * 2);
+
+  Start = Clock::now();
+  for (auto const& rXRef : rSample)
+  {
+    Address::List FromList;
+    rXRefs.From(rXRef.m_To, FromList);
+    Hit += FromList.size();
+  }
+  Report("From (all sources of a target)", ElapsedNs(Start), rSample.size());
+
+  Start = Clock::now();
+  for (auto const& rXRef : rSample)
+  {
+    Address::List ToList;
+    rXRefs.To(rXRef.m_From, ToList);
+    Hit += ToList.size();
+  }
+  Report("To (all targets of a source)", ElapsedNs(Start), rSample.size());
+
+  // Prevent the compiler from discarding lookups
+  if (Hit == 0)
+    std::cout << "no hit" << std::endl;
+}
+
+static void BenchBimap(std::vector<XRef> const& rXRefArray, std::vector<XRef> const& rSample)
+{
+  typedef boost::bimap<boost::bimaps::multiset_of<Address>, Address> TXRefs;
+  TXRefs XRefMap;
+
+  auto Start = Clock::now();
+  for (auto const& rXRef : rXRefArray)
+    XRefMap.insert(TXRefs::value_type(rXRef.m_To, rXRef.m_From));
+  Report("bimap insert", ElapsedNs(Start), rXRefArray.size());
+
+  // A bimap node holds both keys and two red-black tree hooks (3 pointers + color each)
+  size_t const NodeSize = 2 * sizeof(Address) + 2 * 4 * sizeof(void*);
+  std::cout << std::left << std::setw(40) << "bimap memory (estimated)" << std::right
+    << std::setw(12) << std::setprecision(1) << static_cast<double>(XRefMap.size() * NodeSize) / XRefMap.size()
+    << " bytes/xref, " << rXRefArray.size() - XRefMap.size() << " targets dropped" << std::endl;
+
+  size_t Hit = 0;
+  Start = Clock::now();
+  for (auto const& rXRef : rSample)
+  {
+    if (XRefMap.left.find(rXRef.m_From) != XRefMap.left.end())
+      ++Hit;
+    if (XRefMap.left.find(rXRef.m_To) != XRefMap.left.end())
+      ++Hit;
+  }
+  Report("bimap HasXRefFrom", ElapsedNs(Start), rSample.size() * 2);
+
+  if (Hit == 0)
+    std::cout << "no hit" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  size_t XRefNo   = 10 * 1000 * 1000;
+  size_t SampleNo = 1000 * 1000;
+  bool   Baseline = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string Arg = argv[i];
+    if (Arg == "--baseline")
+      Baseline = true;
+    else
+      XRefNo = std::strtoull(argv[i], nullptr, 0);
+  }
+
+  std::cout << "generating " << XRefNo << " cross-references" << std::endl;
+  std::vector<XRef> XRefArray;
+  GenerateXRefs(XRefNo, XRefArray);
+
+  std::vector<XRef> Sample;
+  std::mt19937_64 Rng(0x78726566);
+  Sample.reserve(SampleNo);
+  for (size_t i = 0; i < SampleNo; ++i)
+    Sample.push_back(XRefArray[Rng() % XRefArray.size()]);
+
+  XRefs XRefStore;
+
+  auto Start = Clock::now();
+  for (auto const& rXRef : XRefArray)
+    XRefStore.AddXRef(rXRef.m_To, rXRef.m_From);
+  Report("AddXRef", ElapsedNs(Start), XRefArray.size());
+
+  std::cout << "-- before compaction" << std::endl;
+  BenchLookup(XRefStore, Sample);
+
+  Start = Clock::now();
+  XRefStore.Compact();
+  std::cout << std::left << std::setw(40) << "Compact" << std::right
+    << std::setw(12) << std::setprecision(1) << ElapsedNs(Start) / 1000000.0 << " ms" << std::endl;
+
+  std::cout << "-- after compaction" << std::endl;
+  BenchLookup(XRefStore, Sample);
+
+  std::cout << std::left << std::setw(40) << "memory" << std::right
+    << std::setw(12) << std::setprecision(1) << static_cast<double>(XRefStore.GetMemoryUsage()) / XRefStore.GetSize()
+    << " bytes/xref, " << XRefStore.GetSize() << " xrefs" << std::endl;
+
+  if (Baseline)
+  {
+    std::cout << "-- baseline" << std::endl;
+    BenchBimap(XRefArray, Sample);
+  }
+
+  return 0;
+}
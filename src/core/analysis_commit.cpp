@@ -0,0 +1,56 @@
+#include "medusa/analysis_commit.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+MEDUSA_NAMESPACE_BEGIN
+
+void AnalysisBatch::AddInstruction(Address const& rAddr, Instruction::SPtr spInsn)
+{
+  m_Instructions[rAddr] = std::move(spInsn);
+}
+
+bool AnalysisBatch::ContainsCode(Address const& rAddr) const
+{
+  auto itInsn = m_Instructions.upper_bound(rAddr);
+  if (itInsn == std::begin(m_Instructions))
+    return false;
+  --itInsn;
+
+  return itInsn->first.IsBetween(itInsn->second->GetLength(), rAddr);
+}
+
+bool AnalysisBatch::operator<(AnalysisBatch const& rBatch) const
+{
+  if (m_Pass != rBatch.m_Pass)
+    return m_Pass < rBatch.m_Pass;
+  return m_EntryAddr < rBatch.m_EntryAddr;
+}
+
+AnalysisCommitQueue::AnalysisCommitQueue(u32 WorkerNo)
+  : m_WorkerBatches(WorkerNo != 0 ? WorkerNo : 1)
+{
+}
+
+void AnalysisCommitQueue::Push(u32 WorkerId, AnalysisBatch&& rBatch)
+{
+  m_WorkerBatches[WorkerId].push_back(std::move(rBatch));
+}
+
+void AnalysisCommitQueue::Commit(CommitFunctionType Commit)
+{
+  AnalysisBatch::Vector Batches;
+  for (auto& rWorkerBatches : m_WorkerBatches)
+  {
+    std::move(std::begin(rWorkerBatches), std::end(rWorkerBatches), std::back_inserter(Batches));
+    rWorkerBatches.clear();
+  }
+
+  // Workers pick entry points in a racy order, only the sort makes the commit reproducible
+  std::sort(std::begin(Batches), std::end(Batches));
+
+  for (auto const& rBatch : Batches)
+    Commit(rBatch);
+}
+
+MEDUSA_NAMESPACE_END
@@ -8,7 +8,11 @@
 #include "medusa/module.hpp"
 
 #include <list>
+#include <set>
 #include <stack>
+#include <vector>
+#include <thread>
+#include <atomic>
 
 #include <boost/foreach.hpp>
 
@@ -189,11 +193,16 @@ bool Analyzer::DisassembleTask::Disassemble(Address const& rAddr)
   return true;
 }
 
-bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std::list<Instruction::SPtr>& rBasicBlock)
+bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std::list<Instruction::SPtr>& rBasicBlock, AnalysisBatch* pBatch)
 {
   Address CurAddr = rAddr;
   MemoryArea const* pMemArea = m_rDoc.GetMemoryArea(CurAddr);
 
+  auto ContainsCode = [&](Address const& rCodeAddr) -> bool
+  {
+    return m_rDoc.ContainsCode(rCodeAddr) || (pBatch != nullptr && pBatch->ContainsCode(rCodeAddr));
+  };
+
   try
   {
     auto Lbl = m_rDoc.GetLabelFromAddress(CurAddr);
@@ -214,14 +223,14 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
       if (!(pMemArea->GetAccess() & MemoryArea::Execute))
         throw std::string("Memory access \"") + pMemArea->GetName() + std::string("\" is not executable");
 
-      if (m_rDoc.ContainsCode(CurAddr))
+      if (ContainsCode(CurAddr))
         return true;
 
       if (!m_rDoc.ContainsUnknown(CurAddr))
         throw std::string("Cell at \"") + CurAddr.ToString() + std::string("\" is not unknown");
 
       // We create a new entry and disassemble it
-      auto spInsn = std::make_shared<Instruction>();
+      auto spInsn = MakePooled<Instruction>();
 
       TOffset PhysicalOffset;
 
@@ -239,7 +248,7 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
 
       // We try to retrieve the current instruction, if it's true we go to the next function
       for (size_t InsnLen = 0; InsnLen < spInsn->GetLength(); ++InsnLen)
-        if (m_rDoc.ContainsCode(CurAddr + InsnLen))
+        if (ContainsCode(CurAddr + InsnLen))
           return true;
 
       rBasicBlock.push_back(spInsn);
@@ -260,7 +269,10 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
   catch(std::string const& rExcpMsg)
   {
     rBasicBlock.clear();
-    Log::Write("core") << rExcpMsg << LogEnd;
+    if (pBatch != nullptr)
+      pBatch->AddMessage(rExcpMsg);
+    else
+      Log::Write("core") << rExcpMsg << LogEnd;
     return false;
   }
 
@@ -270,6 +282,127 @@ bool Analyzer::DisassembleTask::DisassembleBasicBlock(Address const& rAddr, std:
   return m_rArch.DisassembleBasicBlockOnly() == false ? true : false;
 }
 
+bool Analyzer::DisassembleTask::Explore(AnalysisBatch& rBatch)
+{
+  auto Lbl = m_rDoc.GetLabelFromAddress(m_Addr);
+  if ((Lbl.GetType() & Label::AccessMask) == Label::Imported)
+    return true;
+
+  if (m_rDoc.GetMemoryArea(m_Addr) == nullptr)
+  {
+    rBatch.AddMessage(std::string("Unable to get memory area for address ") + m_Addr.ToString());
+    return false;
+  }
+
+  // Unlike Disassemble, calls are not followed: their destinations are analyzed during the next pass
+  std::stack<Address> JumpStack;
+  JumpStack.push(m_Addr);
+
+  while (!JumpStack.empty())
+  {
+    Address CurAddr = JumpStack.top();
+    JumpStack.pop();
+
+    while (!m_rDoc.ContainsCode(CurAddr) && !rBatch.ContainsCode(CurAddr))
+    {
+      auto const& rLbl = m_rDoc.GetLabelFromAddress(CurAddr);
+      if ((rLbl.GetType() & Label::AccessMask) == Label::Imported)
+        break;
+
+      std::list<Instruction::SPtr> BasicBlock;
+      if (!DisassembleBasicBlock(CurAddr, BasicBlock, &rBatch))
+        break;
+      if (BasicBlock.size() == 0)
+        break;
+
+      for (auto itInsn = std::begin(BasicBlock); itInsn != std::end(BasicBlock); ++itInsn)
+      {
+        rBatch.AddInstruction(CurAddr, *itInsn);
+
+        auto InsnType = (*itInsn)->GetSubType();
+        for (u8 i = 0; i < OPERAND_NO; ++i)
+        {
+          Address DstAddr;
+          if (!(*itInsn)->GetOperandReference(m_rDoc, i, CurAddr, DstAddr))
+            continue;
+          if (InsnType & Instruction::JumpType)
+            JumpStack.push(DstAddr);
+          else
+            rBatch.AddNextEntryAddress(DstAddr);
+        }
+
+        if (InsnType == Instruction::NoneType || InsnType == Instruction::ConditionalType)
+          CurAddr += (*itInsn)->GetLength();
+      }
+
+      auto spLastInsn = BasicBlock.back();
+      auto LastInsnType = spLastInsn->GetSubType();
+
+      if (LastInsnType & Instruction::CallType)
+      {
+        Address DstAddr;
+        if (spLastInsn->GetOperandReference(m_rDoc, 0, CurAddr, DstAddr))
+          rBatch.AddFunction(DstAddr);
+        CurAddr += spLastInsn->GetLength();
+        continue;
+      }
+
+      if (LastInsnType & Instruction::ReturnType)
+      {
+        if (!(LastInsnType & Instruction::ConditionalType))
+          break;
+        CurAddr += spLastInsn->GetLength();
+        continue;
+      }
+
+      if (LastInsnType & Instruction::JumpType)
+      {
+        Address DstAddr;
+        if (LastInsnType & Instruction::ConditionalType)
+          JumpStack.push(CurAddr + spLastInsn->GetLength());
+        if (!spLastInsn->GetOperandReference(m_rDoc, 0, CurAddr, DstAddr))
+          break;
+        CurAddr = DstAddr;
+        continue;
+      }
+
+      break;
+    }
+  }
+
+  return true;
+}
+
+bool Analyzer::DisassembleTask::Commit(AnalysisBatch const& rBatch)
+{
+  for (auto const& rMsg : rBatch.GetMessages())
+    Log::Write("core") << rMsg << LogEnd;
+
+  for (auto const& rInsnPair : rBatch.GetInstructions())
+  {
+    Address const& rInsnAddr = rInsnPair.first;
+    auto spInsn = rInsnPair.second;
+
+    // An earlier batch could have disassembled this part
+    bool Overlap = false;
+    for (u16 InsnOff = 0; InsnOff < spInsn->GetLength(); ++InsnOff)
+      if (m_rDoc.ContainsCode(rInsnAddr + InsnOff))
+      {
+        Overlap = true;
+        break;
+      }
+    if (Overlap)
+      continue;
+
+    if (!m_rDoc.SetCell(rInsnAddr, spInsn, true))
+      continue;
+
+    CreateCrossReferences(rInsnAddr);
+  }
+
+  return true;
+}
+
 bool Analyzer::DisassembleTask::CreateCrossReferences(Address const& rAddr)
 {
   auto spInsn = std::dynamic_pointer_cast<Instruction const>(m_rDoc.GetCell(rAddr));
@@ -323,7 +456,7 @@ bool Analyzer::DisassembleTask::CreateFunction(Address const& rAddr)
 
   if (ComputeFunctionLength(rAddr, FuncEnd, FuncLen, InsnCnt, 0x1000) == true)
   {
-    Log::Write("core")
+    MEDUSA_LOG(Debug, "core")
       << "Function found"
       << ": address="               << rAddr.ToString()
       << ", length="                << FuncLen
@@ -342,7 +475,7 @@ bool Analyzer::DisassembleTask::CreateFunction(Address const& rAddr)
     auto pInsn = m_rDoc.GetCell(rAddr);
     if (pInsn == nullptr)
       return false;
-    auto spArch = ModuleManager::Instance().GetArchitecture(pInsn->GetArchitectureTag());
+    auto spArch = m_rDoc.GetArchitecture(pInsn->GetArchitectureTag());
     auto spFuncInsn = std::static_pointer_cast<Instruction const>(m_rDoc.GetCell(rAddr));
     if (spFuncInsn->GetSubType() != Instruction::JumpType)
       return false;
@@ -395,11 +528,9 @@ bool Analyzer::DisassembleTask::ComputeFunctionLength(Address const& rFuncAddr,
         break;
       }
 
+      // The rest of this path has already been walked, moving forward could leave the function
       if (VisitedInstruction[CurAddr])
-      {
-        CurAddr += spInsn->GetLength();
-        continue;
-      }
+        break;
 
       FuncLen += static_cast<u32>(spInsn->GetLength());
 
@@ -466,8 +597,8 @@ void Analyzer::DisassembleFunctionTask::Run(void)
   CreateFunction(m_Addr);
 }
 
-Analyzer::DisassembleAllFunctionsTask::DisassembleAllFunctionsTask(Document& rDoc)
-  : m_rDoc(rDoc)
+Analyzer::DisassembleAllFunctionsTask::DisassembleAllFunctionsTask(Document& rDoc, u32 WorkerNo)
+  : m_rDoc(rDoc), m_WorkerNo(WorkerNo)
 {
 }
 
@@ -483,24 +614,96 @@ std::string Analyzer::DisassembleAllFunctionsTask::GetName(void) const
 void Analyzer::DisassembleAllFunctionsTask::Run(void)
 {
   /* Disassemble all symbols if possible */
+  std::vector<Address> Entries;
   m_rDoc.ForEachLabel([&](Address const& rAddress, Label const& rLabel)
   {
     if (((rLabel.GetType() & Label::CellMask) != Label::Code) || ((rLabel.GetType() & Label::AccessMask) == Label::Imported))
       return;
-    Log::Write("core") << "disassembling function " << rAddress << LogEnd;
+    Entries.push_back(rAddress);
+  });
 
-    auto spArch = ModuleManager::Instance().GetArchitecture(m_rDoc.GetArchitectureTag(rAddress));
-    if (spArch == nullptr)
+  std::set<Address> Visited(std::begin(Entries), std::end(Entries));
+  std::set<Address> Functions(std::begin(Entries), std::end(Entries));
+
+  /*
+   * Each pass is split in two steps: workers explore entry points against
+   * the document as it was at the beginning of the pass, then batches are
+   * committed by a single thread in address order. Destinations of calls are
+   * the entry points of the next pass.
+   */
+  for (u32 Pass = 0; !Entries.empty(); ++Pass)
+  {
+    AnalysisCommitQueue CommitQueue(m_WorkerNo);
+    std::atomic<size_t> NextEntry(0);
+
+    auto Worker = [&](u32 WorkerId)
     {
-      Log::Write("core") << "there's no architecture for " << rAddress << LogEnd;
-      return;
-    }
+      size_t EntryIdx;
+      while ((EntryIdx = NextEntry++) < Entries.size())
+      {
+        Address const& rEntry = Entries[EntryIdx];
+        AnalysisBatch Batch(rEntry, Pass);
 
-    u8 Mode = m_rDoc.GetMode(rAddress);
+        auto spArch = m_rDoc.GetArchitecture(m_rDoc.GetArchitectureTag(rEntry));
+        if (spArch == nullptr)
+          Batch.AddMessage(std::string("there's no architecture for ") + rEntry.ToString());
+        else
+        {
+          DisassembleTask DisasmTask(m_rDoc, rEntry, *spArch, m_rDoc.GetMode(rEntry));
+          DisasmTask.Explore(Batch);
+        }
 
-    DisassembleFunctionTask DisasmFuncTask(m_rDoc, rAddress, *spArch, Mode);
-    DisasmFuncTask.Run();
-  });
+        CommitQueue.Push(WorkerId, std::move(Batch));
+      }
+    };
+
+    std::vector<std::thread> Workers;
+    for (u32 WorkerId = 1; WorkerId < CommitQueue.GetNumberOfWorkers(); ++WorkerId)
+      Workers.push_back(std::thread(Worker, WorkerId));
+    Worker(0);
+    for (auto& rWorker : Workers)
+      rWorker.join();
+
+    std::set<Address> NextEntries;
+    CommitQueue.Commit([&](AnalysisBatch const& rBatch)
+    {
+      if (rBatch.GetPass() == 0)
+        MEDUSA_LOG(Debug, "core") << "disassembling function " << rBatch.GetEntryAddress() << LogEnd;
+
+      for (auto const& rAddr : rBatch.GetFunctions())
+        Functions.insert(rAddr);
+
+      for (auto const& rAddr : rBatch.GetNextEntryAddresses())
+        if (Visited.insert(rAddr).second)
+          NextEntries.insert(rAddr);
+
+      auto spArch = m_rDoc.GetArchitecture(m_rDoc.GetArchitectureTag(rBatch.GetEntryAddress()));
+      if (spArch == nullptr)
+      {
+        for (auto const& rMsg : rBatch.GetMessages())
+          Log::Write("core") << rMsg << LogEnd;
+        return;
+      }
+
+      DisassembleTask DisasmTask(m_rDoc, rBatch.GetEntryAddress(), *spArch, m_rDoc.GetMode(rBatch.GetEntryAddress()));
+      DisasmTask.Commit(rBatch);
+    });
+
+    Entries.assign(std::begin(NextEntries), std::end(NextEntries));
+  }
+
+  /* Functions are created once their whole code is known */
+  for (auto const& rFuncAddr : Functions)
+  {
+    auto spArch = m_rDoc.GetArchitecture(m_rDoc.GetArchitectureTag(rFuncAddr));
+    if (spArch == nullptr)
+      continue;
+
+    DisassembleTask DisasmTask(m_rDoc, rFuncAddr, *spArch, m_rDoc.GetMode(rFuncAddr));
+    DisasmTask.CreateFunction(rFuncAddr);
+  }
+
+  m_rDoc.CompactCrossReferences();
 }
 
 Analyzer::FindAllStringTask::FindAllStringTask(Document& rDoc) : m_rDoc(rDoc)
@@ -894,9 +1097,17 @@ bool Analyzer::BuildControlFlowGraph(Document const& rDoc, Address const& rAddr,
   return RetReached;
 }
 
+bool Analyzer::FormatCell(Document const& rDoc, BinaryStream const& rBinStrm, Address const& rAddress, Cell const& rCell, CellText & rText) const
+{
+  auto spArch = rDoc.GetArchitecture(rCell.GetArchitectureTag());
+  if (spArch == nullptr)
+    return false;
+  return spArch->FormatCell(rDoc, rBinStrm, rAddress, rCell, rText);
+}
+
 bool Analyzer::FormatCell(Document const& rDoc, BinaryStream const& rBinStrm, Address const& rAddress, Cell const& rCell, std::string & rStrCell, Cell::Mark::List & rMarks) const
 {
-  auto spArch = ModuleManager::Instance().GetArchitecture(rCell.GetArchitectureTag());
+  auto spArch = rDoc.GetArchitecture(rCell.GetArchitectureTag());
   if (spArch == nullptr)
     return false;
   return spArch->FormatCell(rDoc, rBinStrm, rAddress, rCell, rStrCell, rMarks);
@@ -907,7 +1118,7 @@ bool Analyzer::FormatMultiCell(Document const& rDoc,BinaryStream const& rBinStrm
   auto spCell = rDoc.GetCell(rAddress);
   if (spCell == nullptr)
     return false;
-  auto spArch = ModuleManager::Instance().GetArchitecture(spCell->GetArchitectureTag());
+  auto spArch = rDoc.GetArchitecture(spCell->GetArchitectureTag());
   if (spArch == nullptr)
     return false;
   return spArch->FormatMultiCell(rDoc, rBinStrm, rAddress, rMultiCell, rStrMultiCell, rMarks);
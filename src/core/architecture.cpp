@@ -5,6 +5,8 @@ MEDUSA_NAMESPACE_BEGIN
 Architecture::Architecture(Tag ArchTag) : m_Tag(ArchTag)
 {
   m_CfgMdl.InsertBoolean("Disassembly only basic block", false);
+  m_CfgMdl.InsertBoolean("Lazy semantic", true);
+  m_CfgMdl.InsertBoolean("Simplify semantic", false);
 }
 
 u8 Architecture::GetModeByName(std::string const& rModeName) const
@@ -16,37 +18,112 @@ u8 Architecture::GetModeByName(std::string const& rModeName) const
   return 0;
 }
 
+u32 Architecture::DisassembleRange(BinaryStream const& rBinStrm, TOffset Offset, u32 Size, u8 Mode, InstructionRecord::Vector& rRecords)
+{
+  // The same instruction is reused, so decoding doesn't allocate once it is warmed up
+  Instruction Insn;
+  u8 MaxLen = GetMaximumInstructionLength();
+  TOffset EndOffset = std::min<TOffset>(Offset + Size, rBinStrm.GetSize());
+  u32 InsnNo = 0;
+
+  while (Offset < EndOffset)
+  {
+    Insn.Reset();
+    if (!Disassemble(FetchWindow(rBinStrm, Offset, MaxLen), Insn, Mode) || Insn.GetLength() == 0)
+    {
+      ++Offset;
+      continue;
+    }
+
+    InstructionRecord Rec;
+    Rec.m_Offset  = Offset;
+    Rec.m_Value   = Insn.Operand(0)->GetValue();
+    Rec.m_Opcode  = Insn.GetOpcode();
+    for (u8 OprdIdx = 0; OprdIdx < OPERAND_NO; ++OprdIdx)
+      Rec.m_OprdType[OprdIdx] = Insn.Operand(OprdIdx)->GetType();
+    Rec.m_Length  = static_cast<u16>(Insn.GetLength());
+    Rec.m_SubType = Insn.GetSubType();
+    rRecords.push_back(Rec);
+
+    Offset += Insn.GetLength();
+    ++InsnNo;
+  }
+
+  return InsnNo;
+}
+
+bool Architecture::DecodeLength(FetchWindow const& rWnd, u8 Mode, u16& rLength, u8& rSubType)
+{
+  Instruction Insn;
+  if (!Disassemble(rWnd, Insn, Mode) || Insn.GetLength() == 0)
+    return false;
+
+  rLength  = static_cast<u16>(Insn.GetLength());
+  rSubType = Insn.GetSubType();
+  return true;
+}
+
 bool Architecture::FormatCell(
   Document      const& rDoc,
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
   Cell          const& rCell,
-  std::string        & rStrCell,
-  Cell::Mark::List   & rMarks) const
+  CellText           & rText) const
 {
   switch (rCell.GetType())
   {
-  case Cell::InstructionType: return FormatInstruction(rDoc, rBinStrm, rAddr, static_cast<Instruction const&>(rCell), rStrCell, rMarks);
-  case Cell::ValueType:       return FormatValue      (rDoc, rBinStrm, rAddr, static_cast<Value       const&>(rCell), rStrCell, rMarks);
-  case Cell::CharacterType:   return FormatCharacter  (rDoc, rBinStrm, rAddr, static_cast<Character   const&>(rCell), rStrCell, rMarks);
-  case Cell::StringType:      return FormatString     (rDoc, rBinStrm, rAddr, static_cast<String      const&>(rCell), rStrCell, rMarks);
+  case Cell::InstructionType: return FormatInstruction(rDoc, rBinStrm, rAddr, static_cast<Instruction const&>(rCell), rText);
+  case Cell::ValueType:       return FormatValue      (rDoc, rBinStrm, rAddr, static_cast<Value       const&>(rCell), rText);
+  case Cell::CharacterType:   return FormatCharacter  (rDoc, rBinStrm, rAddr, static_cast<Character   const&>(rCell), rText);
+
+  // Strings are converted to UTF-8 before being escaped, they can't avoid allocations anyway
+  case Cell::StringType:
+    {
+      std::string StrCell;
+      Cell::Mark::List Marks;
+      if (!FormatString(rDoc, rBinStrm, rAddr, static_cast<String const&>(rCell), StrCell, Marks))
+        return false;
+      rText.Write(StrCell);
+      for (auto itMark = std::begin(Marks); itMark != std::end(Marks); ++itMark)
+        rText.Mark(itMark->GetType(), itMark->GetLength());
+      return true;
+    }
+
   default:                    return false;
   }
 }
 
-bool Architecture::FormatInstruction(
+bool Architecture::FormatCell(
   Document      const& rDoc,
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
-  Instruction   const& rInsn,
+  Cell          const& rCell,
   std::string        & rStrCell,
   Cell::Mark::List   & rMarks) const
+{
+  CellText Text;
+  if (!FormatCell(rDoc, rBinStrm, rAddr, rCell, Text))
+    return false;
+  Text.CopyTo(rStrCell, rMarks);
+  return true;
+}
+
+bool Architecture::FormatInstruction(
+  Document      const& rDoc,
+  BinaryStream  const& rBinStrm,
+  Address       const& rAddr,
+  Instruction   const& rInsn,
+  CellText           & rText) const
 {
   char Sep = '\0';
-  std::ostringstream oss;
 
-  oss << rInsn.GetName() << " ";
-  rMarks.push_back(Cell::Mark(Cell::Mark::MnemonicType, oss.str().size()));
+  char const* pMnem = rInsn.GetName();
+  if (pMnem == nullptr)
+    pMnem = "";
+  size_t MnemLen = strlen(pMnem);
+  rText.Write(pMnem, MnemLen);
+  rText.Write(' ');
+  rText.Mark(Cell::Mark::MnemonicType, MnemLen + 1);
 
   for (unsigned int i = 0; i < OPERAND_NO; ++i)
   {
@@ -58,27 +135,31 @@ bool Architecture::FormatInstruction(
 
     if (Sep != '\0')
     {
-      oss << Sep << " ";
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 2));
+      rText.Write(Sep);
+      rText.Write(' ');
+      rText.Mark(Cell::Mark::OperatorType, 2);
     }
 
     u32 OprdType = pOprd->GetType();
-    std::string OprdName = pOprd->GetName();
-    std::string MemBegChar = "[";
-    std::string MemEndChar = "]";
+    std::string const& rOprdName = pOprd->GetName();
+    char const* pOprdName  = rOprdName.c_str();
+    size_t      OprdLen    = rOprdName.length();
+    char        MemBegChar = '[';
+    char        MemEndChar = ']';
 
     // NOTE: Since we have to mark all characters with good type, we handle O_MEM here.
-    if (pOprd->GetType() & O_MEM)
+    if ((OprdType & O_MEM) && OprdLen >= 2)
     {
-      MemBegChar = *OprdName.begin();
-      MemEndChar = *OprdName.rbegin();
-      OprdName   =  OprdName.substr(1, OprdName.length() - 2);
+      MemBegChar = pOprdName[0];
+      MemEndChar = pOprdName[OprdLen - 1];
+      ++pOprdName;
+      OprdLen -= 2;
     }
 
     if (OprdType & O_MEM)
     {
-      oss << MemBegChar;
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Write(MemBegChar);
+      rText.Mark(Cell::Mark::OperatorType, 1);
     }
 
     do
@@ -90,84 +171,58 @@ bool Architecture::FormatInstruction(
         if (rInsn.GetOperandReference(rDoc, 0, rAddr, DstAddr))
         {
           auto Lbl = rDoc.GetLabelFromAddress(DstAddr);
-          OprdName = Lbl.GetLabel();
-          Cell::Mark::Type MarkType = Cell::Mark::LabelType;
-
-          if (OprdName.empty())  { OprdName = DstAddr.ToString(); MarkType = Cell::Mark::ImmediateType; }
+          size_t LblLen = rText.WriteLabel(Lbl);
 
-          oss << OprdName;
-          rMarks.push_back(Cell::Mark(MarkType, OprdName.length()));
+          if (LblLen == 0)
+            rText.Mark(Cell::Mark::ImmediateType, rText.WriteAddress(DstAddr));
+          else
+            rText.Mark(Cell::Mark::LabelType, LblLen);
         }
         else
-        {
-          oss << OprdName;
-          rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, OprdName.length()));
-        }
+          rText.Append(Cell::Mark::ImmediateType, pOprdName, OprdLen);
       }
       else if (OprdType & O_DISP || OprdType & O_IMM)
       {
         if (pOprd->GetType() & O_NO_REF)
         {
-          std::string ValueName = pOprd->GetName();
-          oss << ValueName;
-          rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ValueName.length()));
+          rText.Append(Cell::Mark::ImmediateType, rOprdName);
           break;
         }
 
         Address OprdAddr(Address::UnknownType, pOprd->GetSegValue(), pOprd->GetValue());
         auto Lbl = rDoc.GetLabelFromAddress(OprdAddr);
-        std::string LabelName = Lbl.GetLabel();
+        size_t LblLen = rText.WriteLabel(Lbl);
 
-        if (LabelName.empty())
+        if (LblLen == 0)
         {
-          std::string ValueName = OprdName;
-          oss << ValueName;
-          rMarks.push_back(Cell::Mark(Cell::Mark::ImmediateType, ValueName.length()));
+          rText.Append(Cell::Mark::ImmediateType, pOprdName, OprdLen);
           break;
         }
 
-        oss << LabelName;
-        rMarks.push_back(Cell::Mark(Cell::Mark::LabelType, LabelName.length()));
+        rText.Mark(Cell::Mark::LabelType, LblLen);
       }
 
       else if (OprdType & O_REG)
       {
-        if (OprdName.empty())
+        auto pCpuInfo = GetCpuInformation();
+        if (OprdLen == 0 && pCpuInfo != nullptr)
         {
-          auto pCpuInfo = GetCpuInformation();
-          OprdName = pCpuInfo->ConvertIdentifierToName(pOprd->GetReg());
+          pOprdName = pCpuInfo->ConvertIdentifierToName(pOprd->GetReg());
+          OprdLen   = pOprdName != nullptr ? strlen(pOprdName) : 0;
         }
-        oss << OprdName;
-        rMarks.push_back(Cell::Mark(Cell::Mark::RegisterType, OprdName.length()));
+        rText.Append(Cell::Mark::RegisterType, pOprdName, OprdLen);
       }
     } while (0);
 
     if (OprdType & O_MEM)
     {
-      oss << MemEndChar;
-      rMarks.push_back(Cell::Mark(Cell::Mark::OperatorType, 1));
+      rText.Write(MemEndChar);
+      rText.Mark(Cell::Mark::OperatorType, 1);
     }
 
     Sep = ',';
   }
 
-  //auto rExpr = rInsn.GetSemantic();
-  //if (rExpr.empty() == false)
-  //{
-  //  auto BegMark = oss.str().length();
-  //  oss << " [ ";
-  //  auto itExpr = std::begin(rExpr);
-  //  oss << (*itExpr)->ToString();
-  //  ++itExpr;
-  //  std::for_each(itExpr, std::end(rExpr), [&oss](Expression const* pExpr)
-  //  {
-  //    oss << "; " << pExpr->ToString();
-  //  });
-  //  oss << " ]";
-  //  rMarks.push_back(Cell::Mark::KeywordType, oss.str().length() - BegMark);
-  //}
-
-  rStrCell = oss.str();
   return true;
 }
 
@@ -176,10 +231,8 @@ bool Architecture::FormatCharacter(
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
   Character     const& rChar,
-  std::string        & rStrCell,
-  Cell::Mark::List   & rMarks) const
+  CellText           & rText) const
 {
-  std::ostringstream oss;
   TOffset Off;
 
   if (!rDoc.ConvertAddressToFileOffset(rAddr, Off))
@@ -195,20 +248,19 @@ bool Architecture::FormatCharacter(
 
       switch (Char)
       {
-      case '\0': oss << "\\0"; break;
-      case '\a': oss << "\\a"; break;
-      case '\b': oss << "\\b"; break;
-      case '\t': oss << "\\t"; break;
-      case '\n': oss << "\\n"; break;
-      case '\v': oss << "\\v"; break;
-      case '\f': oss << "\\f"; break;
-      case '\r': oss << "\\r"; break;
-      default:   oss << Char;  break;
+      case '\0': rText.Write("\\0", 2); break;
+      case '\a': rText.Write("\\a", 2); break;
+      case '\b': rText.Write("\\b", 2); break;
+      case '\t': rText.Write("\\t", 2); break;
+      case '\n': rText.Write("\\n", 2); break;
+      case '\v': rText.Write("\\v", 2); break;
+      case '\f': rText.Write("\\f", 2); break;
+      case '\r': rText.Write("\\r", 2); break;
+      default:   rText.Write(static_cast<char>(Char)); break;
       }
     }
   }
-  rMarks.push_back(Cell::Mark(Cell::Mark::StringType, 1));
-  rStrCell = oss.str();
+  rText.Mark(Cell::Mark::StringType, 1);
   return true;
 }
 
@@ -217,116 +269,68 @@ bool Architecture::FormatValue(
   BinaryStream  const& rBinStrm,
   Address       const& rAddr,
   Value         const& rVal,
-  std::string        & rStrCell,
-  Cell::Mark::List   & rMarks) const
+  CellText           & rText) const
 {
-  std::ostringstream  oss;
   TOffset             Off;
   u8                  ValueType   = rVal.GetSubType();
-  std::string         BasePrefix  = "";
+  char const*         pBasePrefix = "";
+  bool                IsHex = false;
   bool                IsUnk = false;
+  char const*         pKeyword;
+  u8                  DigitNo;
 
   auto const& rCurBinStrm = rDoc.GetBinaryStream();
 
   if (!rDoc.ConvertAddressToFileOffset(rAddr, Off))
     IsUnk = true;
 
-  oss << std::setfill('0');
-
   switch (ValueType)
   {
-  case Value::BinaryType:                                BasePrefix = "0b"; break; // TODO: Unimplemented
-  case Value::DecimalType:              oss << std::dec; BasePrefix = "0n"; break;
-  case Value::HexadecimalType: default: oss << std::hex; BasePrefix = "0x"; break;
+  case Value::BinaryType:               pBasePrefix = "0b"; break; // TODO: Unimplemented
+  case Value::DecimalType:              pBasePrefix = "0n"; break;
+  case Value::HexadecimalType: default: pBasePrefix = "0x"; IsHex = true; break;
   }
 
-  Cell::Mark::Type MarkType = Cell::Mark::ImmediateType;
   switch (rVal.GetLength())
   {
-  case 1: default:
-    {
-      if (IsUnk)
-        oss << "db (?)";
-      else
-      {
-        u8 Data;
-        if (!rCurBinStrm.Read(Off, Data))
-          return false;
-        oss << "db " << BasePrefix << std::setw(2) << static_cast<u16>(Data); //  u8 type would be printed as char by ostream
-      }
-      break;
-    }
-  case 2:
-    {
-      if (IsUnk)
-        oss << "dw (?)";
-      else
-      {
-        u16 Data;
-        if (!rCurBinStrm.Read(Off, Data))
-          return false;
+  case 1: default: pKeyword = "db "; DigitNo =  2; break;
+  case 2:          pKeyword = "dw "; DigitNo =  4; break;
+  case 4:          pKeyword = "dd "; DigitNo =  8; break;
+  case 8:          pKeyword = "dq "; DigitNo = 16; break;
+  }
 
-        Label Lbl = rDoc.GetLabelFromAddress(Data);
-        if (Lbl.GetType() == Label::Unknown)
-          oss << "dw " << BasePrefix << std::setw(4) << static_cast<u16>(Data);
+  if (IsUnk)
+  {
+    rText.Append(Cell::Mark::KeywordType, pKeyword, 3);
+    rText.Append(Cell::Mark::ImmediateType, "(?)", 3);
+    return true;
+  }
 
-        else
-        {
-          oss << "dw " << Lbl.GetLabel();
-          MarkType = Cell::Mark::LabelType;
-        }
-      }
-      break;
-    }
-  case 4:
-    {
-      if (IsUnk)
-        oss << "dd (?)";
-      else
-      {
-        u32 Data;
-        if (!rCurBinStrm.Read(Off, Data))
-          return false;
+  u64 Data;
+  switch (DigitNo)
+  {
+  case  2: { u8  Data8;  if (!rCurBinStrm.Read(Off, Data8))  return false; Data = Data8;  break; }
+  case  4: { u16 Data16; if (!rCurBinStrm.Read(Off, Data16)) return false; Data = Data16; break; }
+  case  8: { u32 Data32; if (!rCurBinStrm.Read(Off, Data32)) return false; Data = Data32; break; }
+  default: { if (!rCurBinStrm.Read(Off, Data)) return false; break; }
+  }
 
-        Label Lbl = rDoc.GetLabelFromAddress(Data);
-        if (Lbl.GetType() == Label::Unknown)
-          oss << "dd " << BasePrefix << std::setw(8) << static_cast<u32>(Data);
+  rText.Append(Cell::Mark::KeywordType, pKeyword, 3);
 
-        else
-        {
-          oss << "dd " << Lbl.GetLabel();
-          MarkType = Cell::Mark::LabelType;
-        }
-      }
-      break;
-    }
-  case 8:
+  // Bytes are never resolved as label
+  if (DigitNo != 2)
+  {
+    Label Lbl = rDoc.GetLabelFromAddress(Data);
+    if (Lbl.GetType() != Label::Unknown)
     {
-      if (IsUnk)
-        oss << "dq (?)";
-      else
-      {
-        u64 Data;
-        if (!rCurBinStrm.Read(Off, Data))
-          return false;
-
-        Label Lbl = rDoc.GetLabelFromAddress(Data);
-        if (Lbl.GetType() == Label::Unknown)
-          oss << "dq " << BasePrefix << std::setw(16) << static_cast<u64>(Data);
-
-        else
-        {
-          oss << "dq " << Lbl.GetLabel();
-          MarkType = Cell::Mark::LabelType;
-        }
-      }
-      break;
+      rText.Mark(Cell::Mark::LabelType, rText.WriteLabel(Lbl));
+      return true;
     }
   }
 
-  rMarks.push_back(Cell::Mark(Cell::Mark::KeywordType, 3));
-  rMarks.push_back(Cell::Mark(MarkType, oss.str().length() - 3));
-  rStrCell = oss.str();
+  rText.Write(pBasePrefix, 2);
+  size_t ValueLen = IsHex ? rText.WriteHex(Data, DigitNo) : rText.WriteDecimal(Data, DigitNo);
+  rText.Mark(Cell::Mark::ImmediateType, ValueLen + 2);
   return true;
 }
 
@@ -19,7 +19,7 @@ void CellAction::GetCellActionBuilders(Medusa const& rCore, Address const& rAddr
   std::list<Tag> const Tags = rCore.GetDocument().GetArchitectureTags();
   for (auto itTag = std::begin(Tags), itEnd = std::end(Tags); itTag != itEnd; ++itTag)
   {
-    auto spArch = ModuleManager::Instance().GetArchitecture(*itTag);
+    auto spArch = rCore.GetDocument().GetArchitecture(*itTag);
     if (spArch == nullptr)
       continue;
     Architecture::NamedModeVector AvailableModes = spArch->GetModes();
@@ -92,7 +92,7 @@ void CellAction_Analyze::Do(Medusa& rCore, Address::List const& rAddrList)
 {
   std::for_each(std::begin(rAddrList), std::end(rAddrList), [&](Address const& rAddr)
   {
-    auto spArch = ModuleManager::Instance().GetArchitecture(rCore.GetDocument().GetArchitectureTag(rAddr));
+    auto spArch = rCore.GetDocument().GetArchitecture(rCore.GetDocument().GetArchitectureTag(rAddr));
     u8 Mode = rCore.GetDocument().GetMode(rAddr);
     if (spArch == nullptr)
     {
@@ -105,7 +105,7 @@ void CellAction_Analyze::Do(Medusa& rCore, Address::List const& rAddrList)
 
 void CellAction_AnalyzeWith::Do(Medusa& rCore, Address::List const& rAddrList)
 {
-  auto spArch = ModuleManager::Instance().GetArchitecture(m_ArchTag);
+  auto spArch = rCore.GetDocument().GetArchitecture(m_ArchTag);
   if (spArch == nullptr)
     return; // TODO: Log error
   u8 Mode = std::get<1>(m_NamedMode);
@@ -0,0 +1,78 @@
+#include "medusa/cell_text.hpp"
+#include "medusa/address.hpp"
+#include "medusa/label.hpp"
+
+MEDUSA_NAMESPACE_BEGIN
+
+CellText::CellText(void)
+{
+  // Most lines fit, so the first cells don't grow the buffers one after another
+  m_Text.reserve(0x80);
+  m_Marks.reserve(0x20);
+}
+
+size_t CellText::WriteHex(u64 Value, u8 MinDigitNo)
+{
+  static char const s_HexDigits[] = "0123456789abcdef";
+
+  u8 DigitNo = 1;
+  for (u64 Rest = Value >> 4; Rest != 0; Rest >>= 4)
+    ++DigitNo;
+  if (DigitNo < MinDigitNo)
+    DigitNo = MinDigitNo;
+
+  // Digits are written from the end, resizing inside the capacity doesn't allocate
+  size_t TextEnd = m_Text.length() + DigitNo;
+  m_Text.resize(TextEnd, '0');
+  for (size_t CurIdx = TextEnd; Value != 0; Value >>= 4)
+    m_Text[--CurIdx] = s_HexDigits[Value & 0xf];
+
+  return DigitNo;
+}
+
+size_t CellText::WriteDecimal(u64 Value, u8 MinDigitNo)
+{
+  char Buf[20];
+  char* pCur = Buf + sizeof(Buf);
+  do
+  {
+    *--pCur = static_cast<char>('0' + Value % 10);
+    Value /= 10;
+  } while (Value != 0);
+
+  size_t DigitNo = Buf + sizeof(Buf) - pCur;
+  size_t PadNo   = DigitNo < MinDigitNo ? MinDigitNo - DigitNo : 0;
+  m_Text.append(PadNo, '0');
+  Write(pCur, DigitNo);
+  return PadNo + DigitNo;
+}
+
+size_t CellText::WriteAddress(Address const& rAddr)
+{
+  size_t Len = 0;
+
+  if (rAddr.GetAddressingType() != Address::FlatType && rAddr.GetAddressingType() != Address::UnknownType)
+  {
+    Len += WriteHex(rAddr.GetBase(), rAddr.GetBaseSize() / 4);
+    Write(':');
+    ++Len;
+  }
+
+  Len += WriteHex(rAddr.GetOffset(), rAddr.GetOffsetSize() / 4);
+  return Len;
+}
+
+size_t CellText::WriteLabel(Label const& rLbl)
+{
+  size_t TextBeg = m_Text.length();
+  rLbl.AppendLabel(m_Text);
+  return m_Text.length() - TextBeg;
+}
+
+void CellText::CopyTo(std::string& rText, Cell::Mark::List& rMarks) const
+{
+  rText = m_Text;
+  rMarks.insert(std::end(rMarks), std::begin(m_Marks), std::end(m_Marks));
+}
+
+MEDUSA_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include "medusa/context.hpp"
 #include <iomanip>
+#include <deque>
+#include <mutex>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -174,80 +176,126 @@ bool MemoryContext::FindMemoryChunk(u64 LinearAddress, MemoryChunk& rFoundMemChn
   return false;
 }
 
-bool VariableContext::ReadVariable(std::string const& rVariableName, u64& rValue) const
+namespace
 {
-  auto const itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
+  // Names are never removed, a deque keeps the references given by GetVariableName valid
+  struct VariableNameTable
+  {
+    std::mutex                           m_Mutex;
+    std::deque<std::string>              m_Names;
+    std::unordered_map<std::string, u32> m_Slots;
+  };
+
+  VariableNameTable& GetVariableNameTable(void)
+  {
+    static VariableNameTable s_VarNames;
+    return s_VarNames;
+  }
+}
+
+u32 VariableContext::GetVariableSlot(std::string const& rVariableName)
+{
+  auto& rVarNames = GetVariableNameTable();
+  std::lock_guard<std::mutex> Lock(rVarNames.m_Mutex);
+
+  auto itSlot = rVarNames.m_Slots.find(rVariableName);
+  if (itSlot != std::end(rVarNames.m_Slots))
+    return itSlot->second;
+
+  u32 Slot = static_cast<u32>(rVarNames.m_Names.size());
+  rVarNames.m_Names.push_back(rVariableName);
+  rVarNames.m_Slots[rVariableName] = Slot;
+  return Slot;
+}
+
+std::string const& VariableContext::GetVariableName(u32 Slot)
+{
+  static std::string const s_Unknown = "unknown";
+  auto& rVarNames = GetVariableNameTable();
+  std::lock_guard<std::mutex> Lock(rVarNames.m_Mutex);
+
+  if (Slot >= rVarNames.m_Names.size())
+    return s_Unknown;
+  return rVarNames.m_Names[Slot];
+}
+
+bool VariableContext::ReadVariable(u32 Slot, u64& rValue) const
+{
+  if (Slot >= m_Variables.size())
     return false;
+  auto const& rVar = m_Variables[Slot];
 
-  switch (itVar->second.m_Type)
+  switch (rVar.m_Type)
   {
-  case Var1Bit:  rValue = (itVar->second.u.m_Value & 0x00000001); break;
-  case Var8Bit:  rValue = (itVar->second.u.m_Value & 0x000000ff); break;
-  case Var16Bit: rValue = (itVar->second.u.m_Value & 0x0000ffff); break;
-  case Var32Bit: rValue = (itVar->second.u.m_Value & 0xffffffff); break;
-  case Var64Bit: rValue = (itVar->second.u.m_Value);              break;
+  case Var1Bit:  rValue = (rVar.u.m_Value & 0x00000001); break;
+  case Var8Bit:  rValue = (rVar.u.m_Value & 0x000000ff); break;
+  case Var16Bit: rValue = (rVar.u.m_Value & 0x0000ffff); break;
+  case Var32Bit: rValue = (rVar.u.m_Value & 0xffffffff); break;
+  case Var64Bit: rValue = (rVar.u.m_Value);              break;
   default: return false;
   }
 
   return true;
 }
 
-bool VariableContext::WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend)
+bool VariableContext::WriteVariable(u32 Slot, u64 Value, bool SignExtend)
 {
-  auto itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
+  if (Slot >= m_Variables.size())
     return false;
+  auto& rVar = m_Variables[Slot];
 
-  switch (itVar->second.m_Type)
+  switch (rVar.m_Type)
   {
-  case Var1Bit:  itVar->second.u.m_Value = (Value & 0x00000001); break;
-  case Var8Bit:  itVar->second.u.m_Value = (Value & 0x000000ff); break;
-  case Var16Bit: itVar->second.u.m_Value = (Value & 0x0000ffff); break;
-  case Var32Bit: itVar->second.u.m_Value = (Value & 0xffffffff); break;
-  case Var64Bit: itVar->second.u.m_Value = (Value);              break;
+  case Var1Bit:  rVar.u.m_Value = (Value & 0x00000001); break;
+  case Var8Bit:  rVar.u.m_Value = (Value & 0x000000ff); break;
+  case Var16Bit: rVar.u.m_Value = (Value & 0x0000ffff); break;
+  case Var32Bit: rVar.u.m_Value = (Value & 0xffffffff); break;
+  case Var64Bit: rVar.u.m_Value = (Value);              break;
   default: return false;
   }
 
   return true;
 }
 
-void* VariableContext::GetVariable(std::string const& rVariableName)
+void* VariableContext::GetVariable(u32 Slot)
 {
-  auto itVar = m_Variables.find(rVariableName);
-  if (itVar == std::end(m_Variables))
+  if (Slot >= m_Variables.size() || m_Variables[Slot].m_Type == VarUnknown)
     return nullptr;
-  return itVar->second.u.m_pValue;
+  return m_Variables[Slot].u.m_pValue;
 }
 
-bool VariableContext::AllocateVariable(u32 Type, std::string const& rVariableName)
+bool VariableContext::AllocateVariable(u32 Type, u32 Slot)
 {
-  FreeVariable(rVariableName);
+  if (Slot >= m_Variables.size())
+    m_Variables.resize(Slot + 1);
 
-  m_Variables[rVariableName] = VariableInformation(Type, 0x0);
+  m_Variables[Slot] = VariableInformation(Type, 0x0);
   return true;
 }
 
-bool VariableContext::FreeVariable(std::string const& rVariableName)
+bool VariableContext::FreeVariable(u32 Slot)
 {
-  auto VarNo = m_Variables.size();
-  m_Variables.erase(rVariableName);
-  return VarNo != m_Variables.size();
+  if (Slot >= m_Variables.size() || m_Variables[Slot].m_Type == VarUnknown)
+    return false;
+  m_Variables[Slot] = VariableInformation();
+  return true;
 }
 
 std::string VariableContext::ToString(void) const
 {
-  if (m_Variables.empty())
-    return "";
-
   std::ostringstream oss;
 
-  for (auto itVar = std::begin(m_Variables); itVar != std::end(m_Variables); ++itVar)
+  for (u32 Slot = 0; Slot < m_Variables.size(); ++Slot)
+  {
+    auto const& rVar = m_Variables[Slot];
+    if (rVar.m_Type == VarUnknown)
+      continue;
     oss
-      << "var: " << itVar->first
-      << ", type: " << static_cast<int>(itVar->second.m_Type)
-      << ", value: " << std::hex << std::setfill('0') << std::setw(itVar->second.m_Type / 8 * 2) << itVar->second.u.m_Value
+      << "var: " << GetVariableName(Slot)
+      << ", type: " << static_cast<int>(rVar.m_Type)
+      << ", value: " << std::hex << std::setfill('0') << std::setw(rVar.m_Type / 8 * 2) << rVar.u.m_Value
       << std::endl;
+  }
   return oss.str();
 }
 
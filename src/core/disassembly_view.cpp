@@ -10,7 +10,7 @@ MEDUSA_NAMESPACE_USE;
 
 DisassemblyView::DisassemblyView(Medusa& rCore, Printer* pPrinter, u32 PrinterFlags, Address::List const& rAddresses)
   : View(Document::Subscriber::DocumentUpdated, rCore.GetDocument())
-  , m_rCore(rCore)
+  , m_Mutex("disassembly_view"), m_rCore(rCore)
   , m_pPrinter(pPrinter), m_PrinterFlags(PrinterFlags)
   , m_Addresses(rAddresses)
   , m_Width(), m_Height()
@@ -20,13 +20,13 @@ DisassemblyView::DisassemblyView(Medusa& rCore, Printer* pPrinter, u32 PrinterFl
 
 DisassemblyView::~DisassemblyView(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
   delete m_pPrinter;
 }
 
 void DisassemblyView::Refresh(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   _Prepare();
 }
@@ -36,7 +36,7 @@ void DisassemblyView::Print(void)
   u32 LineNo;
   u32 yOffset = 0;
 
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   for (auto itAddr = std::begin(m_Addresses); itAddr != std::end(m_Addresses); ++itAddr)
   {
@@ -49,7 +49,7 @@ void DisassemblyView::Print(void)
 
 bool DisassemblyView::GetAddressFromPosition(Address& rAddress, u32 xPos, u32 yPos) const
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   if (yPos >= m_Addresses.size())
     return false;
@@ -81,7 +81,7 @@ void DisassemblyView::GetDimension(u32& rWidth, u32& rHeight) const
 
 FullDisassemblyView::FullDisassemblyView(Medusa& rCore, Printer* pPrinter, u32 PrinterFlags, u32 Width, u32 Height, Address const& rAddress)
   : View(Document::Subscriber::DocumentUpdated, rCore.GetDocument())
-  , m_rCore(rCore)
+  , m_Mutex("disassembly_view"), m_rCore(rCore)
   , m_pPrinter(pPrinter), m_PrinterFlags(PrinterFlags)
   , m_Cursor(rAddress)
   , m_SelectionBegin(), m_SelectionEnd()
@@ -92,7 +92,7 @@ FullDisassemblyView::FullDisassemblyView(Medusa& rCore, Printer* pPrinter, u32 P
 
 FullDisassemblyView::~FullDisassemblyView(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
   delete m_pPrinter;
 }
 
@@ -124,7 +124,7 @@ void FullDisassemblyView::GetDimension(u32& rWidth, u32& rHeight) const
 
 void FullDisassemblyView::Refresh(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   if (m_VisiblesAddresses.empty())
     return;
@@ -140,7 +140,7 @@ void FullDisassemblyView::Resize(u32 Width, u32 Height)
 
 void FullDisassemblyView::Print(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   if (m_VisiblesAddresses.empty())
     return;
@@ -172,7 +172,7 @@ bool FullDisassemblyView::Scroll(s32 xOffset, s32 yOffset)
 
   if (yOffset)
   {
-    boost::mutex::scoped_lock Lock(m_Mutex);
+    MutexType::scoped_lock Lock(m_Mutex);
 
     if (m_VisiblesAddresses.empty())
       return false;
@@ -190,7 +190,7 @@ bool FullDisassemblyView::Scroll(s32 xOffset, s32 yOffset)
 bool FullDisassemblyView::MoveCursor(s32 xOffset, s32 yOffset)
 {
   {
-    boost::mutex::scoped_lock Lock(m_Mutex);
+    MutexType::scoped_lock Lock(m_Mutex);
 
     m_Cursor.m_xAddressOffset += xOffset;
 
@@ -238,7 +238,7 @@ bool FullDisassemblyView::SetCursor(u32 x, u32 y)
 
 bool FullDisassemblyView::GoTo(Address const& rAddress)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
   m_Cursor.m_Address = rAddress;
   _Prepare(rAddress);
   return m_VisiblesAddresses.empty() ? false : true;
@@ -246,7 +246,7 @@ bool FullDisassemblyView::GoTo(Address const& rAddress)
 
 bool FullDisassemblyView::GetAddressFromPosition(Address& rAddress, u32 xPos, u32 yPos) const
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
   if (yPos >= m_VisiblesAddresses.size())
     return false;
 
@@ -260,7 +260,7 @@ bool FullDisassemblyView::GetAddressFromPosition(Address& rAddress, u32 xPos, u3
 
 bool FullDisassemblyView::EnsureCursorIsVisible(void)
 {
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
   if (m_VisiblesAddresses.empty())
     return false;
 
@@ -323,7 +323,7 @@ bool FullDisassemblyView::_ConvertViewOffsetToAddressOffset(TextPosition& rTxtPo
 
   if (y != -1)
   {
-    boost::mutex::scoped_lock Lock(m_Mutex);
+    MutexType::scoped_lock Lock(m_Mutex);
 
     if (y > m_VisiblesAddresses.size())
       return false;
@@ -362,7 +362,7 @@ bool FullDisassemblyView::_ConvertAddressOffsetToViewOffset(TextPosition const&
   x = rTxtPos.m_xAddressOffset;
   y = 0;
 
-  boost::mutex::scoped_lock Lock(m_Mutex);
+  MutexType::scoped_lock Lock(m_Mutex);
 
   if (m_VisiblesAddresses.empty())
     return false;
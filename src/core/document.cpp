@@ -2,13 +2,18 @@
 #include "medusa/medusa.hpp"
 #include "medusa/value.hpp"
 #include "medusa/log.hpp"
-#include "medusa/module.hpp"
 
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
 
 MEDUSA_NAMESPACE_BEGIN
 
+Document::Document(void)
+  : m_CellMutex("document.cell")
+  , m_ArchIdPool(0x0), m_DefaultArchitectureTag(MEDUSA_ARCH_UNK), m_ArchitectureMutex("document.architecture")
+{
+}
+
 Document::~Document(void)
 {
   if (m_spDatabase)
@@ -30,6 +35,49 @@ bool Document::Flush(void)
   return m_spDatabase->Flush();
 }
 
+bool Document::RegisterArchitecture(Architecture::SharedPtr spArch)
+{
+  MutexType::scoped_lock Lock(m_ArchitectureMutex);
+
+  u8 Id = 0;
+  bool FoundId = false;
+
+  for (u8 i = 0; i < 32; ++i)
+    if (!(m_ArchIdPool & (1 << i)))
+    {
+      m_ArchIdPool |= (1 << i);
+      Id = i;
+      FoundId = true;
+      break;
+    }
+
+  if (FoundId == false)
+    return false;
+
+  spArch->UpdateId(Id);
+
+  m_TaggedArchitectures[spArch->GetTag()] = spArch;
+
+  if (m_DefaultArchitectureTag == MEDUSA_ARCH_UNK)
+    m_DefaultArchitectureTag = spArch->GetTag();
+
+  return true;
+}
+
+Architecture::SharedPtr Document::GetArchitecture(Tag ArchTag) const
+{
+  MutexType::scoped_lock Lock(m_ArchitectureMutex);
+
+  if (ArchTag == MEDUSA_ARCH_UNK)
+    ArchTag = m_DefaultArchitectureTag;
+
+  auto itArch = m_TaggedArchitectures.find(ArchTag);
+  if (itArch == std::end(m_TaggedArchitectures))
+    return Architecture::SharedPtr();
+
+  return itArch->second;
+}
+
 void Document::RemoveAll(void)
 {
   m_spDatabase = nullptr;
@@ -175,6 +223,16 @@ bool Document::GetCrossReferenceTo(Address const& rFrom, Address& rTo) const
   return m_spDatabase->GetCrossReferenceTo(rFrom, rTo);
 }
 
+bool Document::GetCrossReferenceTo(Address const& rFrom, Address::List& rToList) const
+{
+  return m_spDatabase->GetCrossReferenceTo(rFrom, rToList);
+}
+
+bool Document::CompactCrossReferences(void)
+{
+  return m_spDatabase->CompactCrossReferences();
+}
+
 bool Document::ChangeValueSize(Address const& rValueAddr, u8 NewValueSize, bool Force)
 {
   if (NewValueSize == 0x0)
@@ -226,28 +284,26 @@ bool Document::SetComment(Address const& rAddress, std::string const& rComment)
 
 Cell::SPtr Document::GetCell(Address const& rAddr)
 {
-  boost::mutex::scoped_lock Lock(m_CellMutex);
+  MutexType::scoped_lock Lock(m_CellMutex);
 
   CellData CurCellData;
   if (!m_spDatabase->GetCellData(rAddr, CurCellData))
-    return false;
-  auto spCellData = std::make_shared<CellData>(CurCellData); // TODO: we can avoid this
-
+    return nullptr;
   switch (CurCellData.GetType())
   {
-  case Cell::ValueType:     return std::make_shared<Value>(spCellData);
-  case Cell::CharacterType: return std::make_shared<Character>(spCellData);
-  case Cell::StringType:    return std::make_shared<String>(spCellData);
+  case Cell::ValueType:     return MakePooled<Value>(MakePooled<CellData>(CurCellData));
+  case Cell::CharacterType: return MakePooled<Character>(MakePooled<CellData>(CurCellData));
+  case Cell::StringType:    return MakePooled<String>(MakePooled<CellData>(CurCellData));
   case Cell::InstructionType:
     {
-      auto spInsn = std::make_shared<Instruction>();
+      auto spInsn = MakePooled<Instruction>();
       spInsn->GetData()->ArchitectureTag() = CurCellData.GetArchitectureTag();
       spInsn->Mode() = CurCellData.GetMode();
-      auto spArch = ModuleManager::Instance().GetArchitecture(CurCellData.GetArchitectureTag());
+      auto spArch = GetArchitecture(CurCellData.GetArchitectureTag());
       if (spArch == nullptr)
       {
         Log::Write("core") << "unable to get architecture for " << rAddr << LogEnd;
-        return false;
+        return nullptr;
       }
       TOffset Offset;
       ConvertAddressToFileOffset(rAddr, Offset);
@@ -263,28 +319,26 @@ Cell::SPtr Document::GetCell(Address const& rAddr)
 
 Cell::SPtr const Document::GetCell(Address const& rAddr) const
 {
-  boost::mutex::scoped_lock Lock(m_CellMutex);
+  MutexType::scoped_lock Lock(m_CellMutex);
 
   CellData CurCellData;
   if (!m_spDatabase->GetCellData(rAddr, CurCellData))
-    return false;
-  auto spCellData = std::make_shared<CellData>(CurCellData); // TODO: we can avoid this
-
+    return nullptr;
   switch (CurCellData.GetType())
   {
-  case Cell::ValueType:     return std::make_shared<Value>(spCellData);
-  case Cell::CharacterType: return std::make_shared<Character>(spCellData);
-  case Cell::StringType:    return std::make_shared<String>(spCellData);
+  case Cell::ValueType:     return MakePooled<Value>(MakePooled<CellData>(CurCellData));
+  case Cell::CharacterType: return MakePooled<Character>(MakePooled<CellData>(CurCellData));
+  case Cell::StringType:    return MakePooled<String>(MakePooled<CellData>(CurCellData));
   case Cell::InstructionType:
     {
-      auto spInsn = std::make_shared<Instruction>();
+      auto spInsn = MakePooled<Instruction>();
       spInsn->GetData()->ArchitectureTag() = CurCellData.GetArchitectureTag();
       spInsn->Mode() = CurCellData.GetMode();
-      auto spArch = ModuleManager::Instance().GetArchitecture(CurCellData.GetArchitectureTag());
+      auto spArch = GetArchitecture(CurCellData.GetArchitectureTag());
       if (spArch == nullptr)
       {
         Log::Write("core") << "unable to get architecture for " << rAddr << LogEnd;
-        return false;
+        return nullptr;
       }
       TOffset Offset;
       ConvertAddressToFileOffset(rAddr, Offset);
@@ -532,7 +586,7 @@ u8 Document::GetMode(Address const& rAddress) const
   auto const spCell = GetCell(rAddress);
   if (spCell != nullptr)
   {
-    auto spCellArch = ModuleManager::Instance().GetArchitecture(spCell->GetArchitectureTag());
+    auto spCellArch = GetArchitecture(spCell->GetArchitectureTag());
     if (spCellArch != nullptr)
     {
       Mode = spCellArch->GetDefaultMode(rAddress);
@@ -547,7 +601,7 @@ u8 Document::GetMode(Address const& rAddress) const
   auto const pMemArea = GetMemoryArea(rAddress);
   if (pMemArea != nullptr)
   {
-    auto spMemAreaArch = ModuleManager::Instance().GetArchitecture(pMemArea->GetArchitectureTag());
+    auto spMemAreaArch = GetArchitecture(pMemArea->GetArchitectureTag());
     if (spMemAreaArch != nullptr)
     {
       Mode = spMemAreaArch->GetDefaultMode(rAddress);
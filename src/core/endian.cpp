@@ -4,9 +4,9 @@ MEDUSA_NAMESPACE_BEGIN
 
 bool TestEndian(EEndianness Endianness)
 {
-#if defined(BOOST_LITTLE_ENDIAN)
+#if BOOST_ENDIAN_LITTLE_BYTE
   return (Endianness == BigEndian);
-#elif defined(BOOST_BIG_ENDIAN)
+#elif BOOST_ENDIAN_BIG_BYTE
   return (Endianness == LittleEndian);
 #else
 # error Unable to determine the current endianness
@@ -98,12 +98,20 @@ void Execution::Execute(Address const& rAddr)
         return;
       }
 
-      std::string StrCell;
-      Cell::Mark::List Marks;
-      if (m_pCore->FormatCell(CurAddr, *spCurInsn, StrCell, Marks) == false)
-        break;
+      // Formatting an instruction costs more than emulating it, so it's only done for tracing
+      if (Log::IsEnabled(Log::Debug))
+      {
+        std::string StrCell;
+        Cell::Mark::List Marks;
+        if (m_pCore->FormatCell(CurAddr, *spCurInsn, StrCell, Marks) == false)
+          break;
+
+        Log::Write("exec", Log::Debug) << StrCell << LogEnd;
+      }
 
-      Log::Write("exec") << StrCell << LogEnd;
+      // The semantic is kept by the instruction, so it must be built outside the arena
+      auto const& rCurSem = spCurInsn->GetSemantic();
+      ExpressionArena::Scope SemScope(&m_SemArena);
 
       Sems.push_back(new OperationExpression(OperationExpression::OpAff,
         new IdentifierExpression(ProgPtrReg, m_pCpuInfo),
@@ -113,7 +121,6 @@ void Execution::Execute(Address const& rAddr)
         )));
       CurAddr.SetOffset(CurAddr.GetOffset() + spCurInsn->GetLength());
 
-      auto const& rCurSem = spCurInsn->GetSemantic();
       if (rCurSem.empty())
       {
         Log::Write("exec") << "no semantic available" << LogEnd;
@@ -129,6 +136,7 @@ void Execution::Execute(Address const& rAddr)
     bool Res = m_spEmul->Execute(BlkAddr, Sems);
     std::for_each(std::begin(Sems), std::end(Sems), [](Expression* pExpr)
     { delete pExpr; });
+    m_SemArena.Reset();
 
     if (Res == false)
     {
@@ -6,6 +6,104 @@
 
 MEDUSA_NAMESPACE_USE
 
+namespace
+{
+  // The header tells delete where the expression comes from, it keeps the payload aligned
+  enum { ExpressionHeaderSize = 0x10 };
+  enum { HeapExpression, ArenaExpression };
+
+  thread_local ExpressionArena* s_pCurrentArena = nullptr;
+}
+
+ExpressionArena::Scope::Scope(ExpressionArena* pArena)
+  : m_pPrevArena(s_pCurrentArena)
+{
+  s_pCurrentArena = pArena;
+}
+
+ExpressionArena::Scope::~Scope(void)
+{
+  s_pCurrentArena = m_pPrevArena;
+}
+
+ExpressionArena::ExpressionArena(size_t ChunkSize)
+  : m_ChunkSize(ChunkSize)
+  , m_ChunkNo(0)
+  , m_pCur(nullptr)
+  , m_pEnd(nullptr)
+  , m_UsedSize(0)
+{
+}
+
+ExpressionArena::~ExpressionArena(void)
+{
+  for (u8* pChunk : m_Chunks)
+    delete[] pChunk;
+}
+
+void* ExpressionArena::Allocate(size_t Size)
+{
+  Size = (Size + 0xf) & ~static_cast<size_t>(0xf);
+  if (Size > m_ChunkSize)
+    return nullptr;
+
+  if (static_cast<size_t>(m_pEnd - m_pCur) < Size)
+  {
+    if (m_ChunkNo == m_Chunks.size())
+      m_Chunks.push_back(new u8[m_ChunkSize]);
+    m_pCur = m_Chunks[m_ChunkNo++];
+    m_pEnd = m_pCur + m_ChunkSize;
+  }
+
+  void* pMem = m_pCur;
+  m_pCur += Size;
+  m_UsedSize += Size;
+  return pMem;
+}
+
+void ExpressionArena::Reset(void)
+{
+  m_ChunkNo  = 0;
+  m_pCur     = nullptr;
+  m_pEnd     = nullptr;
+  m_UsedSize = 0;
+}
+
+ExpressionArena* ExpressionArena::GetCurrent(void)
+{
+  return s_pCurrentArena;
+}
+
+void* Expression::operator new(size_t Size)
+{
+  u8* pBlock = nullptr;
+  u8  Origin = ArenaExpression;
+
+  auto pArena = s_pCurrentArena;
+  if (pArena != nullptr)
+    pBlock = static_cast<u8*>(pArena->Allocate(ExpressionHeaderSize + Size));
+
+  // Expressions bigger than a chunk are allocated from the heap, even in a scope
+  if (pBlock == nullptr)
+  {
+    pBlock = static_cast<u8*>(::operator new(ExpressionHeaderSize + Size));
+    Origin = HeapExpression;
+  }
+
+  *pBlock = Origin;
+  return pBlock + ExpressionHeaderSize;
+}
+
+void Expression::operator delete(void* pExpr)
+{
+  if (pExpr == nullptr)
+    return;
+
+  u8* pBlock = static_cast<u8*>(pExpr) - ExpressionHeaderSize;
+  if (*pBlock == HeapExpression)
+    ::operator delete(pBlock);
+}
+
 /* Usually the main operation is located in the first expression */
 Expression* ExpressionVisitor_FindOperation::VisitBind(Expression::List const& rExprList)
 {
@@ -463,15 +561,16 @@ bool MemoryExpression::GetAddress(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt,
 
 std::string VariableExpression::ToString(void) const
 {
+  auto const& rName = VariableContext::GetVariableName(m_Slot);
   if (m_Type == 0)
-    return m_Name;
+    return rName;
 
-  return (boost::format("var%d %s") % m_Type % m_Name).str();
+  return (boost::format("var%d %s") % m_Type % rName).str();
 }
 
 Expression* VariableExpression::Clone(void) const
 {
-  return new VariableExpression(m_Type, m_Name);
+  return new VariableExpression(m_Type, m_Slot);
 }
 
 u32 VariableExpression::GetSizeInBit(void) const
@@ -481,12 +580,12 @@ u32 VariableExpression::GetSizeInBit(void) const
 
 bool VariableExpression::Read(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, u64& rValue, bool SignExtend) const
 {
-  return pVarCtxt->ReadVariable(m_Name, rValue);
+  return pVarCtxt->ReadVariable(m_Slot, rValue);
 }
 
 bool VariableExpression::Write(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, u64 Value, bool SignExtend)
 {
-  return pVarCtxt->WriteVariable(m_Name, Value);
+  return pVarCtxt->WriteVariable(m_Slot, Value);
 }
 
 bool VariableExpression::GetAddress(CpuContext *pCpuCtxt, MemoryContext* pMemCtxt, VariableContext* pVarCtxt, Address& rAddress) const
@@ -0,0 +1,311 @@
+#include "medusa/expression_dag.hpp"
+
+#include <algorithm>
+
+MEDUSA_NAMESPACE_USE
+
+namespace
+{
+  u64 MixHash(u64 Hash, u64 Value)
+  {
+    Hash ^= Value + 0x9e3779b97f4a7c15ULL + (Hash << 6) + (Hash >> 2);
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    return Hash;
+  }
+
+  // Children are interned first, their ids are enough to identify them
+  u64 HashNode(ExpressionDag::Node const& rNode, ExpressionDag::Id const* pOperands, size_t OperandNo)
+  {
+    u64 Hash = MixHash(rNode.m_Kind, rNode.m_Type);
+    Hash = MixHash(Hash, rNode.m_Value);
+    Hash = MixHash(Hash, (static_cast<u64>(rNode.m_Flags) << 16) | rNode.m_CpuInfoIdx);
+    for (size_t OprdIdx = 0; OprdIdx < OperandNo; ++OprdIdx)
+      Hash = MixHash(Hash, pOperands[OprdIdx]);
+    return Hash;
+  }
+
+  ExpressionDag::Node MakeNode(ExpressionDag::Kind NodeKind, u32 Type = 0, u64 Value = 0)
+  {
+    ExpressionDag::Node NewNode;
+    NewNode.m_Hash       = 0;
+    NewNode.m_Value      = Value;
+    for (auto& rOprdId : NewNode.m_Operands)
+      rOprdId = ExpressionDag::InvalidId;
+    NewNode.m_Type       = Type;
+    NewNode.m_Kind       = static_cast<u8>(NodeKind);
+    NewNode.m_Flags      = 0;
+    NewNode.m_CpuInfoIdx = 0;
+    return NewNode;
+  }
+}
+
+// Interner walks an expression bottom-up, each visit leaves the id of the visited node in m_Id
+class ExpressionDag::Interner : public ExpressionVisitor
+{
+public:
+  Interner(ExpressionDag& rDag) : m_rDag(rDag), m_Id(InvalidId) {}
+
+  Id Intern(Expression const* pExpr)
+  {
+    if (pExpr == nullptr)
+      return InvalidId;
+    pExpr->Visit(this);
+    return m_Id;
+  }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    IdVector Operands;
+    Operands.reserve(rExprList.size());
+    for (Expression const* pExpr : rExprList)
+      Operands.push_back(Intern(pExpr));
+    m_Id = m_rDag._InternBind(Operands);
+    return nullptr;
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    return _Condition(ConditionKind, Type, pRefExpr, pTestExpr, nullptr, nullptr);
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    return _Condition(IfConditionKind, Type, pRefExpr, pTestExpr, pThenExpr, nullptr);
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    return _Condition(IfElseConditionKind, Type, pRefExpr, pTestExpr, pThenExpr, pElseExpr);
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    return _Condition(WhileConditionKind, Type, pRefExpr, pTestExpr, pBodyExpr, nullptr);
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    auto NewNode = MakeNode(OperationKind, Type);
+    NewNode.m_Operands[0] = Intern(pLeftExpr);
+    NewNode.m_Operands[1] = Intern(pRightExpr);
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+  virtual Expression* VisitConstant(u32 Type, u64 Value)
+  {
+    auto NewNode = MakeNode(ConstantKind, Type, Value);
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    auto NewNode = MakeNode(IdentifierKind, 0, Id);
+    NewNode.m_CpuInfoIdx = m_rDag._InternCpuInformation(pCpuInfo);
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    auto NewNode = MakeNode(MemoryKind, AccessSizeInBit);
+    NewNode.m_Operands[0] = Intern(pBaseExpr);
+    NewNode.m_Operands[1] = Intern(pOffsetExpr);
+    NewNode.m_Flags = Deref ? 1 : 0;
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot)
+  {
+    auto NewNode = MakeNode(VariableKind, SizeInBit, Slot);
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+private:
+  Expression* _Condition(Kind CondKind, u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pFirstExpr, Expression const* pSecondExpr)
+  {
+    auto NewNode = MakeNode(CondKind, Type);
+    NewNode.m_Operands[0] = Intern(pRefExpr);
+    NewNode.m_Operands[1] = Intern(pTestExpr);
+    NewNode.m_Operands[2] = Intern(pFirstExpr);
+    NewNode.m_Operands[3] = Intern(pSecondExpr);
+    m_Id = m_rDag._Insert(NewNode);
+    return nullptr;
+  }
+
+  ExpressionDag& m_rDag;
+  Id             m_Id;
+};
+
+ExpressionDag::ExpressionDag(void)
+  : m_NodeSet(0x100, NodeHasher(m_Nodes), NodeEqual(*this))
+{
+}
+
+ExpressionDag::Id ExpressionDag::Intern(Expression const* pExpr)
+{
+  Interner ExprInterner(*this);
+  return ExprInterner.Intern(pExpr);
+}
+
+void ExpressionDag::Intern(Expression::List const& rExprList, IdVector& rIds)
+{
+  Interner ExprInterner(*this);
+  for (Expression const* pExpr : rExprList)
+    rIds.push_back(ExprInterner.Intern(pExpr));
+}
+
+ExpressionDag::IdVector ExpressionDag::GetBindOperands(Id NodeId) const
+{
+  auto const& rNode = m_Nodes[NodeId];
+  if (rNode.m_Kind != BindKind)
+    return IdVector();
+  auto itBegin = std::begin(m_BindOperands) + rNode.m_Operands[0];
+  return IdVector(itBegin, itBegin + rNode.m_Operands[1]);
+}
+
+Expression* ExpressionDag::Materialize(Id NodeId) const
+{
+  if (NodeId == InvalidId)
+    return nullptr;
+
+  auto const& rNode = m_Nodes[NodeId];
+  auto CondType = static_cast<ConditionExpression::Type>(rNode.m_Type);
+
+  switch (rNode.m_Kind)
+  {
+  case BindKind:
+    {
+      Expression::List Exprs;
+      for (Id OprdId : GetBindOperands(NodeId))
+        Exprs.push_back(Materialize(OprdId));
+      return new BindExpression(Exprs);
+    }
+
+  case ConditionKind:
+    return new ConditionExpression(CondType,
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]));
+
+  case IfConditionKind:
+    return new IfConditionExpression(CondType,
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]),
+      Materialize(rNode.m_Operands[2]));
+
+  case IfElseConditionKind:
+    return new IfElseConditionExpression(CondType,
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]),
+      Materialize(rNode.m_Operands[2]), Materialize(rNode.m_Operands[3]));
+
+  case WhileConditionKind:
+    return new WhileConditionExpression(CondType,
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]),
+      Materialize(rNode.m_Operands[2]));
+
+  case OperationKind:
+    return new OperationExpression(static_cast<OperationExpression::Type>(rNode.m_Type),
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]));
+
+  case ConstantKind:
+    return new ConstantExpression(rNode.m_Type, rNode.m_Value);
+
+  case IdentifierKind:
+    return new IdentifierExpression(static_cast<u32>(rNode.m_Value), m_CpuInfos[rNode.m_CpuInfoIdx]);
+
+  case MemoryKind:
+    return new MemoryExpression(rNode.m_Type,
+      Materialize(rNode.m_Operands[0]), Materialize(rNode.m_Operands[1]), rNode.m_Flags != 0);
+
+  case VariableKind:
+    return new VariableExpression(rNode.m_Type, static_cast<u32>(rNode.m_Value));
+
+  default:
+    return nullptr;
+  }
+}
+
+size_t ExpressionDag::GetMemoryUsage(void) const
+{
+  // Node based containers are estimated with one node and one bucket for each element
+  size_t const MapNodeOverhead = 2 * sizeof(void*);
+
+  size_t Size = sizeof(*this);
+  Size += m_Nodes.capacity() * sizeof(Node);
+  Size += m_BindOperands.capacity() * sizeof(Id);
+  Size += m_CpuInfos.capacity() * sizeof(CpuInformation const*);
+  Size += m_NodeSet.bucket_count() * sizeof(void*);
+  Size += m_NodeSet.size() * (sizeof(Id) + MapNodeOverhead);
+  return Size;
+}
+
+ExpressionDag::Id ExpressionDag::_Insert(Node& rNode)
+{
+  rNode.m_Hash = HashNode(rNode, rNode.m_Operands, 4);
+
+  // The candidate is appended so the set can compare it, it's removed if it already exists
+  Id NewId = static_cast<Id>(m_Nodes.size());
+  m_Nodes.push_back(rNode);
+  auto Res = m_NodeSet.insert(NewId);
+  if (!Res.second)
+    m_Nodes.pop_back();
+  return *Res.first;
+}
+
+ExpressionDag::Id ExpressionDag::_InternBind(IdVector const& rOperands)
+{
+  auto NewNode = MakeNode(BindKind);
+  NewNode.m_Operands[0] = static_cast<Id>(m_BindOperands.size());
+  NewNode.m_Operands[1] = static_cast<Id>(rOperands.size());
+  NewNode.m_Hash = HashNode(NewNode, rOperands.data(), rOperands.size());
+
+  m_BindOperands.insert(std::end(m_BindOperands), std::begin(rOperands), std::end(rOperands));
+  Id NewId = static_cast<Id>(m_Nodes.size());
+  m_Nodes.push_back(NewNode);
+  auto Res = m_NodeSet.insert(NewId);
+  if (!Res.second)
+  {
+    m_Nodes.pop_back();
+    m_BindOperands.resize(NewNode.m_Operands[0]);
+  }
+  return *Res.first;
+}
+
+u16 ExpressionDag::_InternCpuInformation(CpuInformation const* pCpuInfo)
+{
+  // Only a few architectures are loaded, a linear search is enough
+  for (size_t CpuInfoIdx = 0; CpuInfoIdx < m_CpuInfos.size(); ++CpuInfoIdx)
+    if (m_CpuInfos[CpuInfoIdx] == pCpuInfo)
+      return static_cast<u16>(CpuInfoIdx);
+  m_CpuInfos.push_back(pCpuInfo);
+  return static_cast<u16>(m_CpuInfos.size() - 1);
+}
+
+bool ExpressionDag::NodeEqual::operator()(Id LeftId, Id RightId) const
+{
+  if (LeftId == RightId)
+    return true;
+
+  auto const& rLeft  = m_rDag.m_Nodes[LeftId];
+  auto const& rRight = m_rDag.m_Nodes[RightId];
+  if (rLeft.m_Hash       != rRight.m_Hash
+   || rLeft.m_Kind       != rRight.m_Kind
+   || rLeft.m_Type       != rRight.m_Type
+   || rLeft.m_Value      != rRight.m_Value
+   || rLeft.m_Flags      != rRight.m_Flags
+   || rLeft.m_CpuInfoIdx != rRight.m_CpuInfoIdx)
+    return false;
+
+  if (rLeft.m_Kind != BindKind)
+    return std::equal(std::begin(rLeft.m_Operands), std::end(rLeft.m_Operands), std::begin(rRight.m_Operands));
+
+  // Bind operands live in a shared array, the first operand is the start and the second the count
+  if (rLeft.m_Operands[1] != rRight.m_Operands[1])
+    return false;
+  auto itLeft  = std::begin(m_rDag.m_BindOperands) + rLeft.m_Operands[0];
+  auto itRight = std::begin(m_rDag.m_BindOperands) + rRight.m_Operands[0];
+  return std::equal(itLeft, itLeft + rLeft.m_Operands[1], itRight);
+}
@@ -0,0 +1,665 @@
+#include "medusa/expression_simplifier.hpp"
+
+#include <typeinfo>
+
+MEDUSA_NAMESPACE_USE
+
+namespace
+{
+  u64 GetMask(u32 SizeInBit)
+  {
+    if (SizeInBit == 0 || SizeInBit >= 64)
+      return ~0ULL;
+    return (1ULL << SizeInBit) - 1;
+  }
+
+  // The interpreter gives to the result of an operation the size of its left operand
+  u32 GetResultSize(Expression const* pExpr)
+  {
+    if (auto pOpExpr = dynamic_cast<OperationExpression const*>(pExpr))
+    {
+      if (pOpExpr->GetOperation() != OperationExpression::OpSext)
+        return GetResultSize(pOpExpr->GetLeftExpression());
+      auto pSizeExpr = dynamic_cast<ConstantExpression const*>(pOpExpr->GetRightExpression());
+      return pSizeExpr != nullptr ? static_cast<u32>(pSizeExpr->GetConstant() * 8) : 0;
+    }
+    if (dynamic_cast<ConditionExpression const*>(pExpr) != nullptr)
+      return ConstantExpression::Const1Bit;
+    return pExpr->GetSizeInBit();
+  }
+
+  // Values read by a condition are sign extended, the others are not
+  bool EvaluateCondition(u32 Type, u64 Ref, u64 Test, bool& rCond)
+  {
+    auto SRef = static_cast<s64>(Ref), STest = static_cast<s64>(Test);
+    switch (Type)
+    {
+    case ConditionExpression::CondEq:  rCond = Ref  == Test;  break;
+    case ConditionExpression::CondNe:  rCond = Ref  != Test;  break;
+    case ConditionExpression::CondUgt: rCond = Ref  >  Test;  break;
+    case ConditionExpression::CondUge: rCond = Ref  >= Test;  break;
+    case ConditionExpression::CondUlt: rCond = Ref  <  Test;  break;
+    case ConditionExpression::CondUle: rCond = Ref  <= Test;  break;
+    case ConditionExpression::CondSgt: rCond = SRef >  STest; break;
+    case ConditionExpression::CondSge: rCond = SRef >= STest; break;
+    case ConditionExpression::CondSlt: rCond = SRef <  STest; break;
+    case ConditionExpression::CondSle: rCond = SRef <= STest; break;
+    default: return false;
+    }
+    return true;
+  }
+
+  bool InvertCondition(u32 Type, ConditionExpression::Type& rInvType)
+  {
+    switch (Type)
+    {
+    case ConditionExpression::CondEq:  rInvType = ConditionExpression::CondNe;  break;
+    case ConditionExpression::CondNe:  rInvType = ConditionExpression::CondEq;  break;
+    case ConditionExpression::CondUgt: rInvType = ConditionExpression::CondUle; break;
+    case ConditionExpression::CondUge: rInvType = ConditionExpression::CondUlt; break;
+    case ConditionExpression::CondUlt: rInvType = ConditionExpression::CondUge; break;
+    case ConditionExpression::CondUle: rInvType = ConditionExpression::CondUgt; break;
+    case ConditionExpression::CondSgt: rInvType = ConditionExpression::CondSle; break;
+    case ConditionExpression::CondSge: rInvType = ConditionExpression::CondSlt; break;
+    case ConditionExpression::CondSlt: rInvType = ConditionExpression::CondSge; break;
+    case ConditionExpression::CondSle: rInvType = ConditionExpression::CondSgt; break;
+    default: return false;
+    }
+    return true;
+  }
+
+  //! This function computes an operation between two constants exactly like InterpreterEmulator.
+  ConstantExpression* FoldOperation(u32 Type, ConstantExpression const& rLeft, ConstantExpression const& rRight)
+  {
+    u64 Left = rLeft.GetConstant(), Right = rRight.GetConstant();
+    u64 SignedLeft = Left; // reading a constant never sign extends it
+
+    switch (Type)
+    {
+    case OperationExpression::OpAdd: Left += Right; break;
+    case OperationExpression::OpSub: Left -= Right; break;
+    case OperationExpression::OpMul: Left = static_cast<s64>(SignedLeft) * Right; break;
+    case OperationExpression::OpUDiv:
+    case OperationExpression::OpSDiv:
+      if (Right == 0)
+        return nullptr;
+      Left /= Right;
+      break;
+    case OperationExpression::OpAnd: Left &= Right; break;
+    case OperationExpression::OpOr:  Left |= Right; break;
+    case OperationExpression::OpXor: Left ^= Right; break;
+    case OperationExpression::OpLls:
+    case OperationExpression::OpLrs:
+    case OperationExpression::OpArs:
+      if (Right >= 64)
+        return nullptr;
+      if      (Type == OperationExpression::OpLls) Left <<= Right;
+      else if (Type == OperationExpression::OpLrs) Left >>= Right;
+      else                                         Left = static_cast<s64>(SignedLeft) >> Right;
+      break;
+    case OperationExpression::OpSext:
+      {
+        auto pExtExpr = new ConstantExpression(static_cast<u32>(Right * 8), SignedLeft);
+        pExtExpr->SignExtend(rLeft.GetSizeInBit());
+        return pExtExpr;
+      }
+    default:
+      return nullptr;
+    }
+
+    return new ConstantExpression(rLeft.GetSizeInBit(), Left);
+  }
+
+  //! This function tells if pRightExpr is a neutral element, pLeftExpr is the operand which is kept.
+  bool IsNeutralOperand(u32 Type, Expression const* pLeftExpr, ConstantExpression const* pRightExpr)
+  {
+    u64 Right = pRightExpr->GetConstant();
+    switch (Type)
+    {
+    case OperationExpression::OpAdd: case OperationExpression::OpSub:
+    case OperationExpression::OpOr:  case OperationExpression::OpXor:
+    case OperationExpression::OpLls: case OperationExpression::OpLrs: case OperationExpression::OpArs:
+      return Right == 0;
+
+    case OperationExpression::OpMul:
+      return Right == 1;
+
+    case OperationExpression::OpAnd:
+      {
+        // The result keeps the size of the left operand, a mask which covers it does nothing
+        u64 LeftMask = GetMask(GetResultSize(pLeftExpr));
+        return (Right & LeftMask) == LeftMask;
+      }
+
+    default:
+      return false;
+    }
+  }
+}
+
+//! UseCollector counts reads and writes of each temporary variable and tells if memory is accessed.
+class ExpressionSimplifier::UseCollector : public ExpressionVisitor
+{
+public:
+  UseCollector(void) : m_HasMemory(false) {}
+
+  u32  GetReadNumber(u32 Slot) const  { auto itUse = m_Reads.find(Slot);  return itUse != std::end(m_Reads)  ? itUse->second : 0; }
+  u32  GetWriteNumber(u32 Slot) const { auto itUse = m_Writes.find(Slot); return itUse != std::end(m_Writes) ? itUse->second : 0; }
+  bool HasMemory(void) const          { return m_HasMemory; }
+
+  void Collect(Expression const* pExpr)
+  {
+    if (pExpr != nullptr)
+      pExpr->Visit(this);
+  }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    for (Expression const* pExpr : rExprList)
+      Collect(pExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    Collect(pRefExpr);
+    Collect(pTestExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    Collect(pRefExpr);
+    Collect(pTestExpr);
+    Collect(pThenExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    Collect(pRefExpr);
+    Collect(pTestExpr);
+    Collect(pThenExpr);
+    Collect(pElseExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    Collect(pRefExpr);
+    Collect(pTestExpr);
+    Collect(pBodyExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    // An assignment doesn't read its destination, an exchange reads and writes both operands
+    bool IsAff  = Type == OperationExpression::OpAff;
+    bool IsXchg = Type == OperationExpression::OpXchg;
+    _CollectOperand(pLeftExpr,  IsAff || IsXchg, !IsAff);
+    _CollectOperand(pRightExpr, IsXchg,          true);
+    return nullptr;
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    m_HasMemory = true;
+    Collect(pBaseExpr);
+    Collect(pOffsetExpr);
+    return nullptr;
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot)
+  {
+    // Allocations are neither reads nor writes
+    if (SizeInBit == 0)
+      ++m_Reads[Slot];
+    return nullptr;
+  }
+
+private:
+  void _CollectOperand(Expression const* pExpr, bool IsWritten, bool IsRead)
+  {
+    auto pVarExpr = dynamic_cast<VariableExpression const*>(pExpr);
+    if (pVarExpr != nullptr && IsWritten)
+    {
+      ++m_Writes[pVarExpr->GetSlot()];
+      if (!IsRead)
+        return;
+    }
+    Collect(pExpr);
+  }
+
+  std::unordered_map<u32, u32> m_Reads;
+  std::unordered_map<u32, u32> m_Writes;
+  bool                         m_HasMemory;
+};
+
+//! Folder builds the simplified copy of an expression, nullptr means the statement has no effect.
+class ExpressionSimplifier::Folder : public ExpressionVisitor
+{
+public:
+  Folder(ExpressionSimplifier& rSimplifier) : m_rSimplifier(rSimplifier), m_SignedRead(false) {}
+
+  Expression* Fold(Expression const* pExpr, bool SignedRead)
+  {
+    if (pExpr == nullptr)
+      return nullptr;
+    bool PrevSignedRead = m_SignedRead;
+    m_SignedRead = SignedRead;
+    auto pFoldedExpr = pExpr->Visit(this);
+    m_SignedRead = PrevSignedRead;
+    return pFoldedExpr;
+  }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    Expression::List FoldedExprs;
+    for (Expression const* pExpr : rExprList)
+    {
+      auto pFoldedExpr = Fold(pExpr, false);
+      if (pFoldedExpr != nullptr)
+        FoldedExprs.push_back(pFoldedExpr);
+    }
+    m_rSimplifier._MergeRegisterMasks(FoldedExprs);
+    if (FoldedExprs.empty())
+      return nullptr;
+    if (FoldedExprs.size() == 1)
+      return FoldedExprs.front();
+    return new BindExpression(FoldedExprs);
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    Expression* pRef;
+    Expression* pTest;
+    bool Cond;
+    if (_FoldCondition(Type, pRefExpr, pTestExpr, pRef, pTest, Cond))
+      return new ConstantExpression(ConstantExpression::Const1Bit, Cond);
+    return new ConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest);
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    Expression* pRef;
+    Expression* pTest;
+    bool Cond;
+    if (_FoldCondition(Type, pRefExpr, pTestExpr, pRef, pTest, Cond))
+      return Cond ? Fold(pThenExpr, false) : nullptr;
+
+    auto pThen = Fold(pThenExpr, false);
+    if (pThen == nullptr)
+      return _DropCondition(Type, pRef, pTest, pThenExpr, nullptr);
+    return new IfConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest, pThen);
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    Expression* pRef;
+    Expression* pTest;
+    bool Cond;
+    if (_FoldCondition(Type, pRefExpr, pTestExpr, pRef, pTest, Cond))
+      return Fold(Cond ? pThenExpr : pElseExpr, false);
+
+    auto CondType = static_cast<ConditionExpression::Type>(Type);
+    auto pThen = Fold(pThenExpr, false);
+    auto pElse = Fold(pElseExpr, false);
+    if (pThen != nullptr && pElse != nullptr)
+      return new IfElseConditionExpression(CondType, pRef, pTest, pThen, pElse);
+    if (pThen != nullptr)
+      return new IfConditionExpression(CondType, pRef, pTest, pThen);
+    if (pElse == nullptr)
+      return _DropCondition(Type, pRef, pTest, pThenExpr, pElseExpr);
+
+    // Only the else branch does something, the condition is inverted to keep it
+    ConditionExpression::Type InvCondType;
+    if (InvertCondition(Type, InvCondType))
+      return new IfConditionExpression(InvCondType, pRef, pTest, pElse);
+    return new IfElseConditionExpression(CondType, pRef, pTest, pThenExpr->Clone(), pElse);
+  }
+
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    Expression* pRef;
+    Expression* pTest;
+    bool Cond;
+    if (_FoldCondition(Type, pRefExpr, pTestExpr, pRef, pTest, Cond))
+    {
+      if (!Cond)
+        return nullptr;
+      pRef  = Fold(pRefExpr,  true);
+      pTest = Fold(pTestExpr, true);
+    }
+
+    auto pBody = Fold(pBodyExpr, false);
+    if (pBody == nullptr)
+      pBody = pBodyExpr->Clone();
+    return new WhileConditionExpression(static_cast<ConditionExpression::Type>(Type), pRef, pTest, pBody);
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    auto OpType = static_cast<OperationExpression::Type>(Type);
+
+    if (Type == OperationExpression::OpAff || Type == OperationExpression::OpXchg)
+    {
+      auto pLeft  = _FoldDestination(pLeftExpr);
+      auto pRight = Type == OperationExpression::OpXchg ? _FoldDestination(pRightExpr) : Fold(pRightExpr, false);
+      return new OperationExpression(OpType, pLeft, pRight);
+    }
+
+    bool SignedLeft = Type == OperationExpression::OpMul || Type == OperationExpression::OpArs || Type == OperationExpression::OpSext;
+    auto pLeft  = Fold(pLeftExpr, SignedLeft);
+    auto pRight = Fold(pRightExpr, false);
+
+    auto pLeftConst  = dynamic_cast<ConstantExpression const*>(pLeft);
+    auto pRightConst = dynamic_cast<ConstantExpression const*>(pRight);
+
+    if (pLeftConst != nullptr && pRightConst != nullptr)
+    {
+      auto pResult = FoldOperation(Type, *pLeftConst, *pRightConst);
+      if (pResult != nullptr)
+      {
+        delete pLeft;
+        delete pRight;
+        return pResult;
+      }
+    }
+
+    // A memory operand triggers hooks when it's read by an operation, and a
+    // register read by a condition is sign extended: neither can replace the
+    // constant returned by the operation.
+    bool CanForward = !m_SignedRead && dynamic_cast<MemoryExpression const*>(pLeft) == nullptr;
+
+    if (CanForward && pRightConst != nullptr && IsNeutralOperand(Type, pLeft, pRightConst))
+    {
+      delete pRight;
+      return pLeft;
+    }
+
+    if ((Type == OperationExpression::OpXor || Type == OperationExpression::OpSub)
+      && _IsPure(pLeft) && m_rSimplifier._IsSameExpression(pLeft, pRight))
+    {
+      u32 Bit = GetResultSize(pLeft);
+      delete pLeft;
+      delete pRight;
+      return new ConstantExpression(Bit, 0);
+    }
+
+    return new OperationExpression(OpType, pLeft, pRight);
+  }
+
+  virtual Expression* VisitConstant(u32 Type, u64 Value)
+  {
+    return new ConstantExpression(Type, Value);
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    return new IdentifierExpression(Id, pCpuInfo);
+  }
+
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    return new MemoryExpression(AccessSizeInBit, Fold(pBaseExpr, false), Fold(pOffsetExpr, false), Deref);
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot)
+  {
+    // A variable holds a masked value without size, like a constant of unknown size
+    if (SizeInBit == 0)
+    {
+      auto itVar = m_rSimplifier.m_KnownVars.find(Slot);
+      if (itVar != std::end(m_rSimplifier.m_KnownVars))
+        return new ConstantExpression(ConstantExpression::ConstUnknownBit, itVar->second);
+    }
+    return new VariableExpression(SizeInBit, Slot);
+  }
+
+private:
+  Expression* _FoldDestination(Expression const* pExpr)
+  {
+    if (dynamic_cast<MemoryExpression const*>(pExpr) != nullptr)
+      return Fold(pExpr, false);
+    return pExpr->Clone();
+  }
+
+  bool _IsPure(Expression const* pExpr) const
+  {
+    UseCollector Uses;
+    Uses.Collect(pExpr);
+    return !Uses.HasMemory();
+  }
+
+  //! This method folds both operands, it returns true and sets rCond if the condition is known.
+  bool _FoldCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression*& rpRef, Expression*& rpTest, bool& rCond)
+  {
+    rpRef  = Fold(pRefExpr,  true);
+    rpTest = Fold(pTestExpr, true);
+
+    auto pRefConst  = dynamic_cast<ConstantExpression const*>(rpRef);
+    auto pTestConst = dynamic_cast<ConstantExpression const*>(rpTest);
+    bool IsKnown = false;
+
+    if (pRefConst != nullptr && pTestConst != nullptr)
+      IsKnown = EvaluateCondition(Type, pRefConst->GetConstant(), pTestConst->GetConstant(), rCond);
+
+    else if (_IsPure(rpRef) && m_rSimplifier._IsSameExpression(rpRef, rpTest))
+    {
+      // Both operands give the same value, only the comparison type matters
+      IsKnown = EvaluateCondition(Type, 0, 0, rCond);
+    }
+
+    if (IsKnown)
+    {
+      delete rpRef;
+      delete rpTest;
+      rpRef = rpTest = nullptr;
+    }
+    return IsKnown;
+  }
+
+  //! This method removes a condition without effect, unless reading its operands has side effects.
+  Expression* _DropCondition(u32 Type, Expression* pRef, Expression* pTest, Expression const* pFirstExpr, Expression const* pSecondExpr)
+  {
+    if (_IsPure(pRef) && _IsPure(pTest))
+    {
+      delete pRef;
+      delete pTest;
+      return nullptr;
+    }
+
+    auto CondType = static_cast<ConditionExpression::Type>(Type);
+    if (pSecondExpr == nullptr)
+      return new IfConditionExpression(CondType, pRef, pTest, pFirstExpr->Clone());
+    return new IfElseConditionExpression(CondType, pRef, pTest, pFirstExpr->Clone(), pSecondExpr->Clone());
+  }
+
+  ExpressionSimplifier& m_rSimplifier;
+  bool                  m_SignedRead;
+};
+
+ExpressionSimplifier::ExpressionSimplifier(void)
+{
+}
+
+void ExpressionSimplifier::Simplify(Expression::List& rExprList)
+{
+  // A temporary can only be replaced by its value if it's assigned once
+  UseCollector Uses;
+  for (Expression const* pExpr : rExprList)
+    Uses.Collect(pExpr);
+
+  TypeMap VarTypes;
+  Expression::List SmplExprList;
+  m_KnownVars.clear();
+
+  for (Expression* pExpr : rExprList)
+  {
+    auto pSmplExpr = Simplify(pExpr);
+    delete pExpr;
+    if (pSmplExpr == nullptr)
+      continue;
+    SmplExprList.push_back(pSmplExpr);
+
+    if (auto pVarExpr = dynamic_cast<VariableExpression const*>(pSmplExpr))
+    {
+      if (pVarExpr->GetSizeInBit() != 0)
+      {
+        VarTypes[pVarExpr->GetSlot()] = pVarExpr->GetSizeInBit();
+        m_KnownVars.erase(pVarExpr->GetSlot());
+      }
+      continue;
+    }
+
+    auto pOpExpr = dynamic_cast<OperationExpression const*>(pSmplExpr);
+    if (pOpExpr == nullptr || pOpExpr->GetOperation() != OperationExpression::OpAff)
+      continue;
+    auto pDstVarExpr = dynamic_cast<VariableExpression const*>(pOpExpr->GetLeftExpression());
+    auto pSrcConstExpr = dynamic_cast<ConstantExpression const*>(pOpExpr->GetRightExpression());
+    if (pDstVarExpr == nullptr || pSrcConstExpr == nullptr)
+      continue;
+
+    // VariableContext masks the written value with the size given at allocation
+    auto itVarType = VarTypes.find(pDstVarExpr->GetSlot());
+    if (itVarType != std::end(VarTypes) && Uses.GetWriteNumber(pDstVarExpr->GetSlot()) == 1)
+      m_KnownVars[pDstVarExpr->GetSlot()] = pSrcConstExpr->GetConstant() & GetMask(itVarType->second);
+  }
+  m_KnownVars.clear();
+
+  _RemoveDeadVariables(SmplExprList, VarTypes);
+  _MergeRegisterMasks(SmplExprList);
+  rExprList.swap(SmplExprList);
+}
+
+Expression* ExpressionSimplifier::Simplify(Expression const* pExpr)
+{
+  Folder ExprFolder(*this);
+  return ExprFolder.Fold(pExpr, false);
+}
+
+bool ExpressionSimplifier::_IsSameExpression(Expression const* pLeftExpr, Expression const* pRightExpr)
+{
+  // Cheap checks first, most operands differ by their kind
+  if (typeid(*pLeftExpr) != typeid(*pRightExpr))
+    return false;
+  return m_Dag.Intern(pLeftExpr) == m_Dag.Intern(pRightExpr);
+}
+
+void ExpressionSimplifier::_RemoveDeadVariables(Expression::List& rExprList, TypeMap const& rVarTypes)
+{
+  UseCollector Uses;
+  for (Expression const* pExpr : rExprList)
+    Uses.Collect(pExpr);
+
+  for (auto const& rVarType : rVarTypes)
+  {
+    u32 Slot = rVarType.first;
+    if (Uses.GetReadNumber(Slot) != 0)
+      continue;
+
+    // Assignments are removed only if all of them can be, otherwise the allocation is still needed
+    std::vector<Expression::List::iterator> DeadExprs;
+    u32 DeadWriteNo = 0;
+    for (auto itExpr = std::begin(rExprList); itExpr != std::end(rExprList); ++itExpr)
+    {
+      if (auto pVarExpr = dynamic_cast<VariableExpression const*>(*itExpr))
+      {
+        if (pVarExpr->GetSlot() == Slot)
+          DeadExprs.push_back(itExpr);
+        continue;
+      }
+
+      auto pOpExpr = dynamic_cast<OperationExpression const*>(*itExpr);
+      if (pOpExpr == nullptr || pOpExpr->GetOperation() != OperationExpression::OpAff)
+        continue;
+      auto pDstVarExpr = dynamic_cast<VariableExpression const*>(pOpExpr->GetLeftExpression());
+      if (pDstVarExpr == nullptr || pDstVarExpr->GetSlot() != Slot)
+        continue;
+
+      UseCollector SrcUses;
+      SrcUses.Collect(pOpExpr->GetRightExpression());
+      if (SrcUses.HasMemory())
+        continue;
+      DeadExprs.push_back(itExpr);
+      ++DeadWriteNo;
+    }
+
+    if (DeadWriteNo != Uses.GetWriteNumber(Slot))
+      continue;
+
+    for (auto itDeadExpr : DeadExprs)
+    {
+      delete *itDeadExpr;
+      rExprList.erase(itDeadExpr);
+    }
+  }
+}
+
+void ExpressionSimplifier::_MergeRegisterMasks(Expression::List& rExprList)
+{
+  // This function returns the operation assigned by a statement like reg = op
+  auto GetRegisterOperation = [](Expression const* pExpr, IdentifierExpression const*& rpRegExpr) -> OperationExpression const*
+  {
+    auto pAffExpr = dynamic_cast<OperationExpression const*>(pExpr);
+    if (pAffExpr == nullptr || pAffExpr->GetOperation() != OperationExpression::OpAff)
+      return nullptr;
+    rpRegExpr = dynamic_cast<IdentifierExpression const*>(pAffExpr->GetLeftExpression());
+    if (rpRegExpr == nullptr)
+      return nullptr;
+    return dynamic_cast<OperationExpression const*>(pAffExpr->GetRightExpression());
+  };
+
+  // This function tells if an operation is like reg & const or reg | const, or only op & const or op | const if pRegExpr is nullptr
+  auto IsMask = [](OperationExpression const* pOpExpr, IdentifierExpression const* pRegExpr) -> bool
+  {
+    if (pOpExpr->GetOperation() != OperationExpression::OpAnd && pOpExpr->GetOperation() != OperationExpression::OpOr)
+      return false;
+    if (dynamic_cast<ConstantExpression const*>(pOpExpr->GetRightExpression()) == nullptr)
+      return false;
+    if (pRegExpr == nullptr)
+      return true;
+    auto pSrcExpr = dynamic_cast<IdentifierExpression const*>(pOpExpr->GetLeftExpression());
+    return pSrcExpr != nullptr && pSrcExpr->GetId() == pRegExpr->GetId();
+  };
+
+  // Masks are bitwise, so applying the second one to the value written by
+  // the first statement gives the same register content.
+  auto itExpr = std::begin(rExprList);
+  while (itExpr != std::end(rExprList))
+  {
+    auto itNextExpr = std::next(itExpr);
+    if (itNextExpr == std::end(rExprList))
+      break;
+
+    IdentifierExpression const* pFirstReg  = nullptr;
+    IdentifierExpression const* pSecondReg = nullptr;
+    auto pFirstOp  = GetRegisterOperation(*itExpr, pFirstReg);
+    auto pSecondOp = GetRegisterOperation(*itNextExpr, pSecondReg);
+    if (pFirstOp == nullptr || pSecondOp == nullptr || pFirstReg->GetId() != pSecondReg->GetId() || !IsMask(pSecondOp, pSecondReg))
+    {
+      ++itExpr;
+      continue;
+    }
+
+    auto pSecondConst = static_cast<ConstantExpression const*>(pSecondOp->GetRightExpression());
+    auto SecondOpType = static_cast<OperationExpression::Type>(pSecondOp->GetOperation());
+
+    // Masks of the same kind are combined, otherwise the second one is applied to the result of the first one
+    Expression* pMergedOp = nullptr;
+    if (IsMask(pFirstOp, nullptr) && pFirstOp->GetOperation() == pSecondOp->GetOperation())
+    {
+      auto pFirstConst = static_cast<ConstantExpression const*>(pFirstOp->GetRightExpression());
+      pMergedOp = new OperationExpression(SecondOpType, pFirstOp->GetLeftExpression()->Clone(), FoldOperation(SecondOpType, *pFirstConst, *pSecondConst));
+    }
+    else
+      pMergedOp = new OperationExpression(SecondOpType, pFirstOp->Clone(), pSecondConst->Clone());
+
+    auto pMergedExpr = new OperationExpression(OperationExpression::OpAff, pFirstReg->Clone(), pMergedOp);
+    delete *itExpr;
+    delete *itNextExpr;
+    rExprList.erase(itNextExpr);
+    *itExpr = pMergedExpr;
+  }
+}
@@ -1,4 +1,9 @@
 #include "medusa/instruction.hpp"
+#include "medusa/architecture.hpp"
+#include "medusa/expression_simplifier.hpp"
+#include "medusa/mutex.hpp"
+
+#include <boost/thread/mutex.hpp>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -9,12 +14,37 @@ Instruction::~Instruction(void)
   m_Expressions.clear();
 }
 
+void Instruction::Reset(void)
+{
+  if (!m_Expressions.empty())
+  {
+    for (Expression* pExpr : m_Expressions)
+      delete pExpr;
+    m_Expressions.clear();
+  }
+  m_pSemArch.store(nullptr, std::memory_order_relaxed);
+  m_SemId = 0;
+
+  *m_spDna       = CellData(Cell::InstructionType, NoneType);
+  m_pName        = nullptr;
+  m_Opcd         = I_NONE;
+  m_Prefix       = 0;
+  m_TestedFlags  = 0;
+  m_UpdatedFlags = 0;
+  m_ClearedFlags = 0;
+  m_FixedFlags   = 0;
+
+  for (auto& rOprd : m_Oprd)
+    rOprd.Reset();
+}
+
 void Instruction::SetSemantic(Expression::List const& rExprList)
 {
   for (Expression* pExpr : m_Expressions)
     delete pExpr;
   m_Expressions.clear();
   m_Expressions = rExprList;
+  m_pSemArch.store(nullptr, std::memory_order_release);
 }
 
 void Instruction::SetSemantic(Expression* pExpr)
@@ -23,18 +53,51 @@ void Instruction::SetSemantic(Expression* pExpr)
     delete pExpr;
   m_Expressions.clear();
   m_Expressions.push_back(pExpr);
+  m_pSemArch.store(nullptr, std::memory_order_release);
 }
 
 void Instruction::AddPreSemantic(Expression* pExpr)
 {
+  GetSemantic();
   m_Expressions.push_front(pExpr);
 }
 
 void Instruction::AddPostSemantic(Expression* pExpr)
 {
+  GetSemantic();
   m_Expressions.push_back(pExpr);
 }
 
+void Instruction::SetSemanticBuilder(Architecture* pArch, u32 SemanticId)
+{
+  for (Expression* pExpr : m_Expressions)
+    delete pExpr;
+  m_Expressions.clear();
+  m_SemId = SemanticId;
+  m_pSemArch.store(pArch, std::memory_order_release);
+}
+
+void Instruction::SimplifySemantic(void)
+{
+  ExpressionSimplifier Simplifier;
+  Simplifier.Simplify(m_Expressions);
+}
+
+void Instruction::_BuildSemantic(void) const
+{
+  // Cells are shared between analyzer workers, only one of them builds the semantic
+  typedef ProfiledMutex<boost::mutex> MutexType;
+  static MutexType s_Mutex("instruction.semantic");
+  MutexType::scoped_lock Lock(s_Mutex);
+
+  auto pArch = m_pSemArch.load(std::memory_order_relaxed);
+  if (pArch == nullptr)
+    return;
+
+  pArch->BuildSemantic(const_cast<Instruction&>(*this), m_SemId);
+  m_pSemArch.store(nullptr, std::memory_order_release);
+}
+
 u8 Instruction::GetOperandOffset(u8 Oprd) const
 {
   if (Oprd < OPERAND_NO)
@@ -1,7 +1,6 @@
 #include "medusa/label.hpp"
 #include <algorithm>
 #include <sstream>
-#include <boost/format.hpp>
 
 MEDUSA_NAMESPACE_BEGIN
 
@@ -33,6 +32,14 @@ Label::Label(std::string const& rName, u16 Type, u32 Version)
   , m_Type(Type)
   , m_Version(Version)
 {
+  // Unknown labels are returned for every address without label, they all share the same name
+  if (rName.empty())
+  {
+    static std::shared_ptr<char> const s_spEmptyName(new char[1](), [](char *pName) { delete [] pName; });
+    m_spName = s_spEmptyName;
+    return;
+  }
+
   m_spName.reset(new char[m_NameLength], [](char *pName) { delete [] pName; });
   memcpy(m_spName.get(), rName.c_str(), m_NameLength);
 }
@@ -76,11 +83,18 @@ std::string Label::Dump(void) const
 }
 
 std::string Label::GetLabel(void) const
+{
+  std::string Result;
+  AppendLabel(Result);
+  return Result;
+}
+
+void Label::AppendLabel(std::string& rLabel) const
 {
   if (m_NameLength == 0x0)
-    return "";
+    return;
 
-  std::string Result;
+  size_t LabelBeg = rLabel.length();
 
   if ((m_Type & CellMask) == String)
   {
@@ -100,7 +114,7 @@ std::string Label::GetLabel(void) const
         Maj = false;
         CurChr = toupper(CurChr);
       }
-      Result += CurChr;
+      rLabel += CurChr;
 
       if (!--Limit)
         break;
@@ -112,16 +126,25 @@ std::string Label::GetLabel(void) const
       char CurChr = ConvertToLabel(*pRawName);
       if (CurChr == '\0')
         continue;
-      Result += CurChr;
+      rLabel += CurChr;
     }
 
-  if (Result.empty())
-    Result = "uname";
+  if (rLabel.length() == LabelBeg)
+    rLabel += "uname";
 
   if (m_Version == 0)
-    return Result;
+    return;
 
-  return (boost::format("%s.%d") % Result % m_Version).str();
+  char VerBuf[11];
+  char* pVer = VerBuf + sizeof(VerBuf);
+  u32 Ver = m_Version;
+  do
+  {
+    *--pVer = '0' + Ver % 10;
+    Ver /= 10;
+  } while (Ver != 0);
+  rLabel += '.';
+  rLabel.append(pVer, VerBuf + sizeof(VerBuf));
 }
 
 void Label::IncrementVersion(void)
@@ -1,40 +1,251 @@
 #include "medusa/log.hpp"
 
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <memory>
+
+#include <boost/thread/tss.hpp>
+
 MEDUSA_NAMESPACE_BEGIN
 
-LogWrapper::MutexType      LogWrapper::m_Mutex;
-Log::LogMap                Log::m_LogMap;
-LogWrapper::LoggerCallback Log::m_pLog;
+namespace
+{
+  // Single producer (the owner thread), single consumer (the sink thread)
+  class LogRing
+  {
+  public:
+    typedef std::shared_ptr<LogRing> SPtr;
+
+    LogRing(void) : m_Head(0), m_Tail(0), m_Messages(Size) {}
+
+    bool Push(std::string& rMsg)
+    {
+      u64 Head = m_Head.load(std::memory_order_relaxed);
+      if (Head - m_Tail.load(std::memory_order_acquire) == Size)
+        return false;
+      m_Messages[Head & (Size - 1)].swap(rMsg);
+      m_Head.store(Head + 1, std::memory_order_release);
+      return true;
+    }
+
+    // The slot is released once the message is delivered, so Flush can rely on m_Tail
+    bool Front(std::string*& rpMsg)
+    {
+      u64 Tail = m_Tail.load(std::memory_order_relaxed);
+      if (Tail == m_Head.load(std::memory_order_acquire))
+        return false;
+      rpMsg = &m_Messages[Tail & (Size - 1)];
+      return true;
+    }
+
+    void Pop(void)                 { m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+    bool IsEmpty(void) const       { return m_Tail.load(std::memory_order_acquire) == m_Head.load(std::memory_order_acquire); }
+    u64  GetHead(void) const       { return m_Head.load(std::memory_order_acquire); }
+    u64  GetTail(void) const       { return m_Tail.load(std::memory_order_acquire); }
+
+  private:
+    enum { Size = 0x1000 };
+
+    std::atomic<u64>         m_Head;
+    std::atomic<u64>         m_Tail;
+    std::vector<std::string> m_Messages;
+  };
+
+  // Pending messages are built per thread, so no lock is needed until LogEnd
+  struct LogThreadState
+  {
+    std::map<std::string, std::string> m_Buffers;
+    LogRing::SPtr                      m_spRing;
+  };
+
+  class LogSink
+  {
+  public:
+    LogSink(void) : m_Stop(false), m_Dropped(0) {}
+    ~LogSink(void)
+    {
+      {
+        std::lock_guard<std::mutex> Lock(m_RingsMutex);
+        if (!m_Thread.joinable())
+          return;
+        m_Stop = true;
+      }
+      m_WakeUp.notify_one();
+      m_Thread.join();
+    }
+
+    void SetLog(Log::LoggerCallback pLog)
+    {
+      std::lock_guard<std::mutex> Lock(m_LogMutex);
+      m_pLog = pLog;
+    }
+
+    LogRing::SPtr AddRing(void)
+    {
+      auto spRing = std::make_shared<LogRing>();
+      std::lock_guard<std::mutex> Lock(m_RingsMutex);
+      m_Rings.push_back(spRing);
+      if (!m_Thread.joinable())
+        m_Thread = std::thread(&LogSink::_Run, this);
+      return spRing;
+    }
+
+    void Push(LogRing& rRing, std::string& rMsg)
+    {
+      bool WasEmpty = rRing.IsEmpty();
+      if (!rRing.Push(rMsg))
+      {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+
+      // The sink also polls, so a missed notification only delays the message
+      if (WasEmpty)
+        m_WakeUp.notify_one();
+    }
+
+    void Flush(void)
+    {
+      std::vector<std::pair<LogRing::SPtr, u64>> Targets;
+      {
+        std::lock_guard<std::mutex> Lock(m_RingsMutex);
+        if (!m_Thread.joinable() || m_Thread.get_id() == std::this_thread::get_id())
+          return;
+        for (auto const& rspRing : m_Rings)
+          Targets.push_back(std::make_pair(rspRing, rspRing->GetHead()));
+      }
+
+      m_WakeUp.notify_one();
+      for (auto const& rTarget : Targets)
+        while (rTarget.first->GetTail() < rTarget.second)
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    u64 GetNumberOfDroppedMessages(void) const { return m_Dropped.load(std::memory_order_relaxed); }
+
+  private:
+    void _Run(void)
+    {
+      u64 ReportedDropped = 0;
+
+      for (;;)
+      {
+        std::vector<LogRing::SPtr> Rings;
+        bool Stop;
+        {
+          std::unique_lock<std::mutex> Lock(m_RingsMutex);
+          Stop = m_Stop;
+
+          // Rings of finished threads are only owned by the sink, remove them once drained
+          m_Rings.erase(std::remove_if(std::begin(m_Rings), std::end(m_Rings), [](LogRing::SPtr const& rspRing)
+          { return rspRing.use_count() == 1 && rspRing->IsEmpty(); }), std::end(m_Rings));
+          Rings = m_Rings;
+        }
+
+        bool Delivered = false;
+        {
+          std::lock_guard<std::mutex> Lock(m_LogMutex);
+          for (auto const& rspRing : Rings)
+          {
+            std::string* pMsg;
+            while (rspRing->Front(pMsg))
+            {
+              if (m_pLog)
+                m_pLog(*pMsg);
+              rspRing->Pop();
+              Delivered = true;
+            }
+          }
+
+          u64 Dropped = m_Dropped.load(std::memory_order_relaxed);
+          if (Dropped != ReportedDropped && m_pLog)
+          {
+            std::ostringstream oss;
+            oss << "log: " << std::dec << Dropped - ReportedDropped << " message(s) dropped\n";
+            m_pLog(oss.str());
+            ReportedDropped = Dropped;
+          }
+        }
+
+        if (Stop)
+          break;
+
+        if (!Delivered)
+        {
+          std::unique_lock<std::mutex> Lock(m_RingsMutex);
+          if (!m_Stop)
+            m_WakeUp.wait_for(Lock, std::chrono::milliseconds(10));
+        }
+      }
+    }
+
+    std::mutex                 m_LogMutex;
+    Log::LoggerCallback        m_pLog;
+
+    std::mutex                 m_RingsMutex;
+    std::condition_variable    m_WakeUp;
+    std::vector<LogRing::SPtr> m_Rings;
+    std::thread                m_Thread;
+    bool                       m_Stop;
+
+    std::atomic<u64>           m_Dropped;
+  };
+
+  // The sink is destroyed after the thread states, it delivers the remaining messages
+  LogSink                                  s_LogSink;
+  boost::thread_specific_ptr<LogThreadState> s_LogThreadState;
+
+  LogThreadState& GetLogThreadState(void)
+  {
+    auto pState = s_LogThreadState.get();
+    if (pState == nullptr)
+    {
+      pState = new LogThreadState;
+      pState->m_spRing = s_LogSink.AddRing();
+      s_LogThreadState.reset(pState);
+    }
+    return *pState;
+  }
+}
+
+std::atomic<Log::Level> Log::m_Level(Log::Info);
 
 template<> LogWrapper& LogWrapper::operator<<(s16 Value)
 {
-  std::ostringstream oss;
-
-  oss << std::hex << std::internal << std::showbase << std::setfill('0') << std::setw(sizeof(Value) * 2 + 2) << static_cast<s32>(Value);
-  m_rBuffer += oss.str();
+  if (m_Enabled)
+    _AppendHex(static_cast<u32>(static_cast<s32>(Value)), sizeof(Value) * 2);
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(u16 Value)
 {
-  std::ostringstream oss;
+  if (m_Enabled)
+    _AppendHex(Value, sizeof(Value) * 2);
+  return *this;
+}
 
-  oss << std::hex << std::internal << std::showbase << std::setfill('0') << std::setw(sizeof(Value) * 2 + 2) << static_cast<u32>(Value);
-  m_rBuffer += oss.str();
+template<> LogWrapper& LogWrapper::operator<<(char const* pMsg)
+{
+  if (m_Enabled)
+    m_rBuffer += pMsg;
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(Address Addr)
 {
-  boost::recursive_mutex::scoped_lock(m_Mutex);
-  m_rBuffer += Addr.ToString();
+  if (m_Enabled)
+    m_rBuffer += Addr.ToString();
   return *this;
 }
 
 template<> LogWrapper& LogWrapper::operator<<(std::string Msg)
 {
-  boost::recursive_mutex::scoped_lock(m_Mutex);
-  m_rBuffer += Msg;
+  if (m_Enabled)
+    m_rBuffer += Msg;
   return *this;
 }
 
@@ -43,6 +254,40 @@ template<> LogWrapper& LogWrapper::operator<<(LogWrapper::LoggerFunction pFunc)
   return pFunc(*this);
 }
 
+LogWrapper& LogWrapper::Flush(void)
+{
+  if (!m_Enabled)
+    return *this;
+
+  s_LogSink.Push(*GetLogThreadState().m_spRing, m_rBuffer);
+  m_rBuffer = m_Name;
+  m_rBuffer += ": ";
+  return *this;
+}
+
+// Same output as std::hex with std::showbase and a zero fill, without a stream
+void LogWrapper::_AppendHex(u64 Value, u8 DigitNo)
+{
+  static char const s_HexDigits[] = "0123456789abcdef";
+
+  if (Value == 0)
+  {
+    m_rBuffer.append(DigitNo + 2, '0');
+    return;
+  }
+
+  char Digits[16];
+  u8 Len = 0;
+  for (; Value != 0; Value >>= 4)
+    Digits[Len++] = s_HexDigits[Value & 0xf];
+
+  m_rBuffer += "0x";
+  if (Len < DigitNo)
+    m_rBuffer.append(DigitNo - Len, '0');
+  while (Len != 0)
+    m_rBuffer += Digits[--Len];
+}
+
 LogWrapper& LogFlush(LogWrapper &rLogWrapper)
 {
   rLogWrapper.Flush();
@@ -51,16 +296,34 @@ LogWrapper& LogFlush(LogWrapper &rLogWrapper)
 
 LogWrapper& LogEnd(LogWrapper &rLogWrapper)
 {
-  rLogWrapper.Lock();
   rLogWrapper.Write("\n");
   LogFlush(rLogWrapper);
-  rLogWrapper.Unlock();
   return rLogWrapper;
 }
 
-LogWrapper Log::Write(std::string const& rType)
+void Log::SetLog(LoggerCallback pLog)
+{
+  s_LogSink.SetLog(pLog);
+}
+
+LogWrapper Log::Write(std::string const& rType, Level Lvl)
+{
+  if (!IsEnabled(Lvl))
+  {
+    static std::string s_Discarded;
+    return LogWrapper(rType, s_Discarded, false);
+  }
+  return LogWrapper(rType, GetLogThreadState().m_Buffers[rType], true);
+}
+
+void Log::Flush(void)
+{
+  s_LogSink.Flush();
+}
+
+u64 Log::GetNumberOfDroppedMessages(void)
 {
-  return LogWrapper(Log::m_pLog, rType, Log::m_LogMap[rType]);
+  return s_LogSink.GetNumberOfDroppedMessages();
 }
 
-MEDUSA_NAMESPACE_END
\ No newline at end of file
+MEDUSA_NAMESPACE_END
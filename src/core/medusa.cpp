@@ -9,12 +9,15 @@
 #include <list>
 #include <algorithm>
 
+#include <boost/format.hpp>
+
 MEDUSA_NAMESPACE_BEGIN
 
 Medusa::Medusa(void)
   : m_TaskManager([] (Task const* pTask) { Log::Write("core") << "Task \"" << pTask->GetName() << "\" is done" << LogEnd; })
   , m_Document()
   , m_Analyzer()
+  , m_Mutex("medusa")
 {
   m_TaskManager.Start();
   Log::Write("core") << GetVersion() << LogEnd;
@@ -65,8 +68,8 @@ bool Medusa::Start(
 
   for (auto itArch = std::begin(spArchitectures), itEnd = std::end(spArchitectures); itArch != itEnd; ++itArch)
   {
-    if (!ModuleManager::Instance().RegisterArchitecture(*itArch))
-      Log::Write("core") << "unable to register architecture " << (*itArch)->GetName() << " to module manager" << LogEnd;
+    if (!m_Document.RegisterArchitecture(*itArch))
+      Log::Write("core") << "unable to register architecture " << (*itArch)->GetName() << " to document" << LogEnd;
     if (!spDatabase->RegisterArchitectureTag((*itArch)->GetTag()))
       Log::Write("core") << "unable to register architecture " << (*itArch)->GetName() << " to database" << LogEnd;
   }
@@ -115,10 +118,9 @@ bool Medusa::NewDocument(
     BinaryStream::SharedPtr spFileBinStrm = std::make_shared<FileBinaryStream>(rFilePath.wstring());
     Log::Write("core") << "opening \"" << rFilePath.string() << "\"" << LogEnd;
     auto& rModMgr = ModuleManager::Instance();
-    rModMgr.UnloadModules(); // Make sure we don't have loaded modules in memory
-    rModMgr.LoadModules(L".", *spFileBinStrm); // TODO: Let the user select the folder
+    rModMgr.LoadModules(L"."); // TODO: Let the user select the folder
 
-    auto const& AllLdrs = rModMgr.GetLoaders();
+    auto const& AllLdrs = rModMgr.GetLoaders(*spFileBinStrm);
     if (AllLdrs.empty())
     {
       Log::Write("core") << "there is not supported loader" << LogEnd;
@@ -191,8 +193,7 @@ bool Medusa::OpenDocument(AskDatabaseFunctionType AskDatabase)
   auto& rModMgr = ModuleManager::Instance();
   try
   {
-    rModMgr.UnloadModules();
-    rModMgr.LoadDatabases(".");
+    rModMgr.LoadModules(L".");
 
     auto const& AllDbs = rModMgr.GetDatabases();
     std::list<Filter> ExtList;
@@ -223,9 +224,6 @@ bool Medusa::OpenDocument(AskDatabaseFunctionType AskDatabase)
       return false;
     }
 
-    rModMgr.UnloadModules();
-    rModMgr.LoadModules(L".", *spDb->GetBinaryStream());
-
     Log::Write("core") << "opening database \"" << DbPath.string() << "\"" << LogEnd;
 
     m_Document.Use(spDb);
@@ -238,7 +236,7 @@ bool Medusa::OpenDocument(AskDatabaseFunctionType AskDatabase)
       {
         if (MEDUSA_CMP_TAG((*itArch)->GetTag(), (*itArchTag)))
         {
-          rModMgr.RegisterArchitecture(*itArch);
+          m_Document.RegisterArchitecture(*itArch);
           break;
         }
       }
@@ -280,7 +278,7 @@ void Medusa::Analyze(Address const& rAddr, Architecture::SharedPtr spArch, u8 Mo
         return;
     }
 
-    spArch = ModuleManager::Instance().GetArchitecture(spCell->GetArchitectureTag());
+    spArch = m_Document.GetArchitecture(spCell->GetArchitectureTag());
     if (spArch == nullptr)
       return;
   }
@@ -306,6 +304,14 @@ Cell::SPtr const Medusa::GetCell(Address const& rAddr) const
   return m_Document.GetCell(rAddr);
 }
 
+bool Medusa::FormatCell(
+  Address       const& rAddress,
+  Cell          const& rCell,
+  CellText           & rText) const
+{
+  return m_Analyzer.FormatCell(m_Document, m_Document.GetBinaryStream(), rAddress, rCell, rText);
+}
+
 bool Medusa::FormatCell(
   Address       const& rAddress,
   Cell          const& rCell,
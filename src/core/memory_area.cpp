@@ -75,7 +75,7 @@ CellData::SPtr MappedMemoryArea::GetCellData(TOffset Offset) const
 
   size_t CellOff = static_cast<size_t>(Offset - m_VirtualBase.GetOffset());
   if (CellOff >= m_Cells.size())
-    return std::make_shared<CellData>(Cell::ValueType, Value::HexadecimalType, 1);
+    return MakePooled<CellData>(Cell::ValueType, Value::HexadecimalType, 1);
 
   auto spCellData = m_Cells[CellOff];
   if (spCellData == nullptr)
@@ -87,7 +87,7 @@ CellData::SPtr MappedMemoryArea::GetCellData(TOffset Offset) const
       if (CellOff < PrevOff + sprPrevCellData->GetLength())
         return CellData::SPtr();
     }
-    return std::make_shared<CellData>(Cell::ValueType, Value::HexadecimalType, 1);
+    return MakePooled<CellData>(Cell::ValueType, Value::HexadecimalType, 1);
   }
 
   return spCellData;
@@ -124,7 +124,7 @@ void MappedMemoryArea::ForEachCellData(CellDataPredicat Predicat) const
 {
   auto itCellDataEnd = std::end(m_Cells);
   TOffset CurOff = 0x0;
-  std::for_each(std::begin(m_Cells), std::end(m_Cells), [&CurOff, &Predicat](CellData::SPtr spCellData)
+  std::for_each(std::begin(m_Cells), std::end(m_Cells), [&CurOff, &Predicat](CellData::SPtr const& spCellData)
   {
     if (spCellData)
       Predicat(CurOff, spCellData);
@@ -385,7 +385,7 @@ CellData::SPtr VirtualMemoryArea::GetCellData(TOffset Offset) const
 {
   if (IsCellPresent(Offset) == false)
     return nullptr;
-  return std::make_shared<CellData>(Cell::ValueType, Value::HexadecimalType, 1, MEDUSA_ARCH_UNK);
+  return MakePooled<CellData>(Cell::ValueType, Value::HexadecimalType, 1, MEDUSA_ARCH_UNK);
 }
 
 bool VirtualMemoryArea::SetCellData(TOffset Offset, CellData::SPtr spCell, Address::List& rDeletedCellAddresses, bool Force)
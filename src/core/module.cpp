@@ -7,94 +7,19 @@
 
 MEDUSA_NAMESPACE_BEGIN
 
-void ModuleManager::LoadDatabases(boost::filesystem::path const& rModPath)
+void ModuleManager::LoadModules(boost::filesystem::path const& rModPath)
 {
-  try
-  {
-    const boost::filesystem::path CurDir = rModPath;
-    Module Module;
-
-    Log::Write("core") << "Module directory: " << boost::filesystem::system_complete(CurDir) << LogEnd;
-
-    boost::filesystem::directory_iterator End;
-    for (boost::filesystem::directory_iterator It(CurDir);
-      It != End; ++It)
-    {
-      auto const& rFilename = It->path().string();
-
-      if (rFilename.substr(rFilename.find_last_of(".") + 1) != Module::GetExtension())
-        continue;
-
-      auto FullPath = boost::filesystem::system_complete(*It);
-      Log::Write("core") << "Module: \"" << rFilename << "\" ";
-
-      void* pMod = Module.Load(FullPath);
-      if (pMod == nullptr)
-      {
-        Log::Write("core") << "can't be loaded" << LogEnd;
-        continue;
-      }
-
-      TGetArchitecture pGetArchitecture = Module.Load<TGetArchitecture>(pMod, "GetArchitecture");
-      if (pGetArchitecture != nullptr)
-      {
-        Log::Write("core") << "is an architecture" << LogEnd;
-
-        Architecture* pArchitecture = pGetArchitecture();
-        Architecture::SharedPtr ArchitecturePtr(pArchitecture);
-        m_Architectures.push_back(ArchitecturePtr);
-        continue;
-      }
-
-      TGetOperatingSystem pGetOperatingSystem = Module.Load<TGetOperatingSystem>(pMod, "GetOperatingSystem");
-      if (pGetOperatingSystem != nullptr)
-      {
-        Log::Write("core") << "is an operating system" << LogEnd;
+  MutexType::scoped_lock Lock(m_Mutex);
 
-        OperatingSystem* pOperatingSystem = pGetOperatingSystem();
-        OperatingSystem::SharedPtr spOperatingSystem(pOperatingSystem);
-        m_OperatingSystems.push_back(spOperatingSystem);
-        continue;
-      }
-
-      TGetEmulator pGetEmulator = Module.Load<TGetEmulator>(pMod, "GetEmulator");
-      if (pGetEmulator != nullptr)
-      {
-        Log::Write("core") << "is an emulator" << LogEnd;
-
-        Emulator* pEmulator = pGetEmulator(nullptr, nullptr, nullptr);
-        m_Emulators[pEmulator->GetName()] = pGetEmulator;
-        delete pEmulator;
-        continue;
-      }
-
-      TGetDabatase pGetDatabase = Module.Load<TGetDabatase>(pMod, "GetDatabase");
-      if (pGetDatabase != nullptr)
-      {
-        Log::Write("core") << "is a database" << LogEnd;
-
-        Database* pDatabase = pGetDatabase();
-        Database::SharedPtr spDatabase(pDatabase);
-        m_Databases.push_back(spDatabase);
-        continue;
-      }
-
-      Log::Write("core") << "is unknown (ignored)" << LogEnd;
-    }
-  }
-  catch (std::exception &e)
-  {
-    Log::Write("core") << e.what() << LogEnd;
-  }
-}
-
-void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryStream const& rBinStrm)
-{
   try
   {
     const boost::filesystem::path CurDir = rModPath;
     Module Module;
 
+    // Modules are shared, loading the same directory twice would register them twice
+    if (!m_LoadedPaths.insert(boost::filesystem::system_complete(CurDir).string()).second)
+      return;
+
     Log::Write("core") << "Module directory: " << boost::filesystem::system_complete(CurDir) << LogEnd;
 
     boost::filesystem::directory_iterator End;
@@ -119,20 +44,8 @@ void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryS
       TGetLoader pGetLoader = Module.Load<TGetLoader>(pMod, "GetLoader");
       if (pGetLoader != nullptr)
       {
-        Log::Write("core") << "is a loader ";
-
-        Loader* pLoader = pGetLoader();
-        if (pLoader->IsCompatible(rBinStrm))
-        {
-          Loader::SharedPtr LoaderPtr(pLoader);
-          m_Loaders.push_back(LoaderPtr);
-          Log::Write("core") << "(loaded)" << LogEnd;
-        }
-        else
-        {
-          Log::Write("core") << "(unloaded)" << LogEnd;
-          delete pLoader;
-        }
+        Log::Write("core") << "is a loader" << LogEnd;
+        m_Loaders.push_back(pGetLoader);
         continue;
       }
 
@@ -140,10 +53,7 @@ void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryS
       if (pGetArchitecture != nullptr)
       {
         Log::Write("core") << "is an architecture" << LogEnd;
-
-        Architecture* pArchitecture = pGetArchitecture();
-        Architecture::SharedPtr ArchitecturePtr(pArchitecture);
-        m_Architectures.push_back(ArchitecturePtr);
+        m_Architectures.push_back(pGetArchitecture);
         continue;
       }
 
@@ -151,10 +61,7 @@ void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryS
       if (pGetOperatingSystem != nullptr)
       {
         Log::Write("core") << "is an operating system" << LogEnd;
-
-        OperatingSystem* pOperatingSystem = pGetOperatingSystem();
-        OperatingSystem::SharedPtr spOperatingSystem(pOperatingSystem);
-        m_OperatingSystems.push_back(spOperatingSystem);
+        m_OperatingSystems.push_back(pGetOperatingSystem);
         continue;
       }
 
@@ -173,10 +80,7 @@ void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryS
       if (pGetDatabase != nullptr)
       {
         Log::Write("core") << "is a database" << LogEnd;
-
-        Database* pDatabase = pGetDatabase();
-        Database::SharedPtr spDatabase(pDatabase);
-        m_Databases.push_back(spDatabase);
+        m_Databases.push_back(pGetDatabase);
         continue;
       }
 
@@ -187,17 +91,13 @@ void ModuleManager::LoadModules(boost::filesystem::path const& rModPath, BinaryS
   {
     Log::Write("core") << e.what() << LogEnd;
   }
-
-  if (!m_Loaders.empty())
-    std::sort(std::begin(m_Loaders), std::end(m_Loaders), [](Loader::SharedPtr spLdr0, Loader::SharedPtr spLdr1)
-        {
-          return spLdr0->GetDepth() > spLdr1->GetDepth();
-        });
 }
 
 void ModuleManager::UnloadModules(void)
 {
-  m_DefaultArchitectureTag = MEDUSA_ARCH_UNK;
+  MutexType::scoped_lock Lock(m_Mutex);
+
+  m_LoadedPaths.clear();
   m_Loaders.clear();
   m_Architectures.clear();
   m_Databases.clear();
@@ -205,16 +105,14 @@ void ModuleManager::UnloadModules(void)
   m_Emulators.clear();
 }
 
-Architecture::SharedPtr ModuleManager::GetArchitecture(Tag ArchTag) const
+Architecture::VectorSharedPtr ModuleManager::GetArchitectures(void) const
 {
-  if (ArchTag == MEDUSA_ARCH_UNK)
-    ArchTag = m_DefaultArchitectureTag;
-
-  auto itArch = m_TaggedArchitectures.find(ArchTag);
-  if (itArch == std::end(m_TaggedArchitectures))
-    return Architecture::SharedPtr();
+  MutexType::scoped_lock Lock(m_Mutex);
 
-  return itArch->second;
+  Architecture::VectorSharedPtr Archs;
+  for (auto pGetArchitecture : m_Architectures)
+    Archs.push_back(Architecture::SharedPtr(pGetArchitecture()));
+  return Archs;
 }
 
 Architecture::SharedPtr ModuleManager::FindArchitecture(Tag ArchTag) const
@@ -229,45 +127,10 @@ Architecture::SharedPtr ModuleManager::FindArchitecture(Tag ArchTag) const
   return nullptr;
 }
 
-bool ModuleManager::RegisterArchitecture(Architecture::SharedPtr spArch)
+TGetEmulator ModuleManager::GetEmulator(std::string const& rEmulatorName) const
 {
-  u8 Id = 0;
-  bool FoundId = false;
-
-  for (u8 i = 0; i < 32; ++i)
-    if (!(m_ArchIdPool & (1 << i)))
-    {
-      m_ArchIdPool |= (1 << i);
-      Id = i;
-      FoundId = true;
-      break;
-    }
+  MutexType::scoped_lock Lock(m_Mutex);
 
-    if (FoundId == false)
-      return false;
-
-    spArch->UpdateId(Id);
-
-    m_TaggedArchitectures[spArch->GetTag()] = spArch;
-
-    if (m_DefaultArchitectureTag == MEDUSA_ARCH_UNK)
-      m_DefaultArchitectureTag = spArch->GetTag();
-
-    return true;
-}
-
-bool ModuleManager::UnregisterArchitecture(Architecture::SharedPtr spArch)
-{
-  return false; /* Not implemented */
-}
-
-void ModuleManager::ResetArchitecture(void)
-{
-  m_Architectures.clear();
-}
-
-TGetEmulator ModuleManager::GetEmulator(std::string const& rEmulatorName)
-{
   auto itEmulator = m_Emulators.find(rEmulatorName);
   if (itEmulator == std::end(m_Emulators))
     return nullptr;
@@ -276,16 +139,21 @@ TGetEmulator ModuleManager::GetEmulator(std::string const& rEmulatorName)
 
 OperatingSystem::SharedPtr ModuleManager::GetOperatingSystem(Loader::SharedPtr spLdr, Architecture::SharedPtr spArch) const
 {
-  OperatingSystem::VectorSharedPtr CompatOs;
-  for (auto itOs = std::begin(m_OperatingSystems); itOs != std::end(m_OperatingSystems); ++itOs)
-    if ((*itOs)->IsSupported(*spLdr, *spArch) == true)
-      return *itOs;
+  MutexType::scoped_lock Lock(m_Mutex);
+
+  for (auto pGetOperatingSystem : m_OperatingSystems)
+  {
+    OperatingSystem::SharedPtr spOs(pGetOperatingSystem());
+    if (spOs->IsSupported(*spLdr, *spArch) == true)
+      return spOs;
+  }
   return OperatingSystem::SharedPtr();
 }
 
-Database::SharedPtr ModuleManager::GetDatabase(std::string const& rDatabaseName)
+Database::SharedPtr ModuleManager::GetDatabase(std::string const& rDatabaseName) const
 {
-  for (auto itDb = std::begin(m_Databases); itDb != std::end(m_Databases); ++itDb)
+  auto const& rAllDbs = GetDatabases();
+  for (auto itDb = std::begin(rAllDbs); itDb != std::end(rAllDbs); ++itDb)
     if ((*itDb)->GetName() == rDatabaseName)
       return *itDb;
   return Database::SharedPtr();
@@ -293,17 +161,32 @@ Database::SharedPtr ModuleManager::GetDatabase(std::string const& rDatabaseName)
 
 Database::VectorSharedPtr ModuleManager::GetDatabases(void) const
 {
-  return m_Databases;
-}
+  MutexType::scoped_lock Lock(m_Mutex);
 
-Loader::VectorSharedPtr ModuleManager::GetLoaders(void) const
-{
-  return m_Loaders;
+  Database::VectorSharedPtr Dbs;
+  for (auto pGetDatabase : m_Databases)
+    Dbs.push_back(Database::SharedPtr(pGetDatabase()));
+  return Dbs;
 }
 
-Architecture::VectorSharedPtr ModuleManager::GetArchitectures(void) const
+Loader::VectorSharedPtr ModuleManager::GetLoaders(BinaryStream const& rBinStrm) const
 {
-  return m_Architectures;
+  MutexType::scoped_lock Lock(m_Mutex);
+
+  Loader::VectorSharedPtr Ldrs;
+  for (auto pGetLoader : m_Loaders)
+  {
+    Loader::SharedPtr spLdr(pGetLoader());
+    if (spLdr->IsCompatible(rBinStrm))
+      Ldrs.push_back(spLdr);
+  }
+
+  std::sort(std::begin(Ldrs), std::end(Ldrs), [](Loader::SharedPtr spLdr0, Loader::SharedPtr spLdr1)
+  {
+    return spLdr0->GetDepth() > spLdr1->GetDepth();
+  });
+
+  return Ldrs;
 }
 
 MEDUSA_NAMESPACE_END
@@ -0,0 +1,92 @@
+#include "medusa/mutex.hpp"
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+  // The registry must not use a ProfiledMutex itself
+  struct LockRegistry
+  {
+    std::mutex                                           m_Mutex;
+    std::map<std::string, std::unique_ptr<LockCounters>> m_Counters;
+  };
+
+  LockRegistry& GetLockRegistry(void)
+  {
+    static LockRegistry s_Registry;
+    return s_Registry;
+  }
+}
+
+LockCounters::LockCounters(void)
+  : m_AcquisitionNo(0), m_ContendedNo(0)
+  , m_TotalWait(0), m_MaxWait(0)
+  , m_TotalHold(0), m_MaxHold(0)
+{
+}
+
+bool LockProfiler::IsEnabled(void)
+{
+#ifdef MEDUSA_PROFILE_LOCKS
+  return true;
+#else
+  return false;
+#endif
+}
+
+LockCounters& LockProfiler::GetCounters(char const* pName)
+{
+  auto& rRegistry = GetLockRegistry();
+  std::lock_guard<std::mutex> Lock(rRegistry.m_Mutex);
+  auto& rspCounters = rRegistry.m_Counters[pName];
+  if (rspCounters == nullptr)
+    rspCounters.reset(new LockCounters);
+  return *rspCounters;
+}
+
+LockProfiler::StatisticsVector LockProfiler::GetStatistics(void)
+{
+  StatisticsVector Stats;
+  auto& rRegistry = GetLockRegistry();
+  std::lock_guard<std::mutex> Lock(rRegistry.m_Mutex);
+
+  for (auto const& rCounters : rRegistry.m_Counters)
+  {
+    Statistics Stat;
+    Stat.m_Name          = rCounters.first;
+    Stat.m_AcquisitionNo = rCounters.second->m_AcquisitionNo.load(std::memory_order_relaxed);
+    Stat.m_ContendedNo   = rCounters.second->m_ContendedNo.load(std::memory_order_relaxed);
+    Stat.m_TotalWait     = rCounters.second->m_TotalWait.load(std::memory_order_relaxed);
+    Stat.m_MaxWait       = rCounters.second->m_MaxWait.load(std::memory_order_relaxed);
+    Stat.m_TotalHold     = rCounters.second->m_TotalHold.load(std::memory_order_relaxed);
+    Stat.m_MaxHold       = rCounters.second->m_MaxHold.load(std::memory_order_relaxed);
+    Stats.push_back(Stat);
+  }
+
+  std::sort(std::begin(Stats), std::end(Stats), [](Statistics const& rLhs, Statistics const& rRhs)
+  { return rLhs.m_TotalWait > rRhs.m_TotalWait; });
+  return Stats;
+}
+
+void LockProfiler::Reset(void)
+{
+  auto& rRegistry = GetLockRegistry();
+  std::lock_guard<std::mutex> Lock(rRegistry.m_Mutex);
+
+  for (auto const& rCounters : rRegistry.m_Counters)
+  {
+    rCounters.second->m_AcquisitionNo = 0;
+    rCounters.second->m_ContendedNo   = 0;
+    rCounters.second->m_TotalWait     = 0;
+    rCounters.second->m_MaxWait       = 0;
+    rCounters.second->m_TotalHold     = 0;
+    rCounters.second->m_MaxHold       = 0;
+  }
+}
+
+MEDUSA_NAMESPACE_END
@@ -0,0 +1,186 @@
+#include "medusa/pool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <boost/thread/tss.hpp>
+
+MEDUSA_NAMESPACE_BEGIN
+
+namespace
+{
+  enum
+  {
+    Granularity = 0x10,
+    ClassNo     = MemoryPool::MaxBlockSize / Granularity,
+    BatchSize   = 0x40  // number of blocks in a slab and exchanged with the depot at once
+  };
+
+  struct FreeBlock
+  {
+    FreeBlock* m_pNext;
+  };
+
+  struct Batch
+  {
+    FreeBlock* m_pHead;
+    u32        m_Count;
+  };
+
+  //! The depot holds the batches of free blocks shared by all threads
+  struct Depot
+  {
+    std::mutex         m_Mutex;
+    std::vector<Batch> m_Batches;
+  };
+
+  // Neither the depots nor the thread key are destroyed, blocks can be freed during exit
+  Depot* GetDepots(void)
+  {
+    static Depot* s_pDepots = new Depot[ClassNo];
+    return s_pDepots;
+  }
+
+  std::atomic<u64> s_SlabNo(0);
+
+  void PushBatch(size_t ClassIdx, FreeBlock* pHead, u32 Count)
+  {
+    if (pHead == nullptr)
+      return;
+    auto& rDepot = GetDepots()[ClassIdx];
+    std::lock_guard<std::mutex> Lock(rDepot.m_Mutex);
+    Batch NewBatch = { pHead, Count };
+    rDepot.m_Batches.push_back(NewBatch);
+  }
+
+  FreeBlock* PopBatch(size_t ClassIdx, u32& rCount)
+  {
+    auto& rDepot = GetDepots()[ClassIdx];
+    {
+      std::lock_guard<std::mutex> Lock(rDepot.m_Mutex);
+      if (!rDepot.m_Batches.empty())
+      {
+        Batch CurBatch = rDepot.m_Batches.back();
+        rDepot.m_Batches.pop_back();
+        rCount = CurBatch.m_Count;
+        return CurBatch.m_pHead;
+      }
+    }
+
+    // The depot is empty, a new slab is carved into linked blocks
+    size_t BlockSize = (ClassIdx + 1) * Granularity;
+    u8* pSlab = static_cast<u8*>(::operator new(BlockSize * BatchSize));
+    ++s_SlabNo;
+
+    FreeBlock* pHead = nullptr;
+    for (size_t BlockIdx = BatchSize; BlockIdx != 0; --BlockIdx)
+    {
+      auto pBlock = reinterpret_cast<FreeBlock*>(pSlab + (BlockIdx - 1) * BlockSize);
+      pBlock->m_pNext = pHead;
+      pHead = pBlock;
+    }
+    rCount = BatchSize;
+    return pHead;
+  }
+
+  //! ThreadCache holds the free blocks of one thread, they go back to the depot when the thread exits
+  struct ThreadCache
+  {
+    ThreadCache(void)
+    {
+      for (size_t ClassIdx = 0; ClassIdx < ClassNo; ++ClassIdx)
+      {
+        m_pHeads[ClassIdx] = nullptr;
+        m_Counts[ClassIdx] = 0;
+      }
+    }
+
+    ~ThreadCache(void)
+    {
+      for (size_t ClassIdx = 0; ClassIdx < ClassNo; ++ClassIdx)
+        PushBatch(ClassIdx, m_pHeads[ClassIdx], m_Counts[ClassIdx]);
+    }
+
+    FreeBlock* m_pHeads[ClassNo];
+    u32        m_Counts[ClassNo];
+  };
+
+  // The raw pointer is the fast path, the thread specific pointer only releases the cache when the thread exits
+  thread_local ThreadCache* s_pThreadCache = nullptr;
+
+  ThreadCache& GetThreadCache(void)
+  {
+    if (s_pThreadCache == nullptr)
+    {
+      static auto s_pThreadCacheOwner = new boost::thread_specific_ptr<ThreadCache>;
+      s_pThreadCache = new ThreadCache;
+      s_pThreadCacheOwner->reset(s_pThreadCache);
+    }
+    return *s_pThreadCache;
+  }
+
+  size_t GetClassIndex(size_t Size)
+  {
+    return Size != 0 ? (Size - 1) / Granularity : 0;
+  }
+}
+
+void* MemoryPool::Allocate(size_t Size)
+{
+  if (Size > MaxBlockSize)
+    return ::operator new(Size);
+
+  size_t ClassIdx = GetClassIndex(Size);
+  auto& rCache = GetThreadCache();
+  auto& rpHead = rCache.m_pHeads[ClassIdx];
+  if (rpHead == nullptr)
+    rpHead = PopBatch(ClassIdx, rCache.m_Counts[ClassIdx]);
+
+  FreeBlock* pBlock = rpHead;
+  rpHead = pBlock->m_pNext;
+  --rCache.m_Counts[ClassIdx];
+  return pBlock;
+}
+
+void MemoryPool::Free(void* pBlock, size_t Size)
+{
+  if (pBlock == nullptr)
+    return;
+
+  if (Size > MaxBlockSize)
+  {
+    ::operator delete(pBlock);
+    return;
+  }
+
+  size_t ClassIdx = GetClassIndex(Size);
+  auto& rCache = GetThreadCache();
+  auto& rpHead = rCache.m_pHeads[ClassIdx];
+  auto& rCount = rCache.m_Counts[ClassIdx];
+
+  auto pFreeBlock = static_cast<FreeBlock*>(pBlock);
+  pFreeBlock->m_pNext = rpHead;
+  rpHead = pFreeBlock;
+  ++rCount;
+
+  // A thread which only releases blocks hands them over to the others
+  if (rCount < 2 * BatchSize)
+    return;
+
+  FreeBlock* pBatchHead = rpHead;
+  FreeBlock* pBatchTail = rpHead;
+  for (u32 BlockIdx = 1; BlockIdx < BatchSize; ++BlockIdx)
+    pBatchTail = pBatchTail->m_pNext;
+  rpHead = pBatchTail->m_pNext;
+  pBatchTail->m_pNext = nullptr;
+  rCount -= BatchSize;
+  PushBatch(ClassIdx, pBatchHead, BatchSize);
+}
+
+u64 MemoryPool::GetNumberOfSlabs(void)
+{
+  return s_SlabNo.load();
+}
+
+MEDUSA_NAMESPACE_END
@@ -124,10 +124,9 @@ u16 Printer::GetLineWidth(Address const& rAddress, u32 Flags) const
   if (pCell == nullptr)
     return 0;
 
-  std::string StrCell;
-  Cell::Mark::List CellMarks;
-  m_rCore.FormatCell(rAddress, *pCell, StrCell, CellMarks);
-  CellLen += StrCell.length();
+  m_CellText.Clear();
+  m_rCore.FormatCell(rAddress, *pCell, m_CellText);
+  CellLen += m_CellText.GetLength();
   std::string Comment;
   if (rDoc.GetComment(rAddress, Comment))
     CellLen += (Comment.length() + 3);
@@ -165,24 +164,19 @@ u32 StreamPrinter::PrintAddress(Address const& rAddress, u32 xOffset, u32 yOffse
 
 u32 StreamPrinter::PrintCell(Address const& rAddress, u32 xOffset, u32 yOffset)
 {
-  std::ostringstream Buffer;
   auto pCell = m_rCore.GetCell(rAddress);
   if (pCell == nullptr)
-  {
-    Buffer << "invalid cell" << std::endl;
     return 1;
-  }
 
-  std::string CellStr;
-  Cell::Mark::List Marks;
-  m_rCore.FormatCell(rAddress, *pCell, CellStr, Marks);
-  Buffer << CellStr;
+  // The cell is written as is, a stream buffer would copy every line
+  m_CellText.Clear();
+  m_rCore.FormatCell(rAddress, *pCell, m_CellText);
+  m_rStream << m_CellText.GetText();
   std::string Comment;
   if (m_rCore.GetDocument().GetComment(rAddress, Comment))
-    Buffer << " ; " << Comment;
+    m_rStream << " ; " << Comment;
 
-  HandleOffset(Buffer, xOffset);
-  m_rStream << Buffer.str() << std::endl;
+  m_rStream << std::endl;
   return 1;
 }
 
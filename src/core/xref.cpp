@@ -1,58 +1,367 @@
 #include "medusa/xref.hpp"
-#include <boost/foreach.hpp>
+
+#include <algorithm>
 
 MEDUSA_NAMESPACE_BEGIN
 
+// Pending cross-references are compacted automatically when they outnumber
+// the compacted ones (and this threshold), so insertion stays amortized O(1).
+static size_t const s_CompactThreshold = 0x10000;
+
+XRefs::XRefs(void)
+  : m_BucketShift(0)
+  , m_RemovedCount(0)
+{
+}
+
 bool XRefs::AddXRef(Address const& rTo, Address const& rFrom)
 {
-  m_XRefs.insert(TXRefs::value_type(rTo, rFrom));
+  if (_HasCompactedXRef(rTo, rFrom) || _HasPendingXRef(rTo, rFrom))
+    return true;
+
+  m_PendingFrom.insert(TPendingXRefs::value_type(rTo, rFrom));
+  m_PendingTo.insert(TPendingXRefs::value_type(rFrom, rTo));
+
+  if (m_PendingFrom.size() > std::max(s_CompactThreshold, m_FromIds.size()))
+    Compact();
+
   return true;
 }
 
 bool XRefs::RemoveRef(Address const& rFrom)
 {
-  m_XRefs.right.erase(rFrom);
+  AddressId FromId;
+  if (_GetAddressId(rFrom, FromId) && !m_Removed[FromId])
+  {
+    m_Removed[FromId] = true;
+    m_RemovedCount += m_FromOffsets[FromId + 1] - m_FromOffsets[FromId];
+  }
+
+  auto PendingRange = m_PendingTo.equal_range(rFrom);
+  for (auto itTo = PendingRange.first; itTo != PendingRange.second; ++itTo)
+  {
+    auto FromRange = m_PendingFrom.equal_range(itTo->second);
+    for (auto itFrom = FromRange.first; itFrom != FromRange.second; ++itFrom)
+      if (itFrom->second == rFrom)
+      {
+        m_PendingFrom.erase(itFrom);
+        break;
+      }
+  }
+  m_PendingTo.erase(rFrom);
+
   return true;
 }
 
 bool XRefs::From(Address const& rTo, Address::List& rFromList) const
 {
-  auto const& rLeft = m_XRefs.left;
-  auto itXRef = rLeft.find(rTo);
+  AddressId ToId;
+  if (_GetAddressId(rTo, ToId))
+    for (u32 Idx = m_ToOffsets[ToId]; Idx < m_ToOffsets[ToId + 1]; ++Idx)
+    {
+      AddressId FromId = m_FromIds[Idx];
+      if (!m_Removed[FromId])
+        rFromList.push_back(m_Addresses[FromId]);
+    }
 
-  for (; itXRef != std::end(rLeft) && itXRef->first == rTo; ++itXRef)
-    rFromList.push_back(itXRef->second);
+  auto PendingRange = m_PendingFrom.equal_range(rTo);
+  for (auto itFrom = PendingRange.first; itFrom != PendingRange.second; ++itFrom)
+    rFromList.push_back(itFrom->second);
 
   return !rFromList.empty();
 }
 
 bool XRefs::To(Address const& rFrom, Address& rTo) const
 {
-  try
+  AddressId FromId;
+  if (_GetAddressId(rFrom, FromId) && !m_Removed[FromId] && m_FromOffsets[FromId] != m_FromOffsets[FromId + 1])
   {
-    rTo = m_XRefs.right.at(rFrom);
+    rTo = m_Addresses[m_ToIds[m_FromOffsets[FromId]]];
+    return true;
   }
-  catch (std::out_of_range)
-  {
+
+  auto itTo = m_PendingTo.find(rFrom);
+  if (itTo == std::end(m_PendingTo))
     return false;
-  }
 
+  rTo = itTo->second;
   return true;
 }
 
+bool XRefs::To(Address const& rFrom, Address::List& rToList) const
+{
+  AddressId FromId;
+  if (_GetAddressId(rFrom, FromId) && !m_Removed[FromId])
+    for (u32 Idx = m_FromOffsets[FromId]; Idx < m_FromOffsets[FromId + 1]; ++Idx)
+      rToList.push_back(m_Addresses[m_ToIds[Idx]]);
+
+  auto PendingRange = m_PendingTo.equal_range(rFrom);
+  for (auto itTo = PendingRange.first; itTo != PendingRange.second; ++itTo)
+    rToList.push_back(itTo->second);
+
+  return !rToList.empty();
+}
+
 bool XRefs::HasXRefTo(Address const& rFrom) const
 {
-  return m_XRefs.right.find(rFrom) != std::end(m_XRefs.right);
+  AddressId FromId;
+  if (_GetAddressId(rFrom, FromId) && !m_Removed[FromId] && m_FromOffsets[FromId] != m_FromOffsets[FromId + 1])
+    return true;
+
+  return m_PendingTo.find(rFrom) != std::end(m_PendingTo);
 }
 
 bool XRefs::HasXRefFrom(Address const& rTo) const
 {
-  return m_XRefs.left.find(rTo) != std::end(m_XRefs.left);
+  AddressId ToId;
+  if (_GetAddressId(rTo, ToId))
+    for (u32 Idx = m_ToOffsets[ToId]; Idx < m_ToOffsets[ToId + 1]; ++Idx)
+      if (!m_Removed[m_FromIds[Idx]])
+        return true;
+
+  return m_PendingFrom.find(rTo) != std::end(m_PendingFrom);
 }
 
 void XRefs::EraseAll(void)
 {
-  m_XRefs.erase(m_XRefs.begin(), m_XRefs.end());
+  m_Addresses.clear();
+  m_ToOffsets.clear();
+  m_FromIds.clear();
+  m_FromOffsets.clear();
+  m_ToIds.clear();
+  m_Buckets.clear();
+  m_Removed.clear();
+  m_RemovedCount = 0;
+  m_PendingFrom.clear();
+  m_PendingTo.clear();
+}
+
+void XRefs::Compact(void)
+{
+  if (m_PendingFrom.empty() && m_RemovedCount == 0)
+    return;
+
+  // Merge pending addresses into the address table
+  Address::Vector PendingAddrs;
+  PendingAddrs.reserve(m_PendingFrom.size() * 2);
+  for (auto const& rXRef : m_PendingFrom)
+  {
+    PendingAddrs.push_back(rXRef.first);
+    PendingAddrs.push_back(rXRef.second);
+  }
+  std::sort(std::begin(PendingAddrs), std::end(PendingAddrs));
+  PendingAddrs.erase(std::unique(std::begin(PendingAddrs), std::end(PendingAddrs)), std::end(PendingAddrs));
+
+  Address::Vector Addrs;
+  Addrs.reserve(m_Addresses.size() + PendingAddrs.size());
+  std::set_union(
+    std::begin(m_Addresses), std::end(m_Addresses),
+    std::begin(PendingAddrs), std::end(PendingAddrs),
+    std::back_inserter(Addrs));
+  PendingAddrs.clear();
+
+  std::vector<AddressId> OldToNewId(m_Addresses.size());
+  for (AddressId OldId = 0, NewId = 0; OldId < m_Addresses.size(); ++OldId)
+  {
+    while (!(Addrs[NewId] == m_Addresses[OldId]))
+      ++NewId;
+    OldToNewId[OldId] = NewId;
+  }
+
+  auto GetId = [&Addrs](Address const& rAddr) -> AddressId
+  {
+    return static_cast<AddressId>(std::lower_bound(std::begin(Addrs), std::end(Addrs), rAddr) - std::begin(Addrs));
+  };
+
+  // Gather every live cross-reference as (to id << 32 | from id)
+  std::vector<u64> Edges;
+  Edges.reserve(m_FromIds.size() - m_RemovedCount + m_PendingFrom.size());
+  for (AddressId ToId = 0; ToId + 1 < m_ToOffsets.size(); ++ToId)
+    for (u32 Idx = m_ToOffsets[ToId]; Idx < m_ToOffsets[ToId + 1]; ++Idx)
+    {
+      AddressId FromId = m_FromIds[Idx];
+      if (!m_Removed[FromId])
+        Edges.push_back(static_cast<u64>(OldToNewId[ToId]) << 32 | OldToNewId[FromId]);
+    }
+  for (auto const& rXRef : m_PendingFrom)
+    Edges.push_back(static_cast<u64>(GetId(rXRef.first)) << 32 | GetId(rXRef.second));
+  OldToNewId.clear();
+  m_PendingFrom.clear();
+  m_PendingTo.clear();
+
+  std::sort(std::begin(Edges), std::end(Edges));
+  Edges.erase(std::unique(std::begin(Edges), std::end(Edges)), std::end(Edges));
+
+  // Drop addresses which are not referenced anymore
+  std::vector<AddressId> UsedId(Addrs.size(), 0);
+  for (u64 Edge : Edges)
+  {
+    UsedId[Edge >> 32]        = 1;
+    UsedId[Edge & 0xffffffff] = 1;
+  }
+  m_Addresses.clear();
+  for (AddressId Id = 0; Id < Addrs.size(); ++Id)
+  {
+    if (UsedId[Id] == 0)
+      continue;
+    UsedId[Id] = static_cast<AddressId>(m_Addresses.size());
+    m_Addresses.push_back(Addrs[Id]);
+  }
+  m_Addresses.shrink_to_fit();
+  Addrs.clear();
+  Addrs.shrink_to_fit();
+
+  // Build both indexes, edges are sorted by target then by source so each
+  // row of the from→tos index is sorted as well
+  size_t const AddrNo = m_Addresses.size();
+  m_ToOffsets.assign(AddrNo + 1, 0);
+  m_FromOffsets.assign(AddrNo + 1, 0);
+  m_FromIds.resize(Edges.size());
+  m_ToIds.resize(Edges.size());
+
+  for (u64& rEdge : Edges)
+  {
+    AddressId ToId   = UsedId[rEdge >> 32];
+    AddressId FromId = UsedId[rEdge & 0xffffffff];
+    rEdge = static_cast<u64>(ToId) << 32 | FromId;
+    ++m_ToOffsets[ToId + 1];
+    ++m_FromOffsets[FromId + 1];
+  }
+  for (size_t Idx = 0; Idx < AddrNo; ++Idx)
+  {
+    m_ToOffsets[Idx + 1]   += m_ToOffsets[Idx];
+    m_FromOffsets[Idx + 1] += m_FromOffsets[Idx];
+  }
+
+  std::vector<u32> FromCursor(std::begin(m_FromOffsets), std::end(m_FromOffsets) - 1);
+  for (size_t Idx = 0; Idx < Edges.size(); ++Idx)
+  {
+    AddressId ToId   = static_cast<AddressId>(Edges[Idx] >> 32);
+    AddressId FromId = static_cast<AddressId>(Edges[Idx] & 0xffffffff);
+    m_FromIds[Idx] = FromId;
+    m_ToIds[FromCursor[FromId]++] = ToId;
+  }
+
+  m_Removed.assign(AddrNo, false);
+  m_RemovedCount = 0;
+
+  _BuildBuckets();
+}
+
+void XRefs::ForEachXRef(std::function<void (Address const& rTo, Address::List const& rFromList)> XRefPredicat)
+{
+  Compact();
+
+  Address::List FromList;
+  for (AddressId ToId = 0; ToId < m_Addresses.size(); ++ToId)
+  {
+    if (m_ToOffsets[ToId] == m_ToOffsets[ToId + 1])
+      continue;
+
+    FromList.clear();
+    for (u32 Idx = m_ToOffsets[ToId]; Idx < m_ToOffsets[ToId + 1]; ++Idx)
+      FromList.push_back(m_Addresses[m_FromIds[Idx]]);
+    XRefPredicat(m_Addresses[ToId], FromList);
+  }
+}
+
+size_t XRefs::GetSize(void) const
+{
+  return m_FromIds.size() - m_RemovedCount + m_PendingFrom.size();
+}
+
+size_t XRefs::GetMemoryUsage(void) const
+{
+  // Each pending cross-reference is held by a node in both multimaps
+  size_t const PendingNodeSize = sizeof(TPendingXRefs::value_type) + 2 * sizeof(void*);
+
+  return m_Addresses.capacity()   * sizeof(Address)
+    +    m_ToOffsets.capacity()   * sizeof(u32)
+    +    m_FromIds.capacity()     * sizeof(AddressId)
+    +    m_FromOffsets.capacity() * sizeof(u32)
+    +    m_ToIds.capacity()       * sizeof(AddressId)
+    +    m_Buckets.capacity()     * sizeof(u32)
+    +    m_Removed.capacity() / 8
+    +    2 * m_PendingFrom.size() * PendingNodeSize
+    +    m_PendingFrom.bucket_count() * sizeof(void*)
+    +    m_PendingTo.bucket_count()   * sizeof(void*);
+}
+
+bool XRefs::_GetAddressId(Address const& rAddr, AddressId& rId) const
+{
+  auto itBegin = std::begin(m_Addresses);
+  auto itEnd   = std::end(m_Addresses);
+
+  // Narrow the binary search to the bucket which contains this offset
+  if (!m_Buckets.empty())
+  {
+    Address const& rFirstAddr = m_Addresses.front();
+    if (rAddr.GetBase() != rFirstAddr.GetBase() || rAddr.GetOffset() < rFirstAddr.GetOffset())
+      return false;
+    u64 Bucket = (rAddr.GetOffset() - rFirstAddr.GetOffset()) >> m_BucketShift;
+    if (Bucket + 1 >= m_Buckets.size())
+      return false;
+    itEnd   = std::begin(m_Addresses) + m_Buckets[Bucket + 1];
+    itBegin = std::begin(m_Addresses) + m_Buckets[Bucket];
+  }
+
+  auto itAddr = std::lower_bound(itBegin, itEnd, rAddr);
+  if (itAddr == itEnd || !(*itAddr == rAddr))
+    return false;
+
+  rId = static_cast<AddressId>(itAddr - std::begin(m_Addresses));
+  return true;
+}
+
+void XRefs::_BuildBuckets(void)
+{
+  m_Buckets.clear();
+  m_BucketShift = 0;
+
+  // Buckets are only used when all addresses share the same base
+  if (m_Addresses.empty() || m_Addresses.front().GetBase() != m_Addresses.back().GetBase())
+    return;
+
+  // Use at most one bucket per address
+  TOffset const FirstOff = m_Addresses.front().GetOffset();
+  TOffset const Range    = m_Addresses.back().GetOffset() - FirstOff;
+  while ((Range >> m_BucketShift) >= m_Addresses.size())
+    ++m_BucketShift;
+
+  size_t const BucketNo = static_cast<size_t>(Range >> m_BucketShift) + 1;
+  m_Buckets.resize(BucketNo + 1);
+
+  AddressId CurId = 0;
+  for (size_t Bucket = 0; Bucket < BucketNo; ++Bucket)
+  {
+    while (CurId < m_Addresses.size() && ((m_Addresses[CurId].GetOffset() - FirstOff) >> m_BucketShift) < Bucket)
+      ++CurId;
+    m_Buckets[Bucket] = CurId;
+  }
+  m_Buckets[BucketNo] = static_cast<u32>(m_Addresses.size());
+  m_Buckets.shrink_to_fit();
+}
+
+bool XRefs::_HasCompactedXRef(Address const& rTo, Address const& rFrom) const
+{
+  AddressId ToId, FromId;
+  if (!_GetAddressId(rFrom, FromId) || m_Removed[FromId])
+    return false;
+  if (!_GetAddressId(rTo, ToId))
+    return false;
+
+  auto itBegin = std::begin(m_ToIds) + m_FromOffsets[FromId];
+  auto itEnd   = std::begin(m_ToIds) + m_FromOffsets[FromId + 1];
+  return std::binary_search(itBegin, itEnd, ToId);
+}
+
+bool XRefs::_HasPendingXRef(Address const& rTo, Address const& rFrom) const
+{
+  auto PendingRange = m_PendingTo.equal_range(rFrom);
+  for (auto itTo = PendingRange.first; itTo != PendingRange.second; ++itTo)
+    if (itTo->second == rTo)
+      return true;
+  return false;
 }
 
-MEDUSA_NAMESPACE_END
\ No newline at end of file
+MEDUSA_NAMESPACE_END
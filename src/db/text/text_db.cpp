@@ -69,6 +69,12 @@ static std::string Base64Decode(std::string const &rBase64Data)
 }
 
 TextDatabase::TextDatabase(void)
+  : m_ArchitectureTagLock("text_db.architecture_tag")
+  , m_MemoryAreaLock("text_db.memory_area")
+  , m_LabelLock("text_db.label")
+  , m_CrossReferencesLock("text_db.cross_reference")
+  , m_MultiCellsLock("text_db.multicell")
+  , m_CommentsMutex("text_db.comment")
 {
 }
 
@@ -118,17 +124,19 @@ bool TextDatabase::Open(boost::filesystem::path const& rDatabasePath)
   };
 
   State CurState = UnknownState;
-  static std::unordered_map<std::string, State> StrToState;
-  if (StrToState.empty())
+  // Several databases can be opened concurrently, the table must be filled only once
+  static std::unordered_map<std::string, State> const StrToState = []()
   {
-    StrToState["## BinaryStream"] = BinaryStreamState;
-    StrToState["## Architecture"] = ArchitectureState;
-    StrToState["## MemoryArea"] = MemoryAreaState;
-    StrToState["## Label"] = LabelState;
-    StrToState["## CrossReference"] = CrossReferenceState;
-    StrToState["## MultiCell"] = MultiCellState;
-    StrToState["## Comment"] = CommentState;
-  }
+    std::unordered_map<std::string, State> States;
+    States["## BinaryStream"] = BinaryStreamState;
+    States["## Architecture"] = ArchitectureState;
+    States["## MemoryArea"] = MemoryAreaState;
+    States["## Label"] = LabelState;
+    States["## CrossReference"] = CrossReferenceState;
+    States["## MultiCell"] = MultiCellState;
+    States["## Comment"] = CommentState;
+    return States;
+  }();
 
   auto& rModMgr = ModuleManager::Instance();
   MemoryArea *pMemArea = nullptr;
@@ -226,7 +234,7 @@ bool TextDatabase::Open(boost::filesystem::path const& rDatabasePath)
         issDna.seekg(::strlen(" dna("), std::ios::cur);
         issDna >> std::hex >> Type >> SubType >> Size >> FormatStyle >> Flags >> Mode >> ArchTag;
         Address::List DelAddr;
-        auto spDna = std::make_shared<CellData>(CellData(
+        auto spDna = MakePooled<CellData>(CellData(
           /**/static_cast<u8>(Type), static_cast<u8>(SubType), Size,
           /**/FormatStyle, static_cast<u8>(Flags),
           /**/ArchTag,
@@ -370,7 +378,7 @@ bool TextDatabase::Flush(void)
 
   // Save architecture tag
   {
-    std::lock_guard<std::mutex> Lock(m_ArchitectureTagLock);
+    std::lock_guard<MutexType> Lock(m_ArchitectureTagLock);
     TextFile << "## Architecture\n";
     char const* pSep = "";
     for (Tag ArchTag : m_ArchitectureTags)
@@ -383,7 +391,7 @@ bool TextDatabase::Flush(void)
 
   // Save memory area
   {
-    std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+    std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
     TextFile << "## MemoryArea\n";
     for (MemoryArea* pMemArea : m_MemoryAreas)
     {
@@ -397,7 +405,7 @@ bool TextDatabase::Flush(void)
 
   // Save label
   {
-    std::lock_guard<std::recursive_mutex> Lock(m_LabelLock);
+    std::lock_guard<RecursiveMutexType> Lock(m_LabelLock);
     TextFile << "## Label\n";
     for (auto itLabel = std::begin(m_LabelMap.left); itLabel != std::end(m_LabelMap.left); ++itLabel)
       TextFile << itLabel->first.Dump() << " " << itLabel->second.Dump() << "\n" << std::flush;
@@ -405,22 +413,20 @@ bool TextDatabase::Flush(void)
 
   // Save cross reference
   {
-    std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+    std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
     TextFile << "## CrossReference\n";
-    for (auto itXref = std::begin(m_CrossReferences.GetAllXRefs().left); itXref != std::end(m_CrossReferences.GetAllXRefs().left); ++itXref)
+    m_CrossReferences.ForEachXRef([&](Address const& rTo, Address::List const& rFromList)
     {
-      TextFile << itXref->first.Dump();
-      Address::List From;
-      m_CrossReferences.From(itXref->first, From);
-      for (Address const& rAddr : From)
+      TextFile << rTo.Dump();
+      for (Address const& rAddr : rFromList)
         TextFile << " " << rAddr.Dump() << std::flush;
       TextFile << "\n";
-    }
+    });
   }
 
   // Save multicell
   {
-    std::lock_guard<std::mutex> Lock(m_MultiCellsLock);
+    std::lock_guard<MutexType> Lock(m_MultiCellsLock);
     TextFile << "## MultiCell\n";
     for (auto itMultiCell = std::begin(m_MultiCells); itMultiCell != std::end(m_MultiCells); ++itMultiCell)
       TextFile << itMultiCell->first.Dump() << " " << itMultiCell->second.Dump() << "\n" << std::flush;
@@ -428,7 +434,7 @@ bool TextDatabase::Flush(void)
 
   // Save comment
   {
-    std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+    std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
     TextFile << "## Comment\n";
     for (auto itComment = std::begin(m_Comments); itComment != std::end(m_Comments); ++itComment)
     {
@@ -449,27 +455,27 @@ bool TextDatabase::Close(void)
 
 bool TextDatabase::RegisterArchitectureTag(Tag ArchitectureTag)
 {
-  std::lock_guard<std::mutex> Lock(m_ArchitectureTagLock);
+  std::lock_guard<MutexType> Lock(m_ArchitectureTagLock);
   m_ArchitectureTags.push_back(ArchitectureTag);
   return true;
 }
 
 bool TextDatabase::UnregisterArchitectureTag(Tag ArchitectureTag)
 {
-  std::lock_guard<std::mutex> Lock(m_ArchitectureTagLock);
+  std::lock_guard<MutexType> Lock(m_ArchitectureTagLock);
   m_ArchitectureTags.remove(ArchitectureTag);
   return true;
 }
 
 std::list<Tag> TextDatabase::GetArchitectureTags(void) const
 {
-  std::lock_guard<std::mutex> Lock(m_ArchitectureTagLock);
+  std::lock_guard<MutexType> Lock(m_ArchitectureTagLock);
   return m_ArchitectureTags;
 }
 
 bool TextDatabase::AddMemoryArea(MemoryArea* pMemArea)
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   m_MemoryAreas.insert(pMemArea);
   return true;
 }
@@ -481,7 +487,7 @@ void TextDatabase::ForEachMemoryArea(std::function<void (MemoryArea const& rMemo
 
 MemoryArea const* TextDatabase::GetMemoryArea(Address const& rAddress) const
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   for (MemoryArea* pMemArea : m_MemoryAreas)
     if (pMemArea->IsCellPresent(rAddress))
       return pMemArea;
@@ -508,7 +514,7 @@ bool TextDatabase::ConvertAddressToPosition(Address const& rAddress, u32& rPosit
   if (pMemArea == nullptr)
     return false;
 
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   for (MemoryArea* pMemArea : m_MemoryAreas)
   {
     if (pMemArea->IsCellPresent(rAddress))
@@ -524,7 +530,7 @@ bool TextDatabase::ConvertAddressToPosition(Address const& rAddress, u32& rPosit
 
 bool TextDatabase::ConvertPositionToAddress(u32 Position, Address& rAddress) const
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   for (MemoryArea* pMemArea : m_MemoryAreas)
   {
     u32 Size = pMemArea->GetSize();
@@ -540,14 +546,14 @@ bool TextDatabase::ConvertPositionToAddress(u32 Position, Address& rAddress) con
 
 bool TextDatabase::AddLabel(Address const& rAddress, Label const& rLabel)
 {
-  std::lock_guard<std::recursive_mutex> Lock(m_LabelLock);
+  std::lock_guard<RecursiveMutexType> Lock(m_LabelLock);
   m_LabelMap.left.insert(LabelBimapType::left_value_type(rAddress, rLabel));
   return true;
 }
 
 bool TextDatabase::RemoveLabel(Address const& rAddress)
 {
-  boost::lock_guard<std::recursive_mutex> Lock(m_LabelLock);
+  std::lock_guard<RecursiveMutexType> Lock(m_LabelLock);
 
   auto itLbl = m_LabelMap.left.find(rAddress);
   if (itLbl == std::end(m_LabelMap.left))
@@ -559,7 +565,7 @@ bool TextDatabase::RemoveLabel(Address const& rAddress)
 
 bool TextDatabase::GetLabel(Address const& rAddress, Label& rLabel) const
 {
-  std::lock_guard<std::recursive_mutex> Lock(m_LabelLock);
+  std::lock_guard<RecursiveMutexType> Lock(m_LabelLock);
   auto itLbl = m_LabelMap.left.find(rAddress);
   if (itLbl == std::end(m_LabelMap.left))
     return false;
@@ -570,7 +576,7 @@ bool TextDatabase::GetLabel(Address const& rAddress, Label& rLabel) const
 
 bool TextDatabase::GetLabelAddress(Label const& rLabel, Address& rAddress) const
 {
-  std::lock_guard<std::recursive_mutex> Lock(m_LabelLock);
+  std::lock_guard<RecursiveMutexType> Lock(m_LabelLock);
   auto itLbl = m_LabelMap.right.find(rLabel);
   if (itLbl == std::end(m_LabelMap.right))
     return false;
@@ -598,57 +604,70 @@ void TextDatabase::ForEachLabel(std::function<void (Address const& rAddress, Lab
 
 bool TextDatabase::AddCrossReference(Address const& rTo, Address const& rFrom)
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.AddXRef(rTo, rFrom);
 }
 
 bool TextDatabase::RemoveCrossReference(Address const& rFrom)
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.RemoveRef(rFrom);
 }
 
 bool TextDatabase::RemoveCrossReferences(void)
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   m_CrossReferences.EraseAll();
   return true;
 }
 
 bool TextDatabase::HasCrossReferenceFrom(Address const& rTo) const
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.HasXRefFrom(rTo);
 }
 
 bool TextDatabase::GetCrossReferenceFrom(Address const& rTo, Address::List& rFromList) const
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.From(rTo, rFromList);
 }
 
 bool TextDatabase::HasCrossReferenceTo(Address const& rFrom) const
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.HasXRefTo(rFrom);
 }
 
 bool TextDatabase::GetCrossReferenceTo(Address const& rFrom, Address& rTo) const
 {
-  std::lock_guard<std::mutex> Lock(m_CrossReferencesLock);
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
   return m_CrossReferences.To(rFrom, rTo);
 }
 
+bool TextDatabase::GetCrossReferenceTo(Address const& rFrom, Address::List& rToList) const
+{
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
+  return m_CrossReferences.To(rFrom, rToList);
+}
+
+bool TextDatabase::CompactCrossReferences(void)
+{
+  std::lock_guard<MutexType> Lock(m_CrossReferencesLock);
+  m_CrossReferences.Compact();
+  return true;
+}
+
 bool TextDatabase::AddMultiCell(Address const& rAddress, MultiCell const& rMultiCell)
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   m_MultiCells[rAddress] = rMultiCell;
   return true;
 }
 
 bool TextDatabase::RemoveMultiCell(Address const& rAddress)
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
 
   auto itMultiCell = m_MultiCells.find(rAddress);
   if (itMultiCell == std::end(m_MultiCells))
@@ -659,7 +678,7 @@ bool TextDatabase::RemoveMultiCell(Address const& rAddress)
 
 bool TextDatabase::GetMultiCell(Address const& rAddress, MultiCell& rMultiCell) const
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   auto itMultiCell = m_MultiCells.find(rAddress);
   if (itMultiCell == std::end(m_MultiCells))
     return false;
@@ -682,7 +701,7 @@ bool TextDatabase::GetCellData(Address const& rAddress, CellData& rCellData)
 bool TextDatabase::SetCellData(Address const& rAddress, CellData const& rCellData, Address::List& rDeletedCellAddresses, bool Force)
 {
   MemoryArea* pCurMemArea = nullptr;
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   for (MemoryArea* pMemArea : m_MemoryAreas)
     if (pMemArea->IsCellPresent(rAddress))
     {
@@ -691,13 +710,13 @@ bool TextDatabase::SetCellData(Address const& rAddress, CellData const& rCellDat
     }
   if (pCurMemArea == nullptr)
     return false;
-  CellData::SPtr spCellData = std::make_shared<CellData>(rCellData);
+  CellData::SPtr spCellData = MakePooled<CellData>(rCellData);
   return pCurMemArea->SetCellData(rAddress.GetOffset(), spCellData, rDeletedCellAddresses, Force);
 }
 
 bool TextDatabase::GetComment(Address const& rAddress, std::string& rComment) const
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
   auto itCmt = m_Comments.find(rAddress);
   if (itCmt == std::end(m_Comments))
     return false;
@@ -707,7 +726,7 @@ bool TextDatabase::GetComment(Address const& rAddress, std::string& rComment) co
 
 bool TextDatabase::SetComment(Address const& rAddress, std::string const& rComment)
 {
-  std::lock_guard<std::mutex> Lock(m_MemoryAreaLock);
+  std::lock_guard<MutexType> Lock(m_MemoryAreaLock);
 
   if (rComment.empty())
   {
@@ -735,7 +754,7 @@ bool TextDatabase::_FileRemoves(boost::filesystem::path const& rFilePath)
 
 bool TextDatabase::_FileCanCreate(boost::filesystem::path const& rFilePath)
 {
-  std::fstream File(rFilePath.string(), std::ios_base::in | std::ios_base::out);
+  std::ofstream File(rFilePath.string(), std::ios_base::out | std::ios_base::app);
   return File.is_open();
 }
 
@@ -4,6 +4,7 @@
 #include <medusa/namespace.hpp>
 #include <medusa/database.hpp>
 #include <medusa/memory_area.hpp>
+#include <medusa/mutex.hpp>
 
 #include <boost/archive/iterators/base64_from_binary.hpp>
 #include <boost/archive/iterators/binary_from_base64.hpp>
@@ -93,6 +94,9 @@ public:
 
   virtual bool HasCrossReferenceTo(Address const& rFrom) const;
   virtual bool GetCrossReferenceTo(Address const& rFrom, Address& rTo) const;
+  virtual bool GetCrossReferenceTo(Address const& rFrom, Address::List& rToList) const;
+
+  virtual bool CompactCrossReferences(void);
 
   // MultiCell
   virtual bool AddMultiCell(Address const& rAddress, MultiCell const& rMultiCell);
@@ -116,25 +120,28 @@ private:
   bool _MoveAddressBackward(Address const& rAddress, Address& rMovedAddress, s64 Offset) const;
   bool _MoveAddressForward(Address const& rAddress, Address& rMovedAddress, s64 Offset) const;
 
+  typedef ProfiledMutex<std::mutex>           MutexType;
+  typedef ProfiledMutex<std::recursive_mutex> RecursiveMutexType;
+
   boost::filesystem::path m_DatabasePath;
 
   std::list<Tag>     m_ArchitectureTags;
-  mutable std::mutex m_ArchitectureTagLock;
+  mutable MutexType  m_ArchitectureTagLock;
 
   MemoryAreaSetType  m_MemoryAreas;
-  mutable std::mutex m_MemoryAreaLock;
+  mutable MutexType  m_MemoryAreaLock;
 
   LabelBimapType     m_LabelMap;
-  mutable std::recursive_mutex m_LabelLock;
+  mutable RecursiveMutexType m_LabelLock;
 
   XRefs              m_CrossReferences;
-  mutable std::mutex m_CrossReferencesLock;
+  mutable MutexType  m_CrossReferencesLock;
 
   MultiCellMapType   m_MultiCells;
-  mutable std::mutex m_MultiCellsLock;
+  mutable MutexType  m_MultiCellsLock;
 
   CommentMapType     m_Comments;
-  mutable std::mutex m_CommentsMutex;
+  mutable MutexType  m_CommentsMutex;
 };
 
 extern "C" DB_TEXT_EXPORT Database* GetDatabase(void);
@@ -0,0 +1,697 @@
+#include "bytecode_emulator.hpp"
+#include <medusa/extend.hpp>
+#include <medusa/log.hpp>
+
+MEDUSA_NAMESPACE_USE
+
+namespace
+{
+  u32 const AbortLabel = 0;           // failing outside of a region aborts the execution
+  u32 const AbortIndex = 0xffffffff;
+  u32 const MaxRegNo   = 0x10000;
+
+  bool EvaluateCondition(u32 Type, u64 Ref, u64 Test)
+  {
+    switch (Type)
+    {
+    case ConditionExpression::CondEq:  return Ref == Test;
+    case ConditionExpression::CondNe:  return Ref != Test;
+    case ConditionExpression::CondUgt: return Ref >  Test;
+    case ConditionExpression::CondUge: return Ref >= Test;
+    case ConditionExpression::CondUlt: return Ref <  Test;
+    case ConditionExpression::CondUle: return Ref <= Test;
+    case ConditionExpression::CondSgt: return static_cast<s64>(Ref) >  static_cast<s64>(Test);
+    case ConditionExpression::CondSge: return static_cast<s64>(Ref) >= static_cast<s64>(Test);
+    case ConditionExpression::CondSlt: return static_cast<s64>(Ref) <  static_cast<s64>(Test);
+    case ConditionExpression::CondSle: return static_cast<s64>(Ref) <= static_cast<s64>(Test);
+    default:                           return false;
+    }
+  }
+
+  // Same as ConstantExpression::SignExtend, an unknown size leaves the value untouched
+  u64 SignExtendValue(u64 Value, u32 FromBit, u32 ToBit)
+  {
+    switch (FromBit)
+    {
+    case 8:  Value = SignExtend<s64,  8>(Value); break;
+    case 16: Value = SignExtend<s64, 16>(Value); break;
+    case 32: Value = SignExtend<s64, 32>(Value); break;
+    case 64:                                     break;
+    default: return Value;
+    }
+
+    switch (ToBit)
+    {
+    case 8:  Value &= 0x000000ff; break;
+    case 16: Value &= 0x0000ffff; break;
+    case 32: Value &= 0xffffffff; break;
+    default:                      break;
+    }
+    return Value;
+  }
+}
+
+/*!
+ * Compiler translates statements into bytecode the way InterpreterEmulator
+ * evaluates them. Each visited expression gives an Operand: registers,
+ * variables and memory are only read or written once the operation which
+ * uses them knows how.
+ *
+ * When an evaluation fails, the interpreter gives up the innermost bind
+ * element or condition branch, or the whole execution for a top-level
+ * statement. Failing codes jump to the label of this region.
+ */
+class BytecodeEmulator::Compiler : public ExpressionVisitor
+{
+public:
+  Compiler(std::vector<Code>& rCodes)
+    : m_rCodes(rCodes), m_FailLabel(AbortLabel), m_RegNo(1), m_MaxRegNo(1), m_IsStatement(false), m_IsValid(true)
+  {
+    m_Labels.push_back(AbortIndex);
+  }
+
+  bool AddStatement(Expression const* pExpr)
+  {
+    m_RegNo = 1;
+    m_FailLabel = AbortLabel;
+    if (!_CompileStatement(pExpr))
+      return false;
+    _Emit(BcExecHook);
+    return true;
+  }
+
+  //! This method resolves the labels, it returns the number of registers used.
+  u32 Finalize(void)
+  {
+    _Emit(BcEnd);
+    for (auto& rCode : m_rCodes)
+      rCode.m_Next = m_Labels[rCode.m_Next];
+    return m_MaxRegNo;
+  }
+
+  virtual Expression* VisitBind(Expression::List const& rExprList)
+  {
+    if (!m_IsStatement)
+      return _Invalidate();
+
+    for (Expression const* pExpr : rExprList)
+    {
+      u32 NextLabel = _NewLabel();
+      if (!_CompileRegion(pExpr, NextLabel))
+        return nullptr;
+      _Bind(NextLabel);
+    }
+    return nullptr;
+  }
+
+  virtual Expression* VisitCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr)
+  {
+    u16 CondReg;
+    if (_CompileCondition(Type, pRefExpr, pTestExpr, CondReg))
+      m_Oprd = Operand::MakeValue(CondReg, ConstantExpression::Const1Bit);
+    return nullptr;
+  }
+
+  virtual Expression* VisitIfCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr)
+  {
+    return _CompileIf(Type, pRefExpr, pTestExpr, pThenExpr, nullptr);
+  }
+
+  virtual Expression* VisitIfElseCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    return _CompileIf(Type, pRefExpr, pTestExpr, pThenExpr, pElseExpr);
+  }
+
+  // The interpreter executes the body of a while once, like an if
+  virtual Expression* VisitWhileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pBodyExpr)
+  {
+    return _CompileIf(Type, pRefExpr, pTestExpr, pBodyExpr, nullptr);
+  }
+
+  virtual Expression* VisitOperation(u32 Type, Expression const* pLeftExpr, Expression const* pRightExpr)
+  {
+    Operand Left, Right;
+    if (!_CompileOperand(pLeftExpr, Left) || !_CompileOperand(pRightExpr, Right))
+      return nullptr;
+
+    // The destination of an assignment isn't read
+    u16 LeftReg = 0;
+    if (Type != OperationExpression::OpAff)
+      LeftReg = _Read(Left, false);
+    u16 RightReg = _Read(Right, false);
+
+    _Hook(Left,  Emulator::HookOnWrite);
+    _Hook(Right, Emulator::HookOnRead);
+
+    u16 ResReg = 0;
+    u32 ResBit = Left.m_Bit;
+    switch (Type)
+    {
+    case OperationExpression::OpAff:
+      _Write(Left, RightReg);
+      break;
+
+    case OperationExpression::OpXchg:
+      _Write(Left, RightReg);
+      _Write(Right, LeftReg);
+      ResReg = LeftReg;
+      break;
+
+    case OperationExpression::OpSext:
+      {
+        // The size of the result must be known to compile the next operations
+        if (Right.m_Kind != Operand::Constant)
+          return _Invalidate();
+        ResBit = static_cast<u32>(Right.m_Value * 8);
+        ResReg = _NewReg();
+        auto& rCode = _Emit(BcSext, ResReg, _ReadSigned(Left, LeftReg));
+        rCode.m_Id   = Left.m_Bit;
+        rCode.m_Size = static_cast<u8>(ResBit);
+      }
+      break;
+
+    case OperationExpression::OpMul: ResReg = _NewReg(); _Emit(BcMul, ResReg, _ReadSigned(Left, LeftReg), RightReg).m_Imm = _ResultMask(ResBit); break;
+    case OperationExpression::OpArs: ResReg = _NewReg(); _Emit(BcArs, ResReg, _ReadSigned(Left, LeftReg), RightReg).m_Imm = _ResultMask(ResBit); break;
+
+    default:
+      {
+        Opcode Opc;
+        switch (Type)
+        {
+        case OperationExpression::OpAdd:  Opc = BcAdd; break;
+        case OperationExpression::OpSub:  Opc = BcSub; break;
+        case OperationExpression::OpUDiv:
+        case OperationExpression::OpSDiv: Opc = BcDiv; break;
+        case OperationExpression::OpAnd:  Opc = BcAnd; break;
+        case OperationExpression::OpOr:   Opc = BcOr;  break;
+        case OperationExpression::OpXor:  Opc = BcXor; break;
+        case OperationExpression::OpLls:  Opc = BcLls; break;
+        case OperationExpression::OpLrs:  Opc = BcLrs; break;
+        default:                          return _Invalidate();
+        }
+        ResReg = _NewReg();
+        _Emit(Opc, ResReg, LeftReg, RightReg).m_Imm = _ResultMask(ResBit);
+      }
+    }
+
+    m_Oprd = Operand::MakeValue(ResReg, ResBit);
+    return nullptr;
+  }
+
+  virtual Expression* VisitConstant(u32 Type, u64 Value)
+  {
+    u16 Reg = _NewReg();
+    _Emit(BcLoadImm, Reg).m_Imm = Value;
+    m_Oprd = Operand::MakeValue(Reg, Type);
+    m_Oprd.m_Kind  = Operand::Constant;
+    m_Oprd.m_Value = Value;
+    return nullptr;
+  }
+
+  virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo)
+  {
+    m_Oprd = Operand();
+    m_Oprd.m_Kind = Operand::Register;
+    m_Oprd.m_Id   = Id;
+    m_Oprd.m_Bit  = pCpuInfo->GetSizeOfRegisterInBit(Id);
+    return nullptr;
+  }
+
+  // When the address can't be computed, the interpreter doesn't stop: reading
+  // the memory fails, but writing it or testing its hooks is skipped
+  virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref)
+  {
+    u16 ValidReg = _NewReg();
+    _Emit(BcLoadImm, ValidReg);
+
+    u32 InvalidLabel = _NewLabel();
+    u32 PrevFailLabel = m_FailLabel;
+    m_FailLabel = InvalidLabel;
+
+    // The register 0 always holds 0, it's the base of memory without segment
+    Operand Base, Offset;
+    u16 BaseReg = 0;
+    if (pBaseExpr != nullptr)
+    {
+      if (!_CompileOperand(pBaseExpr, Base))
+        return nullptr;
+      BaseReg = _Read(Base, false);
+    }
+    if (!_CompileOperand(pOffsetExpr, Offset))
+      return nullptr;
+    u16 OffsetReg = _Read(Offset, false);
+
+    _Emit(BcLoadImm, ValidReg).m_Imm = 1;
+    _Bind(InvalidLabel);
+    m_FailLabel = PrevFailLabel;
+
+    m_Oprd = Operand();
+    m_Oprd.m_Kind      = Deref ? Operand::Memory : Operand::Address;
+    m_Oprd.m_BaseReg   = BaseReg;
+    m_Oprd.m_OffsetReg = OffsetReg;
+    m_Oprd.m_ValidReg  = ValidReg;
+    m_Oprd.m_Bit       = AccessSizeInBit;
+    return nullptr;
+  }
+
+  virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot)
+  {
+    if (SizeInBit != 0)
+    {
+      auto& rCode = _Emit(BcAllocVar);
+      rCode.m_Id   = Slot;
+      rCode.m_Size = static_cast<u8>(SizeInBit);
+    }
+    m_Oprd = Operand();
+    m_Oprd.m_Kind = Operand::Variable;
+    m_Oprd.m_Id   = Slot;
+    m_Oprd.m_Bit  = SizeInBit;
+    return nullptr;
+  }
+
+private:
+  struct Operand
+  {
+    enum Kind { Value, Constant, Register, Variable, Memory, Address };
+
+    Operand(void) : m_Kind(Value), m_Reg(0), m_BaseReg(0), m_OffsetReg(0), m_ValidReg(0), m_Id(0), m_Bit(0), m_Value(0) {}
+
+    static Operand MakeValue(u16 Reg, u32 Bit)
+    {
+      Operand Oprd;
+      Oprd.m_Reg = Reg;
+      Oprd.m_Bit = Bit;
+      return Oprd;
+    }
+
+    Kind m_Kind;
+    u16  m_Reg;
+    u16  m_BaseReg;
+    u16  m_OffsetReg;
+    u16  m_ValidReg;
+    u32  m_Id;
+    u32  m_Bit;
+    u64  m_Value;
+  };
+
+  Code& _Emit(Opcode Opc, u16 Dst = 0, u16 Src0 = 0, u16 Src1 = 0)
+  {
+    Code NewCode;
+    NewCode.m_Opcode = static_cast<u8>(Opc);
+    NewCode.m_Size   = 0;
+    NewCode.m_Dst    = Dst;
+    NewCode.m_Src0   = Src0;
+    NewCode.m_Src1   = Src1;
+    NewCode.m_Id     = 0;
+    NewCode.m_Next   = m_FailLabel;
+    NewCode.m_Imm    = 0;
+    m_rCodes.push_back(NewCode);
+    return m_rCodes.back();
+  }
+
+  // The interpreter stores the result of an operation in a constant of the size of the left operand
+  static u64 _ResultMask(u32 Bit)
+  {
+    if (Bit == ConstantExpression::ConstUnknownBit || Bit >= 64)
+      return ~0ULL;
+    return (1ULL << Bit) - 1;
+  }
+
+  u16 _NewReg(void)
+  {
+    if (m_RegNo == MaxRegNo)
+    {
+      m_IsValid = false;
+      return 0;
+    }
+    u16 Reg = static_cast<u16>(m_RegNo++);
+    if (m_RegNo > m_MaxRegNo)
+      m_MaxRegNo = m_RegNo;
+    return Reg;
+  }
+
+  u32  _NewLabel(void)      { m_Labels.push_back(AbortIndex); return static_cast<u32>(m_Labels.size() - 1); }
+  void _Bind(u32 Label)     { m_Labels[Label] = static_cast<u32>(m_rCodes.size()); }
+  Expression* _Invalidate(void) { m_IsValid = false; return nullptr; }
+
+  bool _CompileStatement(Expression const* pExpr)
+  {
+    m_IsStatement = true;
+    pExpr->Visit(this);
+    return m_IsValid;
+  }
+
+  //! This method compiles a statement whose failure only skips it.
+  bool _CompileRegion(Expression const* pExpr, u32 FailLabel)
+  {
+    u32 PrevFailLabel = m_FailLabel;
+    m_FailLabel = FailLabel;
+    bool Res = _CompileStatement(pExpr);
+    m_FailLabel = PrevFailLabel;
+    return Res;
+  }
+
+  bool _CompileOperand(Expression const* pExpr, Operand& rOprd)
+  {
+    if (pExpr == nullptr)
+    {
+      m_IsValid = false;
+      return false;
+    }
+    m_IsStatement = false;
+    m_Oprd = Operand();
+    pExpr->Visit(this);
+    rOprd = m_Oprd;
+    return m_IsValid;
+  }
+
+  bool _CompileCondition(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, u16& rCondReg)
+  {
+    Operand Ref, Test;
+    if (!_CompileOperand(pRefExpr, Ref) || !_CompileOperand(pTestExpr, Test))
+      return false;
+    // A condition ignores the result of reading its operands, a failed read gives 0
+    u32 ReadLabel = _NewLabel();
+    u32 PrevFailLabel = m_FailLabel;
+    m_FailLabel = ReadLabel;
+    u16 RefReg = _Read(Ref, true);
+    _Bind(ReadLabel);
+    ReadLabel = _NewLabel();
+    m_FailLabel = ReadLabel;
+    u16 TestReg = _Read(Test, true);
+    _Bind(ReadLabel);
+    m_FailLabel = PrevFailLabel;
+    rCondReg = _NewReg();
+    _Emit(BcCmp, rCondReg, RefReg, TestReg).m_Size = static_cast<u8>(Type);
+    return m_IsValid;
+  }
+
+  Expression* _CompileIf(u32 Type, Expression const* pRefExpr, Expression const* pTestExpr, Expression const* pThenExpr, Expression const* pElseExpr)
+  {
+    if (!m_IsStatement)
+      return _Invalidate();
+
+    u16 CondReg;
+    if (!_CompileCondition(Type, pRefExpr, pTestExpr, CondReg))
+      return nullptr;
+
+    u32 ElseLabel = _NewLabel();
+    u32 EndLabel  = _NewLabel();
+    _Emit(BcJz, 0, CondReg).m_Next = pElseExpr != nullptr ? ElseLabel : EndLabel;
+    if (!_CompileRegion(pThenExpr, EndLabel))
+      return nullptr;
+    if (pElseExpr != nullptr)
+    {
+      _Emit(BcJmp).m_Next = EndLabel;
+      _Bind(ElseLabel);
+      if (!_CompileRegion(pElseExpr, EndLabel))
+        return nullptr;
+    }
+    _Bind(EndLabel);
+    return nullptr;
+  }
+
+  u16 _Read(Operand const& rOprd, bool SignExtend)
+  {
+    u16 Reg;
+    switch (rOprd.m_Kind)
+    {
+    case Operand::Register:
+      Reg = _NewReg();
+      {
+        auto& rCode = _Emit(SignExtend ? BcReadRegSx : BcReadReg, Reg);
+        rCode.m_Id   = rOprd.m_Id;
+        rCode.m_Size = static_cast<u8>(rOprd.m_Bit / 8);
+      }
+      return Reg;
+
+    case Operand::Variable:
+      Reg = _NewReg();
+      _Emit(BcReadVar, Reg).m_Id = rOprd.m_Id;
+      return Reg;
+
+    case Operand::Memory:
+    case Operand::Address:
+      Reg = _NewReg();
+      {
+        auto& rCode = _Emit(rOprd.m_Kind == Operand::Memory ? BcReadMem : BcAddrOf, Reg, rOprd.m_BaseReg, rOprd.m_OffsetReg);
+        rCode.m_Id   = rOprd.m_ValidReg;
+        rCode.m_Size = static_cast<u8>(rOprd.m_Bit / 8);
+      }
+      return Reg;
+
+    default:
+      return rOprd.m_Reg;
+    }
+  }
+
+  //! This method gives the left operand of a signed operation, only registers are read differently.
+  u16 _ReadSigned(Operand const& rOprd, u16 UnsignedReg)
+  {
+    if (rOprd.m_Kind != Operand::Register)
+      return UnsignedReg;
+    return _Read(rOprd, true);
+  }
+
+  // Like ContextExpression::Write, a failed write doesn't stop the execution.
+  // Writing a constant does nothing and, like the interpreter built without
+  // assertions, writing an address writes the memory it points to.
+  void _Write(Operand const& rOprd, u16 SrcReg)
+  {
+    switch (rOprd.m_Kind)
+    {
+    case Operand::Register:
+      {
+        auto& rCode = _Emit(BcWriteReg, 0, SrcReg);
+        rCode.m_Id   = rOprd.m_Id;
+        rCode.m_Size = static_cast<u8>(rOprd.m_Bit / 8);
+      }
+      break;
+
+    case Operand::Variable:
+      _Emit(BcWriteVar, 0, SrcReg).m_Id = rOprd.m_Id;
+      break;
+
+    case Operand::Memory:
+    case Operand::Address:
+      {
+        auto& rCode = _Emit(BcWriteMem, SrcReg, rOprd.m_BaseReg, rOprd.m_OffsetReg);
+        rCode.m_Id   = rOprd.m_ValidReg;
+        rCode.m_Size = static_cast<u8>(rOprd.m_Bit / 8);
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void _Hook(Operand const& rOprd, u32 Type)
+  {
+    if (rOprd.m_Kind == Operand::Memory || rOprd.m_Kind == Operand::Address)
+    {
+      auto& rCode = _Emit(BcHook, 0, rOprd.m_BaseReg, rOprd.m_OffsetReg);
+      rCode.m_Id   = rOprd.m_ValidReg;
+      rCode.m_Size = static_cast<u8>(Type);
+    }
+  }
+
+  std::vector<Code>& m_rCodes;
+  std::vector<u32>   m_Labels;
+  u32                m_FailLabel;
+  u32                m_RegNo;
+  u32                m_MaxRegNo;
+  bool               m_IsStatement;
+  bool               m_IsValid;
+  Operand            m_Oprd;
+};
+
+BytecodeEmulator::BytecodeEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt)
+: Emulator(pCpuInfo, pCpuCtxt, pMemCtxt, new VariableContext)
+{
+}
+
+BytecodeEmulator::~BytecodeEmulator(void)
+{
+  delete m_pVarCtxt;
+}
+
+bool BytecodeEmulator::Execute(Address const& rAddress, Expression const& rExpr)
+{
+  auto& rProg = m_Expressions[rAddress];
+  if (rProg.m_Codes.empty())
+  {
+    Expression::List ExprList(1, const_cast<Expression*>(&rExpr));
+    if (!_Compile(rAddress, ExprList, rProg))
+    {
+      m_Expressions.erase(rAddress);
+      return false;
+    }
+  }
+  return _Run(rProg);
+}
+
+bool BytecodeEmulator::Execute(Address const& rAddress, Expression::List const& rExprList)
+{
+  auto& rProg = m_Lists[rAddress];
+  if (rProg.m_Codes.empty() || rProg.m_StmtNo != rExprList.size())
+  {
+    if (!_Compile(rAddress, rExprList, rProg))
+    {
+      m_Lists.erase(rAddress);
+      return false;
+    }
+  }
+  return _Run(rProg);
+}
+
+bool BytecodeEmulator::_Compile(Address const& rAddress, Expression::List const& rExprList, Program& rProg)
+{
+  rProg.m_Codes.clear();
+  Compiler Cmplr(rProg.m_Codes);
+  for (Expression const* pExpr : rExprList)
+  {
+    if (!Cmplr.AddStatement(pExpr))
+    {
+      Log::Write("emul_bytecode") << "unable to compile at " << rAddress.ToString() << ": " << pExpr->ToString() << LogEnd;
+      return false;
+    }
+  }
+  rProg.m_RegNo  = Cmplr.Finalize();
+  rProg.m_StmtNo = static_cast<u32>(rExprList.size());
+  if (m_Regs.size() < rProg.m_RegNo)
+    m_Regs.resize(rProg.m_RegNo);
+  return true;
+}
+
+bool BytecodeEmulator::_Run(Program const& rProg)
+{
+  Code const* pCodes = rProg.m_Codes.data();
+  u64* pRegs = m_Regs.data();
+  pRegs[0] = 0;
+
+  u32 Idx = 0;
+  while (true)
+  {
+    Code const& rCode = pCodes[Idx++];
+    u64& rDst = pRegs[rCode.m_Dst];
+    u64 Src0  = pRegs[rCode.m_Src0];
+    u64 Src1  = pRegs[rCode.m_Src1];
+    bool Failed = false;
+
+    switch (rCode.m_Opcode)
+    {
+    case BcEnd:     return true;
+    case BcJmp:     Idx = rCode.m_Next; break;
+    case BcJz:      if (Src0 == 0) Idx = rCode.m_Next; break;
+    case BcLoadImm: rDst = rCode.m_Imm; break;
+
+    case BcReadReg:
+    case BcReadRegSx:
+      {
+        u64 Value = 0;
+        rDst = 0;
+        if (!m_pCpuCtxt->ReadRegister(rCode.m_Id, &Value, rCode.m_Size))
+        {
+          Failed = true;
+          break;
+        }
+        if (rCode.m_Opcode == BcReadRegSx) switch (rCode.m_Size)
+        {
+        case 1: Value = SignExtend<s64,  8>(Value); break;
+        case 2: Value = SignExtend<s64, 16>(Value); break;
+        case 4: Value = SignExtend<s64, 32>(Value); break;
+        }
+        rDst = Value;
+      }
+      break;
+
+    case BcWriteReg:
+      m_pCpuCtxt->WriteRegister(rCode.m_Id, &Src0, rCode.m_Size);
+      break;
+
+    case BcReadVar:  rDst = 0; Failed = !m_pVarCtxt->ReadVariable(rCode.m_Id, rDst); break;
+    case BcWriteVar: m_pVarCtxt->WriteVariable(rCode.m_Id, Src0); break;
+    case BcAllocVar: Failed = !m_pVarCtxt->AllocateVariable(rCode.m_Size, rCode.m_Id); break;
+
+    case BcReadMem:
+    case BcWriteMem:
+    case BcAddrOf:
+      {
+        if (pRegs[rCode.m_Id] == 0)
+        {
+          if (rCode.m_Opcode == BcWriteMem)
+            break;
+          rDst = 0;
+          Failed = true;
+          break;
+        }
+
+        Address MemAddr(static_cast<u16>(Src0), Src1);
+        u64 LinAddr;
+        if (!m_pCpuCtxt->Translate(MemAddr, LinAddr))
+          LinAddr = MemAddr.GetOffset();
+
+        if (rCode.m_Opcode == BcAddrOf)
+          rDst = LinAddr;
+        else if (rCode.m_Opcode == BcWriteMem)
+          m_pMemCtxt->WriteMemory(LinAddr, &rDst, rCode.m_Size);
+        else
+        {
+          u64 Value = 0;
+          Failed = !m_pMemCtxt->ReadMemory(LinAddr, &Value, rCode.m_Size);
+          rDst = Value;
+        }
+      }
+      break;
+
+    case BcHook:
+      if (!m_Hooks.empty() && pRegs[rCode.m_Id] != 0)
+        TestHook(Address(static_cast<u16>(Src0), Src1), rCode.m_Size);
+      break;
+
+    case BcExecHook:
+      if (!m_Hooks.empty())
+      {
+        auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister, m_pCpuCtxt->GetMode());
+        auto RegSz = m_pCpuInfo->GetSizeOfRegisterInBit(RegPc) / 8;
+        u64 CurPc  = 0;
+        m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
+        TestHook(Address(CurPc), Emulator::HookOnExecute);
+      }
+      break;
+
+    // m_Imm holds the mask of the result
+    case BcAdd: rDst = (Src0 +  Src1) & rCode.m_Imm; break;
+    case BcSub: rDst = (Src0 -  Src1) & rCode.m_Imm; break;
+    case BcMul: rDst = (static_cast<s64>(Src0) * Src1) & rCode.m_Imm; break;
+    case BcAnd: rDst = (Src0 &  Src1) & rCode.m_Imm; break;
+    case BcOr:  rDst = (Src0 |  Src1) & rCode.m_Imm; break;
+    case BcXor: rDst = (Src0 ^  Src1) & rCode.m_Imm; break;
+    case BcLls: rDst = (Src0 << Src1) & rCode.m_Imm; break;
+    case BcLrs: rDst = (Src0 >> Src1) & rCode.m_Imm; break;
+    case BcArs: rDst = (static_cast<s64>(Src0) >> Src1) & rCode.m_Imm; break;
+
+    // The interpreter lets the host trap on a division by zero, here it only fails
+    case BcDiv:
+      if (Src1 == 0)
+        Failed = true;
+      else
+        rDst = (Src0 / Src1) & rCode.m_Imm;
+      break;
+
+    case BcSext: rDst = SignExtendValue(Src0, rCode.m_Id, rCode.m_Size); break;
+    case BcCmp:  rDst = EvaluateCondition(rCode.m_Size, Src0, Src1) ? 1 : 0; break;
+
+    default:
+      return false;
+    }
+
+    if (Failed)
+    {
+      Idx = rCode.m_Next;
+      if (Idx == AbortIndex)
+        return false;
+    }
+  }
+}
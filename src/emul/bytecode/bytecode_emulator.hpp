@@ -0,0 +1,100 @@
+#ifndef _EMUL_BYTECODE_
+#define _EMUL_BYTECODE_
+
+#include <medusa/emulation.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32) || defined(WIN32)
+# ifdef emul_bytecode_EXPORTS
+#  define EMUL_BYTECODE_EXPORT __declspec(dllexport)
+# else
+#  define EMUL_BYTECODE_EXPORT __declspec(dllimport)
+# endif
+#else
+# define EMUL_BYTECODE_EXPORT
+#endif
+
+MEDUSA_NAMESPACE_USE
+
+extern "C" EMUL_BYTECODE_EXPORT Emulator* GetEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt);
+
+/*!
+ * BytecodeEmulator gives the same results as InterpreterEmulator, but it
+ * compiles the semantic executed at an address into a linear register-based
+ * bytecode the first time it sees it. Later executions at this address only
+ * run the bytecode, which doesn't allocate anything.
+ *
+ * The semantic executed at an address is expected not to change, which is
+ * the case for the blocks built by Execution. A list with a different number
+ * of statements is compiled again.
+ */
+class BytecodeEmulator : public Emulator
+{
+public:
+  BytecodeEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt);
+  virtual ~BytecodeEmulator(void);
+
+  virtual std::string GetName(void) const { return "bytecode"; }
+
+  virtual bool Execute(Address const& rAddress, Expression const& rExpr);
+  virtual bool Execute(Address const& rAddress, Expression::List const& rExprList);
+
+private:
+  enum Opcode
+  {
+    BcEnd,
+    BcJmp,      // jump to m_Next
+    BcJz,       // jump to m_Next if Src0 is zero
+    BcLoadImm,  // Dst = m_Imm
+    BcReadReg,  // Dst = register m_Id
+    BcReadRegSx,// Dst = register m_Id sign extended, like a condition reads it
+    BcWriteReg, // register m_Id = Src0
+    BcReadVar,  // Dst = variable m_Id
+    BcWriteVar, // variable m_Id = Src0
+    BcAllocVar, // allocate variable m_Id with type m_Size
+    BcReadMem,  // Dst = memory at Src0:Src1, m_Id is the register telling if the address is valid
+    BcWriteMem, // memory at Src0:Src1 = Dst
+    BcAddrOf,   // Dst = linear address of Src0:Src1
+    BcHook,     // call the hook at Src0:Src1 for the type m_Size
+    BcExecHook, // call the execute hook at the current program pointer
+    BcAdd, BcSub, BcMul, BcDiv, BcAnd, BcOr, BcXor, BcLls, BcLrs, BcArs, // Dst = Src0 op Src1 masked with m_Imm
+    BcSext,     // Dst = Src0 extended from m_Id bits to m_Size bits
+    BcCmp,      // Dst = Src0 compared with Src1 using the condition m_Size
+  };
+
+  //! Code is one instruction of the bytecode, m_Next is the jump target or where to go when it fails
+  struct Code
+  {
+    u8  m_Opcode;
+    u8  m_Size;
+    u16 m_Dst;
+    u16 m_Src0;
+    u16 m_Src1;
+    u32 m_Id;
+    u32 m_Next;
+    u64 m_Imm;
+  };
+
+  struct Program
+  {
+    Program(void) : m_StmtNo(0), m_RegNo(0) {}
+
+    std::vector<Code> m_Codes;
+    u32               m_StmtNo;
+    u32               m_RegNo;
+  };
+
+  class Compiler;
+
+  bool _Compile(Address const& rAddress, Expression::List const& rExprList, Program& rProg);
+  bool _Run(Program const& rProg);
+
+  typedef std::unordered_map<Address, Program> ProgramMap;
+  ProgramMap       m_Lists;       /*! This map holds the programs of the lists executed at an address */
+  ProgramMap       m_Expressions; /*! This map holds the programs of the single expressions executed at an address */
+  std::vector<u64> m_Regs;
+};
+
+#endif // !_EMUL_BYTECODE_
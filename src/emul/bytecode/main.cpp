@@ -0,0 +1,5 @@
+#include "bytecode_emulator.hpp"
+
+Emulator* GetEmulator(CpuInformation const* pCpuInfo, CpuContext* pCpuCtxt, MemoryContext *pMemCtxt) { return new BytecodeEmulator(pCpuInfo, pCpuCtxt, pMemCtxt); }
+
+int main(void) { return 0; }
\ No newline at end of file
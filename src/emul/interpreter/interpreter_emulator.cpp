@@ -15,9 +15,7 @@ InterpreterEmulator::~InterpreterEmulator(void)
 bool InterpreterEmulator::Execute(Address const& rAddress, Expression const& rExpr)
 {
   InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt);
-  auto pCurExpr = rExpr.Visit(&Visitor);
-
-  if (pCurExpr == nullptr)
+  if (!_Evaluate(Visitor, rExpr))
     return false;
 
   auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister, m_pCpuCtxt->GetMode());
@@ -25,7 +23,6 @@ bool InterpreterEmulator::Execute(Address const& rAddress, Expression const& rEx
   u64 CurPc  = 0;
   m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
   TestHook(Address(CurPc), Emulator::HookOnExecute);
-  delete pCurExpr;
   return true;
 }
 
@@ -34,8 +31,7 @@ bool InterpreterEmulator::Execute(Address const& rAddress, Expression::List cons
   InterpreterExpressionVisitor Visitor(m_Hooks, m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt);
   for (Expression* pExpr : rExprList)
   {
-    auto pCurExpr = pExpr->Visit(&Visitor);
-    if (pCurExpr == nullptr)
+    if (!_Evaluate(Visitor, *pExpr))
       return false;
 
     auto RegPc = m_pCpuInfo->GetRegisterByType(CpuInformation::ProgramPointerRegister, m_pCpuCtxt->GetMode());
@@ -43,11 +39,24 @@ bool InterpreterEmulator::Execute(Address const& rAddress, Expression::List cons
     u64 CurPc = 0;
     m_pCpuCtxt->ReadRegister(RegPc, &CurPc, RegSz);
     TestHook(Address(CurPc), Emulator::HookOnExecute);
-    delete pCurExpr;
   }
   return true;
 }
 
+bool InterpreterEmulator::_Evaluate(InterpreterExpressionVisitor& rVisitor, Expression const& rExpr)
+{
+  // The expressions returned by the visitor only live during the evaluation of one statement
+  bool Res;
+  {
+    ExpressionArena::Scope TmpScope(&m_TmpArena);
+    auto pCurExpr = rExpr.Visit(&rVisitor);
+    Res = pCurExpr != nullptr;
+    delete pCurExpr;
+  }
+  m_TmpArena.Reset();
+  return Res;
+}
+
 Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitBind(Expression::List const& rExprList)
 {
   Expression::List SmplExprList;
@@ -254,18 +263,23 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitOperation(u3
   }
 
   Address LeftAddress, RightAddress;
-  if (pLeft->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, LeftAddress) == true)
   {
-    auto itHook = m_rHooks.find(LeftAddress);
-    if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnWrite)
-      itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
-  }
+    // Hooks are not aware of the temporary arena, what they build must outlive the statement
+    ExpressionArena::Scope HookScope(nullptr);
 
-  if (pRight->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, RightAddress) == true)
-  {
-    auto itHook = m_rHooks.find(RightAddress);
-    if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnRead)
-      itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
+    if (pLeft->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, LeftAddress) == true)
+    {
+      auto itHook = m_rHooks.find(LeftAddress);
+      if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnWrite)
+        itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
+    }
+
+    if (pRight->GetAddress(m_pCpuCtxt, m_pMemCtxt, m_pVarCtxt, RightAddress) == true)
+    {
+      auto itHook = m_rHooks.find(RightAddress);
+      if (itHook != std::end(m_rHooks) && itHook->second.m_Type & Emulator::HookOnRead)
+        itHook->second.m_Callback(m_pCpuCtxt, m_pMemCtxt);
+    }
   }
 
   u64 SignedLeft = 0;
@@ -330,9 +344,9 @@ Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitMemory(u32 A
   return new MemoryExpression(AccessSizeInBit, pBaseExprVisited, pOffsetExprVisited, Deref);
 }
 
-Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitVariable(u32 Type, std::string const& rName)
+Expression* InterpreterEmulator::InterpreterExpressionVisitor::VisitVariable(u32 Type, u32 Slot)
 {
-  if (Type && m_pVarCtxt->AllocateVariable(Type, rName) == false)
+  if (Type && m_pVarCtxt->AllocateVariable(Type, Slot) == false)
     return nullptr;
-  return new VariableExpression(Type, rName);
+  return new VariableExpression(Type, Slot);
 }
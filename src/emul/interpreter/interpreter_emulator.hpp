@@ -45,7 +45,7 @@ private:
     virtual Expression* VisitConstant(u32 Type, u64 Value);
     virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo);
     virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref);
-    virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName);
+    virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot);
 
   protected:
     HookAddressHashMap const& m_rHooks;
@@ -53,6 +53,10 @@ private:
     MemoryContext*            m_pMemCtxt;
     VariableContext*          m_pVarCtxt;
   };
+
+  bool _Evaluate(InterpreterExpressionVisitor& rVisitor, Expression const& rExpr);
+
+  ExpressionArena m_TmpArena;
 };
 
 #endif // !_EMUL_INTERPRETER_
\ No newline at end of file
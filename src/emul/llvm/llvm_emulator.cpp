@@ -183,24 +183,26 @@ LlvmEmulator::LlvmVariableContext::LlvmVariableContext(llvm::IRBuilder<>& rBuild
 {
 }
 
-bool LlvmEmulator::LlvmVariableContext::ReadVariable(std::string const& rVariableName, u64& rValue) const
+bool LlvmEmulator::LlvmVariableContext::ReadVariable(u32 Slot, u64& rValue) const
 {
   return false;
 }
 
-bool LlvmEmulator::LlvmVariableContext::WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend)
+bool LlvmEmulator::LlvmVariableContext::WriteVariable(u32 Slot, u64 Value, bool SignExtend)
 {
   return false;
 }
 
-bool LlvmEmulator::LlvmVariableContext::AllocateVariable(u32 Type, std::string const& rVariableName)
+bool LlvmEmulator::LlvmVariableContext::AllocateVariable(u32 Type, u32 Slot)
 {
-  FreeVariable(rVariableName);
+  FreeVariable(Slot);
 
-  auto pAlloca = m_rBuilder.CreateAlloca(llvm::Type::getIntNTy(llvm::getGlobalContext(), Type), 0, rVariableName);
+  auto pAlloca = m_rBuilder.CreateAlloca(llvm::Type::getIntNTy(llvm::getGlobalContext(), Type), 0, GetVariableName(Slot));
   auto pVarVal = m_rBuilder.CreateBitCast(pAlloca, llvm::Type::getIntNPtrTy(llvm::getGlobalContext(), Type));
 
-  m_Variables[rVariableName] = VariableInformation(Type, pVarVal);
+  if (Slot >= m_Variables.size())
+    m_Variables.resize(Slot + 1);
+  m_Variables[Slot] = VariableInformation(Type, pVarVal);
   return true;
 }
 
@@ -498,15 +500,15 @@ Expression* LlvmEmulator::LlvmExpressionVisitor::VisitMemory(u32 AccessSizeInBit
   return nullptr; // TODO
 }
 
-Expression* LlvmEmulator::LlvmExpressionVisitor::VisitVariable(u32 SizeInBit, std::string const& rName)
+Expression* LlvmEmulator::LlvmExpressionVisitor::VisitVariable(u32 SizeInBit, u32 Slot)
 {
   if (SizeInBit)
   {
-    m_pVarCtxt->AllocateVariable(SizeInBit, rName);
+    m_pVarCtxt->AllocateVariable(SizeInBit, Slot);
     return nullptr;
   }
 
-  auto pVarPtrVal = reinterpret_cast<llvm::Value*>(m_pVarCtxt->GetVariable(rName));
+  auto pVarPtrVal = reinterpret_cast<llvm::Value*>(m_pVarCtxt->GetVariable(Slot));
   if (pVarPtrVal == nullptr)
   {
     assert(0 && "Unknown variable");
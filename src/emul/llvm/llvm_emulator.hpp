@@ -69,10 +69,10 @@ private:
   public:
     LlvmVariableContext(llvm::IRBuilder<>& rBuilder);
 
-    virtual bool ReadVariable(std::string const& rVariableName, u64& rValue) const;
-    virtual bool WriteVariable(std::string const& rVariableName, u64 Value, bool SignExtend = false);
+    virtual bool ReadVariable(u32 Slot, u64& rValue) const;
+    virtual bool WriteVariable(u32 Slot, u64 Value, bool SignExtend = false);
 
-    virtual bool AllocateVariable(u32 Type, std::string const& rVariableName);
+    virtual bool AllocateVariable(u32 Type, u32 Slot);
 
     virtual std::string ToString(void) const;
 
@@ -97,7 +97,7 @@ private:
     virtual Expression* VisitConstant(u32 Type, u64 Value);
     virtual Expression* VisitIdentifier(u32 Id, CpuInformation const* pCpuInfo);
     virtual Expression* VisitMemory(u32 AccessSizeInBit, Expression const* pBaseExpr, Expression const* pOffsetExpr, bool Deref);
-    virtual Expression* VisitVariable(u32 SizeInBit, std::string const& rName);
+    virtual Expression* VisitVariable(u32 SizeInBit, u32 Slot);
 
     void ClearValues(void);
 
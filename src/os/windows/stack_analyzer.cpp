@@ -1,5 +1,7 @@
 ﻿#include "stack_analyzer.hpp"
 
+#include <boost/format.hpp>
+
 Expression* ExpressionVisitor_FindOperations::VisitBind(Expression::List const& rExprList)
 {
   for (auto itSem = std::begin(rExprList); itSem != std::end(rExprList); ++itSem)
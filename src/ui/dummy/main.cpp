@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <limits>
 #include <boost/foreach.hpp>
+#include <boost/format.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/filesystem/path.hpp>
 
@@ -67,6 +68,9 @@ public:
     if (c.empty())
       throw std::runtime_error("Nothing to ask!");
 
+    // Logs are written asynchronously, they must not be mixed with the question
+    Log::Flush();
+
     while (true)
     {
       size_t Count = 0;
@@ -262,9 +266,10 @@ int main(int argc, char **argv)
 
     auto& mod_mgr = ModuleManager::Instance();
 
-    mod_mgr.LoadModules(L".", *bin_strm);
+    mod_mgr.LoadModules(L".");
 
-    if (mod_mgr.GetLoaders().empty())
+    auto ldrs = mod_mgr.GetLoaders(*bin_strm);
+    if (ldrs.empty())
     {
       std::cerr << "Not loader available" << std::endl;
       return EXIT_FAILURE;
@@ -272,7 +277,7 @@ int main(int argc, char **argv)
 
     std::cout << "Choose a executable format:" << std::endl;
     AskFor<Loader::VectorSharedPtr::value_type, Loader::VectorSharedPtr> AskForLoader;
-    Loader::VectorSharedPtr::value_type ldr = AskForLoader(mod_mgr.GetLoaders());
+    Loader::VectorSharedPtr::value_type ldr = AskForLoader(ldrs);
     std::cout << "Interpreting executable format using \"" << ldr->GetName() << "\"..." << std::endl;
     std::cout << std::endl;
 
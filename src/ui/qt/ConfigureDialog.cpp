@@ -109,8 +109,7 @@ void ConfigureDialog::_GetDefaultModules(void)
 {
   medusa::ModuleManager& rModMgr = medusa::ModuleManager::Instance();
 
-  rModMgr.UnloadModules();
-  rModMgr.LoadModules(m_ModulePath.toStdWString(), *m_spBinaryStream);
+  rModMgr.LoadModules(m_ModulePath.toStdWString());
 
   // Database
   auto const& rDbs = rModMgr.GetDatabases();
@@ -119,7 +118,7 @@ void ConfigureDialog::_GetDefaultModules(void)
   m_spDatabase = rDbs.front();
 
   // Loader
-  auto const& rLdrs = rModMgr.GetLoaders();
+  auto const& rLdrs = rModMgr.GetLoaders(*m_spBinaryStream);
   if (rLdrs.empty())
     return;
   for (auto itLdr = std::begin(rLdrs), itEnd = std::end(rLdrs); itLdr != itEnd; ++itLdr)
@@ -238,7 +237,7 @@ void ConfigureDialog::_DisplayDocumentOptions(void)
     ConfigurationLayout->addWidget(pDbCmbBox);
   }
 
-  auto const& rLdrs = rModMgr.GetLoaders();
+  auto const& rLdrs = rModMgr.GetLoaders(*m_spBinaryStream);
   if (!rLdrs.empty())
   {
     auto pLdrCmbBox = new QComboBox;
@@ -251,7 +250,7 @@ void ConfigureDialog::_DisplayDocumentOptions(void)
     connect(pLdrCmbBox, static_cast<void (QComboBox::*)(QString const&)>(&QComboBox::currentIndexChanged), [&](QString const& rLdrName)
     {
       auto& rModMgr = medusa::ModuleManager::Instance();
-      auto AllLdrs = rModMgr.GetLoaders();
+      auto AllLdrs = rModMgr.GetLoaders(*m_spBinaryStream);
       auto itLdr = std::find_if(std::begin(AllLdrs), std::end(AllLdrs), [&rLdrName](medusa::Loader::SharedPtr spLdr)
       { return spLdr->GetName() == rLdrName.toStdString(); });
       if (itLdr == std::end(AllLdrs))
@@ -20,18 +20,20 @@ medusa::u32 DisassemblyPrinter::PrintCell(medusa::Address const& rAddress, medus
   QColor clr;
   QString lineStr = "** invalid line **";
 
-  std::string str;
-  medusa::Cell::Mark::List marks;
-  if (m_rCore.FormatCell(rAddress, *curCell, str, marks) == false)
+  m_CellText.Clear();
+  if (m_rCore.FormatCell(rAddress, *curCell, m_CellText) == false)
     return 0;
 
+  auto const& str   = m_CellText.GetText();
+  auto const& marks = m_CellText.GetMarks();
+
   if (marks.empty())
     return 0;
 
   std::for_each(std::begin(marks), std::end(marks), [&](medusa::Cell::Mark const& mark)
   {
     QColor cellClr(Qt::black);
-    QString cellStr = QString::fromUtf8(str.substr(offset, mark.GetLength()).c_str());
+    QString cellStr = QString::fromUtf8(str.c_str() + offset, mark.GetLength());
 
     switch (mark.GetType())
     {
@@ -167,9 +167,10 @@ int main(int argc, char **argv)
 
     auto& mod_mgr = ModuleManager::Instance();
 
-    mod_mgr.LoadModules(L".", *bin_strm);
+    mod_mgr.LoadModules(L".");
 
-    if (mod_mgr.GetLoaders().empty())
+    auto ldrs = mod_mgr.GetLoaders(*bin_strm);
+    if (ldrs.empty())
     {
       std::cerr << "Not loader available" << std::endl;
       return EXIT_FAILURE;
@@ -177,7 +178,7 @@ int main(int argc, char **argv)
 
     std::cout << "Choose a executable format:" << std::endl;
     AskFor<Loader::VectorSharedPtr::value_type, Loader::VectorSharedPtr> AskForLoader;
-    Loader::VectorSharedPtr::value_type ldr = AskForLoader(mod_mgr.GetLoaders());
+    Loader::VectorSharedPtr::value_type ldr = AskForLoader(ldrs);
     std::cout << "Interpreting executable format using \"" << ldr->GetName() << "\"..." << std::endl;
     std::cout << std::endl;
 
@@ -21,6 +21,7 @@
 #include <medusa/disassembly_view.hpp>
 #include <medusa/view.hpp>
 #include <medusa/module.hpp>
+#include <medusa/mutex.hpp>
 
 MEDUSA_NAMESPACE_USE
 
@@ -39,6 +40,9 @@ public:
     if (c.empty())
       throw std::runtime_error("Nothing to ask!");
 
+    // Logs are written asynchronously, they must not be mixed with the question
+    Log::Flush();
+
     while (true)
     {
       size_t Count = 0;
@@ -138,6 +142,28 @@ void TextLog(std::string const & rMsg)
   std::cout << rMsg << std::flush;
 }
 
+void DumpLockStatistics(void)
+{
+  if (!LockProfiler::IsEnabled())
+    return;
+
+  // Durations are recorded in nanoseconds, microseconds are easier to read here
+  std::cout << "Lock statistics (wait and hold times in us):" << std::endl;
+  std::cout << std::left << std::setw(28) << "name" << std::right
+    << std::setw(12) << "acquired" << std::setw(12) << "contended"
+    << std::setw(14) << "total wait" << std::setw(12) << "max wait"
+    << std::setw(14) << "total hold" << std::setw(12) << "max hold" << std::endl;
+
+  for (auto const& rStat : LockProfiler::GetStatistics())
+  {
+    std::cout << std::dec << std::left << std::setw(28) << rStat.m_Name << std::right
+      << std::setw(12) << rStat.m_AcquisitionNo << std::setw(12) << rStat.m_ContendedNo
+      << std::setw(14) << rStat.m_TotalWait / 1000 << std::setw(12) << rStat.m_MaxWait / 1000
+      << std::setw(14) << rStat.m_TotalHold / 1000 << std::setw(12) << rStat.m_MaxHold / 1000 << std::endl;
+  }
+  std::cout << std::endl;
+}
+
 int main(int argc, char **argv)
 {
   std::cout.sync_with_stdio(false);
@@ -177,10 +203,10 @@ int main(int argc, char **argv)
       {
       auto& mod_mgr = ModuleManager::Instance();
 
-      mod_mgr.UnloadModules();
-      mod_mgr.LoadModules(mod_path, *spBinStrm);
+      mod_mgr.LoadModules(mod_path);
 
-      if (mod_mgr.GetLoaders().empty())
+      auto ldrs = mod_mgr.GetLoaders(*spBinStrm);
+      if (ldrs.empty())
       {
       Log::Write("ui_text") << "Not loader available" << LogEnd;
       return false;
@@ -188,7 +214,7 @@ int main(int argc, char **argv)
 
       std::cout << "Choose a executable format:" << std::endl;
       AskFor<Loader::VectorSharedPtr::value_type, Loader::VectorSharedPtr> AskForLoader;
-      Loader::VectorSharedPtr::value_type ldr = AskForLoader(mod_mgr.GetLoaders());
+      Loader::VectorSharedPtr::value_type ldr = AskForLoader(ldrs);
       std::cout << "Interpreting executable format using \"" << ldr->GetName() << "\"..." << std::endl;
       std::cout << std::endl;
       rspLoader = ldr;
@@ -197,6 +223,7 @@ int main(int argc, char **argv)
       ldr->FilterAndConfigureArchitectures(archs);
       if (archs.empty())
 	      throw std::runtime_error("no architecture available");
+      rspArchitectures = archs;
 
       auto os = mod_mgr.GetOperatingSystem(ldr, archs.front());
       rspOperatingSystem = os;
@@ -219,6 +246,8 @@ int main(int argc, char **argv)
     throw std::runtime_error("failed to create new document");
 
     m.WaitForTasks();
+    Log::Flush();
+    DumpLockStatistics();
 
     int step = 100;
     FullDisassemblyView fdv(m, new StreamPrinter(m, std::cout), Printer::ShowAddress | Printer::AddSpaceBeforeXref, 80, step, m.GetDocument().GetStartAddress());